@@ -19,12 +19,17 @@
 #include "Sim/Units/CommandAI/Command.h"
 #include "Sim/Weapons/WeaponDef.h"
 #include "Net/Protocol/NetProtocol.h"
+#include "System/Config/ConfigHandler.h"
 #include "System/Log/ILog.h"
 #include "System/TimeProfiler.h"
 #include "System/SafeUtil.h"
 
 #include "System/creg/STL_Map.h"
 
+#include <array>
+
+CONFIG(bool, AIThreadedUpdate).defaultValue(false).description("Run the per-frame Update event of every local Skirmish AI on its own thread. Only the AIs' own work between calls into the engine overlaps: every such call is serialized on one lock and the simulation still waits each frame until the slowest AI has finished.");
+
 CR_BIND(CEngineOutHandler, )
 CR_REG_METADATA(CEngineOutHandler, (
 	// FIXME:
@@ -49,6 +54,35 @@ static inline bool IsUnitInLosOrRadarOfAllyTeam(const CUnit& unit, const int all
 static CEngineOutHandler* singleton = nullptr;
 static unsigned int numInstances = 0;
 
+static bool threadedUpdate = false;
+
+// frame each AI was last warned about exceeding the frame-budget
+static std::array<int, MAX_AIS> lagWarningFrames;
+
+static void CheckUpdateLag(const CSkirmishAIWrapper* ai, int frame) {
+	constexpr float frameBudget = 1000.0f / GAME_SPEED;
+
+	const float lastTime = ai->GetLastUpdateTime().toMilliSecsf();
+	const float avgTime = ai->GetAvgUpdateTime().toMilliSecsf();
+
+	if (lastTime <= frameBudget)
+		return;
+
+	int& lagWarningFrame = lagWarningFrames[ai->GetSkirmishAIID()];
+
+	if ((frame - lagWarningFrame) < (GAME_SPEED * 10))
+		return;
+
+	lagWarningFrame = frame;
+
+	const SkirmishAIData* aiData = skirmishAIHandler.GetSkirmishAI(ai->GetSkirmishAIID());
+
+	LOG_L(L_WARNING,
+		"[EOH::%s][frame=%d] Skirmish AI %s (id=%d, team=%d) is lagging: Update took %.1fms (avg %.1fms, frame-budget %.1fms)",
+		__func__, frame, aiData->shortName.c_str(), ai->GetSkirmishAIID(), ai->GetTeamId(), lastTime, avgTime, frameBudget
+	);
+}
+
 CEngineOutHandler* CEngineOutHandler::GetInstance() {
 	// if more than one instance, some code called eoh->func()
 	// and created another after Destroy was already executed
@@ -59,6 +93,9 @@ CEngineOutHandler* CEngineOutHandler::GetInstance() {
 
 void CEngineOutHandler::Create() {
 	if (singleton == nullptr) {
+		threadedUpdate = configHandler->GetBool("AIThreadedUpdate");
+		lagWarningFrames.fill(-GAME_SPEED * 10);
+
 		singleton = new CEngineOutHandler();
 		numInstances += 1;
 	}
@@ -134,9 +171,22 @@ void CEngineOutHandler::Update() {
 
 	const int frame = gs->frameNum;
 
-	DO_FOR_SKIRMISH_AIS(Update(frame))
+	if (threadedUpdate) {
+		// fork-join; no sim-state changes until every AI has finished, so
+		// this frame still takes at least as long as the slowest AI Update
+		DO_FOR_SKIRMISH_AIS(UpdateAsync(frame))
+		DO_FOR_SKIRMISH_AIS(WaitForUpdate())
+	} else {
+		DO_FOR_SKIRMISH_AIS(Update(frame))
+	}
+
+	for (const auto& ai: hostSkirmishAIs) {
+		CheckUpdateLag((ai.second).get(), frame);
+	}
 }
 
+bool CEngineOutHandler::IsThreadedUpdate() { return threadedUpdate; }
+
 
 
 // Do only if the unit is not allied, in which case we know
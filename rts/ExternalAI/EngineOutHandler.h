@@ -35,6 +35,9 @@ public:
 	static void Create();
 	static void Destroy();
 
+	/// true if local Skirmish AIs receive their Update events on worker-threads
+	static bool IsThreadedUpdate();
+
 	void PostLoad();
 	/** Called just before all the units are destroyed. */
 	void PreDestroy();
@@ -1199,6 +1199,38 @@ struct SSkirmishAICallback {
 	 */
 	int               (CALLING_CONV *getSelectedUnits)(int skirmishAIId, int* unitIds, int unitIds_sizeMax); //$ FETCHER:MULTI:IDs:Unit:unitIds
 
+	/**
+	 * Bulk versions of some of the Unit_get* callbacks below; each fills a
+	 * caller provided array with the values for all the given units, so
+	 * the state of many units can be read with a single call.
+	 * Every value follows the same LOS and cheat rules as the single-unit
+	 * callback, and units that are not visible (or do not exist) get the
+	 * value it would return for them.
+	 * The returned value is the number of array elements written, which
+	 * is limited by the sizeMax of the output array; if the output array
+	 * is NULL, the number of elements required for all units is returned.
+	 */
+	int               (CALLING_CONV *getUnitsPos)(int skirmishAIId, int* unitIds, int unitIds_size, float* positions_AposF3, int positions_AposF3_sizeMax); //$ ARRAY:unitIds->Unit
+
+	/** @see getUnitsPos */
+	int               (CALLING_CONV *getUnitsVel)(int skirmishAIId, int* unitIds, int unitIds_size, float* velocities_AposF3, int velocities_AposF3_sizeMax); //$ ARRAY:unitIds->Unit
+
+	/** @see getUnitsPos */
+	int               (CALLING_CONV *getUnitsHealth)(int skirmishAIId, int* unitIds, int unitIds_size, float* healths, int healths_sizeMax); //$ ARRAY:unitIds->Unit
+
+	/**
+	 * Writes the unit-def ID of each unit, or -1 if it is not visible.
+	 * @see getUnitsPos
+	 */
+	int               (CALLING_CONV *getUnitsDef)(int skirmishAIId, int* unitIds, int unitIds_size, int* unitDefIds, int unitDefIds_sizeMax); //$ ARRAY:unitIds->Unit
+
+	/**
+	 * Writes the command ID of the first command in each units queue,
+	 * or -1 if the queue is empty or not accessible.
+	 * @see getUnitsPos
+	 */
+	int               (CALLING_CONV *getUnitsCurrentCommand)(int skirmishAIId, int* unitIds, int unitIds_size, int* commandIds, int commandIds_sizeMax); //$ ARRAY:unitIds->Unit
+
 	/**
 	 * Returns the unit's unitdef struct from which you can read all
 	 * the statistics of the unit, do NOT try to change any values in it.
@@ -45,6 +45,7 @@
 #include "System/myMath.h"
 #include "System/FileSystem/ArchiveScanner.h"
 #include "System/Log/ILog.h"
+#include "System/Threading/SpringThreading.h"
 
 
 static const char* SKIRMISH_AIS_VERSION_COMMON = "common";
@@ -1444,25 +1445,28 @@ EXPORT(char*) skirmishAiCallback_DataDirs_allocatePath(
 	bool dir,
 	bool common
 ) {
-	static char path[2048];
+	checkSkirmishAIId(skirmishAIId);
+
+	// one result per AI; in threaded-update mode several AIs call this at
+	// once and read the returned buffer after the callback lock is released
+	static std::string allocatedPaths[MAX_SKIRMISH_AIS];
+
+	char path[2048];
 
 	if (!skirmishAiCallback_DataDirs_locatePath(skirmishAIId, &path[0], sizeof(path), relPath, writeable, create, dir, common))
 		path[0] = 0;
 
-	return &path[0];
+	allocatedPaths[skirmishAIId] = path;
+	return &allocatedPaths[skirmishAIId][0];
 }
 
 
 EXPORT(const char*) skirmishAiCallback_DataDirs_getWriteableDir(int skirmishAIId) {
 	checkSkirmishAIId(skirmishAIId);
 
-	static std::vector<std::string> writeableDataDirs;
-
-	// fill up writeableDataDirs until teamId index is in there
-	// if it is not yet
-	for (size_t wdd = writeableDataDirs.size(); wdd <= (size_t)skirmishAIId; ++wdd) {
-		writeableDataDirs.push_back("");
-	}
+	// fixed-size, growing a vector here would move the strings
+	// other AIs may still be reading (threaded-update mode)
+	static std::string writeableDataDirs[MAX_SKIRMISH_AIS];
 
 	if (writeableDataDirs[skirmishAIId].empty()) {
 		char tmpRes[1024];
@@ -3848,7 +3852,7 @@ EXPORT(int) skirmishAiCallback_Unit_CurrentCommand_getParams(
 	if (!CHECK_COMMAND_ID(q, commandId))
 		return -1;
 
-	const std::vector<float>& ps = q->at(commandId).params;
+	const auto& ps = q->at(commandId).params;
 	const int paramsRealSize = ps.size();
 
 	size_t paramsSize = paramsRealSize;
@@ -4184,6 +4188,83 @@ EXPORT(int) skirmishAiCallback_getTeamUnits(int skirmishAIId, int* unitIds, int
 }
 
 
+// per-unit accessors for the getUnits* bulk callbacks; templated since
+// CAICallback and CAICheats share the accessor names but not a base
+struct UnitPosGetter {
+	template<typename CB> void operator () (CB* cb, int unitId, float* pos) const { cb->GetUnitPos(unitId).copyInto(pos); }
+};
+struct UnitVelGetter {
+	template<typename CB> void operator () (CB* cb, int unitId, float* vel) const { cb->GetUnitVelocity(unitId).copyInto(vel); }
+};
+struct UnitHealthGetter {
+	template<typename CB> void operator () (CB* cb, int unitId, float* health) const { *health = cb->GetUnitHealth(unitId); }
+};
+struct UnitDefGetter {
+	template<typename CB> void operator () (CB* cb, int unitId, int* unitDefId) const {
+		const UnitDef* unitDef = cb->GetUnitDef(unitId);
+		*unitDefId = ((unitDef != nullptr)? unitDef->id: -1);
+	}
+};
+struct UnitCurrentCommandGetter {
+	template<typename CB> void operator () (CB* cb, int unitId, int* commandId) const {
+		const CCommandQueue* q = cb->GetCurrentUnitCommands(unitId);
+		*commandId = ((q != nullptr && !q->empty())? q->front().GetID(): -1);
+	}
+};
+
+/**
+ * Applies <getter> to each unit whose values fit into <values>, with the
+ * callback matching the AI's cheat state (which is only looked up once).
+ * @return the number of elements written, or required if values is NULL
+ */
+template<int numComponents, typename T, typename Getter>
+static int fillUnitsArray(int skirmishAIId, const int* unitIds, int unitIdsSize, T* values, int valuesMaxSize, const Getter& getter) {
+	if (unitIds == nullptr || unitIdsSize <= 0)
+		return 0;
+
+	if (values == nullptr)
+		return (unitIdsSize * numComponents);
+
+	const int numUnits = std::min(unitIdsSize, valuesMaxSize / numComponents);
+
+	if (skirmishAiCallback_Cheats_isEnabled(skirmishAIId)) {
+		CAICheats* cheatCallback = skirmishAIId_cheatCallback[skirmishAIId];
+
+		for (int i = 0; i < numUnits; i++) {
+			getter(cheatCallback, unitIds[i], values + i * numComponents);
+		}
+	} else {
+		CAICallback* callback = skirmishAIId_callback[skirmishAIId];
+
+		for (int i = 0; i < numUnits; i++) {
+			getter(callback, unitIds[i], values + i * numComponents);
+		}
+	}
+
+	return (numUnits * numComponents);
+}
+
+EXPORT(int) skirmishAiCallback_getUnitsPos(int skirmishAIId, int* unitIds, int unitIdsSize, float* positions_AposF3, int positionsMaxSize) {
+	return fillUnitsArray<3>(skirmishAIId, unitIds, unitIdsSize, positions_AposF3, positionsMaxSize, UnitPosGetter());
+}
+
+EXPORT(int) skirmishAiCallback_getUnitsVel(int skirmishAIId, int* unitIds, int unitIdsSize, float* velocities_AposF3, int velocitiesMaxSize) {
+	return fillUnitsArray<3>(skirmishAIId, unitIds, unitIdsSize, velocities_AposF3, velocitiesMaxSize, UnitVelGetter());
+}
+
+EXPORT(int) skirmishAiCallback_getUnitsHealth(int skirmishAIId, int* unitIds, int unitIdsSize, float* healths, int healthsMaxSize) {
+	return fillUnitsArray<1>(skirmishAIId, unitIds, unitIdsSize, healths, healthsMaxSize, UnitHealthGetter());
+}
+
+EXPORT(int) skirmishAiCallback_getUnitsDef(int skirmishAIId, int* unitIds, int unitIdsSize, int* unitDefIds, int unitDefIdsMaxSize) {
+	return fillUnitsArray<1>(skirmishAIId, unitIds, unitIdsSize, unitDefIds, unitDefIdsMaxSize, UnitDefGetter());
+}
+
+EXPORT(int) skirmishAiCallback_getUnitsCurrentCommand(int skirmishAIId, int* unitIds, int unitIdsSize, int* commandIds, int commandIdsMaxSize) {
+	return fillUnitsArray<1>(skirmishAIId, unitIds, unitIdsSize, commandIds, commandIdsMaxSize, UnitCurrentCommandGetter());
+}
+
+
 //########### BEGINN Team
 EXPORT(bool) skirmishAiCallback_Team_hasAIController(int skirmishAIId, int teamId) {
 	for (auto& tid : skirmishAIId_teamId) {
@@ -5265,7 +5346,7 @@ EXPORT(int) skirmishAiCallback_Group_OrderPreview_getParams(
 	if (!isControlledByLocalPlayer(skirmishAIId))
 		return 0;
 
-	const std::vector<float>& ps = guihandler->GetOrderPreview().params;
+	const auto& ps = guihandler->GetOrderPreview().params;
 	const int paramsRealSize = ps.size();
 
 	size_t paramsSize = paramsRealSize;
@@ -5294,650 +5375,673 @@ EXPORT(bool) skirmishAiCallback_Group_isSelected(int skirmishAIId, int groupId)
 
 
 
-static void skirmishAiCallback_init(SSkirmishAICallback* callback) {
+// in threaded-update mode (AIThreadedUpdate) several AIs can call into the
+// engine at the same time; every entry-point is then wrapped by a thunk that
+// serializes it against all others, since the engine state behind them was
+// never written to be read concurrently (the simulation itself is suspended
+// while AI threads run, see CEngineOutHandler::Update)
+static spring::recursive_mutex aiCallbackMutex;
+
+template<typename F, F func> struct LockedCallback;
+template<typename R, typename... A, R (CALLING_CONV* func)(A...)> struct LockedCallback<R (CALLING_CONV*)(A...), func> {
+	static R CALLING_CONV Call(A... args) {
+		std::lock_guard<spring::recursive_mutex> lock(aiCallbackMutex);
+		return func(args...);
+	}
+};
+
+#define AI_CALLBACK(f) (lockCallbacks? &LockedCallback<decltype(&f), &f>::Call: &f)
+
+static void skirmishAiCallback_init(SSkirmishAICallback* callback, bool lockCallbacks) {
 	//! register function pointers to the accessors
-	callback->Engine_handleCommand = &skirmishAiCallback_Engine_handleCommand;
-	callback->Engine_executeCommand = &skirmishAiCallback_Engine_executeCommand;
-
-	callback->Engine_Version_getMajor = &skirmishAiCallback_Engine_Version_getMajor;
-	callback->Engine_Version_getMinor = &skirmishAiCallback_Engine_Version_getMinor;
-	callback->Engine_Version_getPatchset = &skirmishAiCallback_Engine_Version_getPatchset;
-	callback->Engine_Version_getCommits = &skirmishAiCallback_Engine_Version_getCommits;
-	callback->Engine_Version_getHash = &skirmishAiCallback_Engine_Version_getHash;
-	callback->Engine_Version_getBranch = &skirmishAiCallback_Engine_Version_getBranch;
-	callback->Engine_Version_getAdditional = &skirmishAiCallback_Engine_Version_getAdditional;
-	callback->Engine_Version_getBuildTime = &skirmishAiCallback_Engine_Version_getBuildTime;
-	callback->Engine_Version_isRelease = &skirmishAiCallback_Engine_Version_isRelease;
-	callback->Engine_Version_getNormal = &skirmishAiCallback_Engine_Version_getNormal;
-	callback->Engine_Version_getSync = &skirmishAiCallback_Engine_Version_getSync;
-	callback->Engine_Version_getFull = &skirmishAiCallback_Engine_Version_getFull;
-	callback->Teams_getSize = &skirmishAiCallback_Teams_getSize;
-	callback->SkirmishAIs_getSize = &skirmishAiCallback_SkirmishAIs_getSize;
-	callback->SkirmishAIs_getMax = &skirmishAiCallback_SkirmishAIs_getMax;
-	callback->SkirmishAI_getTeamId = &skirmishAiCallback_SkirmishAI_getTeamId;
-	callback->SkirmishAI_Info_getSize = &skirmishAiCallback_SkirmishAI_Info_getSize;
-	callback->SkirmishAI_Info_getKey = &skirmishAiCallback_SkirmishAI_Info_getKey;
-	callback->SkirmishAI_Info_getValue = &skirmishAiCallback_SkirmishAI_Info_getValue;
-	callback->SkirmishAI_Info_getDescription = &skirmishAiCallback_SkirmishAI_Info_getDescription;
-	callback->SkirmishAI_Info_getValueByKey = &skirmishAiCallback_SkirmishAI_Info_getValueByKey;
-	callback->SkirmishAI_OptionValues_getSize = &skirmishAiCallback_SkirmishAI_OptionValues_getSize;
-	callback->SkirmishAI_OptionValues_getKey = &skirmishAiCallback_SkirmishAI_OptionValues_getKey;
-	callback->SkirmishAI_OptionValues_getValue = &skirmishAiCallback_SkirmishAI_OptionValues_getValue;
-	callback->SkirmishAI_OptionValues_getValueByKey = &skirmishAiCallback_SkirmishAI_OptionValues_getValueByKey;
-	callback->Log_log = &skirmishAiCallback_Log_log;
-	callback->Log_exception = &skirmishAiCallback_Log_exception;
-	callback->DataDirs_getPathSeparator = &skirmishAiCallback_DataDirs_getPathSeparator;
-	callback->DataDirs_getConfigDir = &skirmishAiCallback_DataDirs_getConfigDir;
-	callback->DataDirs_getWriteableDir = &skirmishAiCallback_DataDirs_getWriteableDir;
-	callback->DataDirs_locatePath = &skirmishAiCallback_DataDirs_locatePath;
-	callback->DataDirs_allocatePath = &skirmishAiCallback_DataDirs_allocatePath;
-	callback->DataDirs_Roots_getSize = &skirmishAiCallback_DataDirs_Roots_getSize;
-	callback->DataDirs_Roots_getDir = &skirmishAiCallback_DataDirs_Roots_getDir;
-	callback->DataDirs_Roots_locatePath = &skirmishAiCallback_DataDirs_Roots_locatePath;
-	callback->DataDirs_Roots_allocatePath = &skirmishAiCallback_DataDirs_Roots_allocatePath;
-	callback->Game_getCurrentFrame = &skirmishAiCallback_Game_getCurrentFrame;
-	callback->Game_getAiInterfaceVersion = &skirmishAiCallback_Game_getAiInterfaceVersion;
-	callback->Game_getMyTeam = &skirmishAiCallback_Game_getMyTeam;
-	callback->Game_getMyAllyTeam = &skirmishAiCallback_Game_getMyAllyTeam;
-	callback->Game_getPlayerTeam = &skirmishAiCallback_Game_getPlayerTeam;
-	callback->Game_getTeams = &skirmishAiCallback_Game_getTeams;
-	callback->Game_getTeamSide = &skirmishAiCallback_Game_getTeamSide;
-	callback->Game_getTeamColor = &skirmishAiCallback_Game_getTeamColor;
-	callback->Game_getTeamIncomeMultiplier = &skirmishAiCallback_Game_getTeamIncomeMultiplier;
-	callback->Game_getTeamAllyTeam = &skirmishAiCallback_Game_getTeamAllyTeam;
-	callback->Game_getTeamResourceCurrent = &skirmishAiCallback_Game_getTeamResourceCurrent;
-	callback->Game_getTeamResourceIncome = &skirmishAiCallback_Game_getTeamResourceIncome;
-	callback->Game_getTeamResourceUsage = &skirmishAiCallback_Game_getTeamResourceUsage;
-	callback->Game_getTeamResourceStorage = &skirmishAiCallback_Game_getTeamResourceStorage;
-	callback->Game_getTeamResourcePull = &skirmishAiCallback_Game_getTeamResourcePull;
-	callback->Game_getTeamResourceShare = &skirmishAiCallback_Game_getTeamResourceShare;
-	callback->Game_getTeamResourceSent = &skirmishAiCallback_Game_getTeamResourceSent;
-	callback->Game_getTeamResourceReceived = &skirmishAiCallback_Game_getTeamResourceReceived;
-	callback->Game_getTeamResourceExcess = &skirmishAiCallback_Game_getTeamResourceExcess;
-	callback->Game_isAllied = &skirmishAiCallback_Game_isAllied;
-	callback->Game_isDebugModeEnabled = &skirmishAiCallback_Game_isDebugModeEnabled;
-	callback->Game_isPaused = &skirmishAiCallback_Game_isPaused;
-	callback->Game_getSpeedFactor = &skirmishAiCallback_Game_getSpeedFactor;
-	callback->Game_getSetupScript = &skirmishAiCallback_Game_getSetupScript;
-	callback->Game_getCategoryFlag = &skirmishAiCallback_Game_getCategoryFlag;
-	callback->Game_getCategoriesFlag = &skirmishAiCallback_Game_getCategoriesFlag;
-	callback->Game_getCategoryName = &skirmishAiCallback_Game_getCategoryName;
-	callback->Game_getRulesParamFloat = &skirmishAiCallback_Game_getRulesParamFloat;
-	callback->Game_getRulesParamString = &skirmishAiCallback_Game_getRulesParamString;
-	callback->Gui_getViewRange = &skirmishAiCallback_Gui_getViewRange;
-	callback->Gui_getScreenX = &skirmishAiCallback_Gui_getScreenX;
-	callback->Gui_getScreenY = &skirmishAiCallback_Gui_getScreenY;
-	callback->Gui_Camera_getDirection = &skirmishAiCallback_Gui_Camera_getDirection;
-	callback->Gui_Camera_getPosition = &skirmishAiCallback_Gui_Camera_getPosition;
-	callback->Cheats_isEnabled = &skirmishAiCallback_Cheats_isEnabled;
-	callback->Cheats_setEnabled = &skirmishAiCallback_Cheats_setEnabled;
-	callback->Cheats_setEventsEnabled = &skirmishAiCallback_Cheats_setEventsEnabled;
-	callback->Cheats_isOnlyPassive = &skirmishAiCallback_Cheats_isOnlyPassive;
-	callback->getResources = &skirmishAiCallback_getResources;
-	callback->getResourceByName = &skirmishAiCallback_getResourceByName;
-	callback->Resource_getName = &skirmishAiCallback_Resource_getName;
-	callback->Resource_getOptimum = &skirmishAiCallback_Resource_getOptimum;
-	callback->Economy_getCurrent = &skirmishAiCallback_Economy_getCurrent;
-	callback->Economy_getIncome = &skirmishAiCallback_Economy_getIncome;
-	callback->Economy_getUsage = &skirmishAiCallback_Economy_getUsage;
-	callback->Economy_getStorage = &skirmishAiCallback_Economy_getStorage;
-	callback->Economy_getPull = &skirmishAiCallback_Economy_getPull;
-	callback->Economy_getShare = &skirmishAiCallback_Economy_getShare;
-	callback->Economy_getSent = &skirmishAiCallback_Economy_getSent;
-	callback->Economy_getReceived = &skirmishAiCallback_Economy_getReceived;
-	callback->Economy_getExcess = &skirmishAiCallback_Economy_getExcess;
-	callback->File_getSize = &skirmishAiCallback_File_getSize;
-	callback->File_getContent = &skirmishAiCallback_File_getContent;
-	callback->getUnitDefs = &skirmishAiCallback_getUnitDefs;
-	callback->getUnitDefByName = &skirmishAiCallback_getUnitDefByName;
-	callback->UnitDef_getHeight = &skirmishAiCallback_UnitDef_getHeight;
-	callback->UnitDef_getRadius = &skirmishAiCallback_UnitDef_getRadius;
-	callback->UnitDef_getName = &skirmishAiCallback_UnitDef_getName;
-	callback->UnitDef_getHumanName = &skirmishAiCallback_UnitDef_getHumanName;
-	callback->UnitDef_getFileName = &skirmishAiCallback_UnitDef_getFileName;
-	callback->UnitDef_getAiHint = &skirmishAiCallback_UnitDef_getAiHint;
-	callback->UnitDef_getCobId = &skirmishAiCallback_UnitDef_getCobId;
-	callback->UnitDef_getTechLevel = &skirmishAiCallback_UnitDef_getTechLevel;
-	callback->UnitDef_getGaia = &skirmishAiCallback_UnitDef_getGaia;
-	callback->UnitDef_getUpkeep = &skirmishAiCallback_UnitDef_getUpkeep;
-	callback->UnitDef_getResourceMake = &skirmishAiCallback_UnitDef_getResourceMake;
-	callback->UnitDef_getMakesResource = &skirmishAiCallback_UnitDef_getMakesResource;
-	callback->UnitDef_getCost = &skirmishAiCallback_UnitDef_getCost;
-	callback->UnitDef_getExtractsResource = &skirmishAiCallback_UnitDef_getExtractsResource;
-	callback->UnitDef_getResourceExtractorRange = &skirmishAiCallback_UnitDef_getResourceExtractorRange;
-	callback->UnitDef_getWindResourceGenerator = &skirmishAiCallback_UnitDef_getWindResourceGenerator;
-	callback->UnitDef_getTidalResourceGenerator = &skirmishAiCallback_UnitDef_getTidalResourceGenerator;
-	callback->UnitDef_getStorage = &skirmishAiCallback_UnitDef_getStorage;
-	callback->UnitDef_isSquareResourceExtractor = &skirmishAiCallback_UnitDef_isSquareResourceExtractor;
-	callback->UnitDef_getBuildTime = &skirmishAiCallback_UnitDef_getBuildTime;
-	callback->UnitDef_getAutoHeal = &skirmishAiCallback_UnitDef_getAutoHeal;
-	callback->UnitDef_getIdleAutoHeal = &skirmishAiCallback_UnitDef_getIdleAutoHeal;
-	callback->UnitDef_getIdleTime = &skirmishAiCallback_UnitDef_getIdleTime;
-	callback->UnitDef_getPower = &skirmishAiCallback_UnitDef_getPower;
-	callback->UnitDef_getHealth = &skirmishAiCallback_UnitDef_getHealth;
-	callback->UnitDef_getCategory = &skirmishAiCallback_UnitDef_getCategory;
-	callback->UnitDef_getSpeed = &skirmishAiCallback_UnitDef_getSpeed;
-	callback->UnitDef_getTurnRate = &skirmishAiCallback_UnitDef_getTurnRate;
-	callback->UnitDef_isTurnInPlace = &skirmishAiCallback_UnitDef_isTurnInPlace;
-	callback->UnitDef_getTurnInPlaceDistance = &skirmishAiCallback_UnitDef_getTurnInPlaceDistance;
-	callback->UnitDef_getTurnInPlaceSpeedLimit = &skirmishAiCallback_UnitDef_getTurnInPlaceSpeedLimit;
-	callback->UnitDef_isUpright = &skirmishAiCallback_UnitDef_isUpright;
-	callback->UnitDef_isCollide = &skirmishAiCallback_UnitDef_isCollide;
-	callback->UnitDef_getLosRadius = &skirmishAiCallback_UnitDef_getLosRadius;
-	callback->UnitDef_getAirLosRadius = &skirmishAiCallback_UnitDef_getAirLosRadius;
-	callback->UnitDef_getLosHeight = &skirmishAiCallback_UnitDef_getLosHeight;
-	callback->UnitDef_getRadarRadius = &skirmishAiCallback_UnitDef_getRadarRadius;
-	callback->UnitDef_getSonarRadius = &skirmishAiCallback_UnitDef_getSonarRadius;
-	callback->UnitDef_getJammerRadius = &skirmishAiCallback_UnitDef_getJammerRadius;
-	callback->UnitDef_getSonarJamRadius = &skirmishAiCallback_UnitDef_getSonarJamRadius;
-	callback->UnitDef_getSeismicRadius = &skirmishAiCallback_UnitDef_getSeismicRadius;
-	callback->UnitDef_getSeismicSignature = &skirmishAiCallback_UnitDef_getSeismicSignature;
-	callback->UnitDef_isStealth = &skirmishAiCallback_UnitDef_isStealth;
-	callback->UnitDef_isSonarStealth = &skirmishAiCallback_UnitDef_isSonarStealth;
-	callback->UnitDef_isBuildRange3D = &skirmishAiCallback_UnitDef_isBuildRange3D;
-	callback->UnitDef_getBuildDistance = &skirmishAiCallback_UnitDef_getBuildDistance;
-	callback->UnitDef_getBuildSpeed = &skirmishAiCallback_UnitDef_getBuildSpeed;
-	callback->UnitDef_getReclaimSpeed = &skirmishAiCallback_UnitDef_getReclaimSpeed;
-	callback->UnitDef_getRepairSpeed = &skirmishAiCallback_UnitDef_getRepairSpeed;
-	callback->UnitDef_getMaxRepairSpeed = &skirmishAiCallback_UnitDef_getMaxRepairSpeed;
-	callback->UnitDef_getResurrectSpeed = &skirmishAiCallback_UnitDef_getResurrectSpeed;
-	callback->UnitDef_getCaptureSpeed = &skirmishAiCallback_UnitDef_getCaptureSpeed;
-	callback->UnitDef_getTerraformSpeed = &skirmishAiCallback_UnitDef_getTerraformSpeed;
-	callback->UnitDef_getMass = &skirmishAiCallback_UnitDef_getMass;
-	callback->UnitDef_isPushResistant = &skirmishAiCallback_UnitDef_isPushResistant;
-	callback->UnitDef_isStrafeToAttack = &skirmishAiCallback_UnitDef_isStrafeToAttack;
-	callback->UnitDef_getMinCollisionSpeed = &skirmishAiCallback_UnitDef_getMinCollisionSpeed;
-	callback->UnitDef_getSlideTolerance = &skirmishAiCallback_UnitDef_getSlideTolerance;
-	callback->UnitDef_getMaxSlope = &skirmishAiCallback_UnitDef_getMaxSlope;
-	callback->UnitDef_getMaxHeightDif = &skirmishAiCallback_UnitDef_getMaxHeightDif;
-	callback->UnitDef_getMinWaterDepth = &skirmishAiCallback_UnitDef_getMinWaterDepth;
-	callback->UnitDef_getWaterline = &skirmishAiCallback_UnitDef_getWaterline;
-	callback->UnitDef_getMaxWaterDepth = &skirmishAiCallback_UnitDef_getMaxWaterDepth;
-	callback->UnitDef_getArmoredMultiple = &skirmishAiCallback_UnitDef_getArmoredMultiple;
-	callback->UnitDef_getArmorType = &skirmishAiCallback_UnitDef_getArmorType;
-	callback->UnitDef_FlankingBonus_getMode = &skirmishAiCallback_UnitDef_FlankingBonus_getMode;
-	callback->UnitDef_FlankingBonus_getDir = &skirmishAiCallback_UnitDef_FlankingBonus_getDir;
-	callback->UnitDef_FlankingBonus_getMax = &skirmishAiCallback_UnitDef_FlankingBonus_getMax;
-	callback->UnitDef_FlankingBonus_getMin = &skirmishAiCallback_UnitDef_FlankingBonus_getMin;
-	callback->UnitDef_FlankingBonus_getMobilityAdd = &skirmishAiCallback_UnitDef_FlankingBonus_getMobilityAdd;
-	callback->UnitDef_getMaxWeaponRange = &skirmishAiCallback_UnitDef_getMaxWeaponRange;
-	callback->UnitDef_getType = &skirmishAiCallback_UnitDef_getType;
-	callback->UnitDef_getTooltip = &skirmishAiCallback_UnitDef_getTooltip;
-	callback->UnitDef_getWreckName = &skirmishAiCallback_UnitDef_getWreckName;
-	callback->UnitDef_getDeathExplosion = &skirmishAiCallback_UnitDef_getDeathExplosion;
-	callback->UnitDef_getSelfDExplosion = &skirmishAiCallback_UnitDef_getSelfDExplosion;
-	callback->UnitDef_getCategoryString = &skirmishAiCallback_UnitDef_getCategoryString;
-	callback->UnitDef_isAbleToSelfD = &skirmishAiCallback_UnitDef_isAbleToSelfD;
-	callback->UnitDef_getSelfDCountdown = &skirmishAiCallback_UnitDef_getSelfDCountdown;
-	callback->UnitDef_isAbleToSubmerge = &skirmishAiCallback_UnitDef_isAbleToSubmerge;
-	callback->UnitDef_isAbleToFly = &skirmishAiCallback_UnitDef_isAbleToFly;
-	callback->UnitDef_isAbleToMove = &skirmishAiCallback_UnitDef_isAbleToMove;
-	callback->UnitDef_isAbleToHover = &skirmishAiCallback_UnitDef_isAbleToHover;
-	callback->UnitDef_isFloater = &skirmishAiCallback_UnitDef_isFloater;
-	callback->UnitDef_isBuilder = &skirmishAiCallback_UnitDef_isBuilder;
-	callback->UnitDef_isActivateWhenBuilt = &skirmishAiCallback_UnitDef_isActivateWhenBuilt;
-	callback->UnitDef_isOnOffable = &skirmishAiCallback_UnitDef_isOnOffable;
-	callback->UnitDef_isFullHealthFactory = &skirmishAiCallback_UnitDef_isFullHealthFactory;
-	callback->UnitDef_isFactoryHeadingTakeoff = &skirmishAiCallback_UnitDef_isFactoryHeadingTakeoff;
-	callback->UnitDef_isReclaimable = &skirmishAiCallback_UnitDef_isReclaimable;
-	callback->UnitDef_isCapturable = &skirmishAiCallback_UnitDef_isCapturable;
-	callback->UnitDef_isAbleToRestore = &skirmishAiCallback_UnitDef_isAbleToRestore;
-	callback->UnitDef_isAbleToRepair = &skirmishAiCallback_UnitDef_isAbleToRepair;
-	callback->UnitDef_isAbleToSelfRepair = &skirmishAiCallback_UnitDef_isAbleToSelfRepair;
-	callback->UnitDef_isAbleToReclaim = &skirmishAiCallback_UnitDef_isAbleToReclaim;
-	callback->UnitDef_isAbleToAttack = &skirmishAiCallback_UnitDef_isAbleToAttack;
-	callback->UnitDef_isAbleToPatrol = &skirmishAiCallback_UnitDef_isAbleToPatrol;
-	callback->UnitDef_isAbleToFight = &skirmishAiCallback_UnitDef_isAbleToFight;
-	callback->UnitDef_isAbleToGuard = &skirmishAiCallback_UnitDef_isAbleToGuard;
-	callback->UnitDef_isAbleToAssist = &skirmishAiCallback_UnitDef_isAbleToAssist;
-	callback->UnitDef_isAssistable = &skirmishAiCallback_UnitDef_isAssistable;
-	callback->UnitDef_isAbleToRepeat = &skirmishAiCallback_UnitDef_isAbleToRepeat;
-	callback->UnitDef_isAbleToFireControl = &skirmishAiCallback_UnitDef_isAbleToFireControl;
-	callback->UnitDef_getFireState = &skirmishAiCallback_UnitDef_getFireState;
-	callback->UnitDef_getMoveState = &skirmishAiCallback_UnitDef_getMoveState;
-	callback->UnitDef_getWingDrag = &skirmishAiCallback_UnitDef_getWingDrag;
-	callback->UnitDef_getWingAngle = &skirmishAiCallback_UnitDef_getWingAngle;
-	callback->UnitDef_getDrag = &skirmishAiCallback_UnitDef_getDrag;
-	callback->UnitDef_getFrontToSpeed = &skirmishAiCallback_UnitDef_getFrontToSpeed;
-	callback->UnitDef_getSpeedToFront = &skirmishAiCallback_UnitDef_getSpeedToFront;
-	callback->UnitDef_getMyGravity = &skirmishAiCallback_UnitDef_getMyGravity;
-	callback->UnitDef_getMaxBank = &skirmishAiCallback_UnitDef_getMaxBank;
-	callback->UnitDef_getMaxPitch = &skirmishAiCallback_UnitDef_getMaxPitch;
-	callback->UnitDef_getTurnRadius = &skirmishAiCallback_UnitDef_getTurnRadius;
-	callback->UnitDef_getWantedHeight = &skirmishAiCallback_UnitDef_getWantedHeight;
-	callback->UnitDef_getVerticalSpeed = &skirmishAiCallback_UnitDef_getVerticalSpeed;
-	callback->UnitDef_isAbleToCrash = &skirmishAiCallback_UnitDef_isAbleToCrash;
-	callback->UnitDef_isHoverAttack = &skirmishAiCallback_UnitDef_isHoverAttack;
-	callback->UnitDef_isAirStrafe = &skirmishAiCallback_UnitDef_isAirStrafe;
-	callback->UnitDef_getDlHoverFactor = &skirmishAiCallback_UnitDef_getDlHoverFactor;
-	callback->UnitDef_getMaxAcceleration = &skirmishAiCallback_UnitDef_getMaxAcceleration;
-	callback->UnitDef_getMaxDeceleration = &skirmishAiCallback_UnitDef_getMaxDeceleration;
-	callback->UnitDef_getMaxAileron = &skirmishAiCallback_UnitDef_getMaxAileron;
-	callback->UnitDef_getMaxElevator = &skirmishAiCallback_UnitDef_getMaxElevator;
-	callback->UnitDef_getMaxRudder = &skirmishAiCallback_UnitDef_getMaxRudder;
-	callback->UnitDef_getYardMap = &skirmishAiCallback_UnitDef_getYardMap;
-	callback->UnitDef_getXSize = &skirmishAiCallback_UnitDef_getXSize;
-	callback->UnitDef_getZSize = &skirmishAiCallback_UnitDef_getZSize;
-	callback->UnitDef_getBuildAngle = &skirmishAiCallback_UnitDef_getBuildAngle;
-	callback->UnitDef_getLoadingRadius = &skirmishAiCallback_UnitDef_getLoadingRadius;
-	callback->UnitDef_getUnloadSpread = &skirmishAiCallback_UnitDef_getUnloadSpread;
-	callback->UnitDef_getTransportCapacity = &skirmishAiCallback_UnitDef_getTransportCapacity;
-	callback->UnitDef_getTransportSize = &skirmishAiCallback_UnitDef_getTransportSize;
-	callback->UnitDef_getMinTransportSize = &skirmishAiCallback_UnitDef_getMinTransportSize;
-	callback->UnitDef_isAirBase = &skirmishAiCallback_UnitDef_isAirBase;
-	callback->UnitDef_isFirePlatform = &skirmishAiCallback_UnitDef_isFirePlatform;
-	callback->UnitDef_getTransportMass = &skirmishAiCallback_UnitDef_getTransportMass;
-	callback->UnitDef_getMinTransportMass = &skirmishAiCallback_UnitDef_getMinTransportMass;
-	callback->UnitDef_isHoldSteady = &skirmishAiCallback_UnitDef_isHoldSteady;
-	callback->UnitDef_isReleaseHeld = &skirmishAiCallback_UnitDef_isReleaseHeld;
-	callback->UnitDef_isNotTransportable = &skirmishAiCallback_UnitDef_isNotTransportable;
-	callback->UnitDef_isTransportByEnemy = &skirmishAiCallback_UnitDef_isTransportByEnemy;
-	callback->UnitDef_getTransportUnloadMethod = &skirmishAiCallback_UnitDef_getTransportUnloadMethod;
-	callback->UnitDef_getFallSpeed = &skirmishAiCallback_UnitDef_getFallSpeed;
-	callback->UnitDef_getUnitFallSpeed = &skirmishAiCallback_UnitDef_getUnitFallSpeed;
-	callback->UnitDef_isAbleToCloak = &skirmishAiCallback_UnitDef_isAbleToCloak;
-	callback->UnitDef_isStartCloaked = &skirmishAiCallback_UnitDef_isStartCloaked;
-	callback->UnitDef_getCloakCost = &skirmishAiCallback_UnitDef_getCloakCost;
-	callback->UnitDef_getCloakCostMoving = &skirmishAiCallback_UnitDef_getCloakCostMoving;
-	callback->UnitDef_getDecloakDistance = &skirmishAiCallback_UnitDef_getDecloakDistance;
-	callback->UnitDef_isDecloakSpherical = &skirmishAiCallback_UnitDef_isDecloakSpherical;
-	callback->UnitDef_isDecloakOnFire = &skirmishAiCallback_UnitDef_isDecloakOnFire;
-	callback->UnitDef_isAbleToKamikaze = &skirmishAiCallback_UnitDef_isAbleToKamikaze;
-	callback->UnitDef_getKamikazeDist = &skirmishAiCallback_UnitDef_getKamikazeDist;
-	callback->UnitDef_isTargetingFacility = &skirmishAiCallback_UnitDef_isTargetingFacility;
-	callback->UnitDef_canManualFire = &skirmishAiCallback_UnitDef_canManualFire;
-	callback->UnitDef_isNeedGeo = &skirmishAiCallback_UnitDef_isNeedGeo;
-	callback->UnitDef_isFeature = &skirmishAiCallback_UnitDef_isFeature;
-	callback->UnitDef_isHideDamage = &skirmishAiCallback_UnitDef_isHideDamage;
-	callback->UnitDef_isCommander = &skirmishAiCallback_UnitDef_isCommander;
-	callback->UnitDef_isShowPlayerName = &skirmishAiCallback_UnitDef_isShowPlayerName;
-	callback->UnitDef_isAbleToResurrect = &skirmishAiCallback_UnitDef_isAbleToResurrect;
-	callback->UnitDef_isAbleToCapture = &skirmishAiCallback_UnitDef_isAbleToCapture;
-	callback->UnitDef_getHighTrajectoryType = &skirmishAiCallback_UnitDef_getHighTrajectoryType;
-	callback->UnitDef_getNoChaseCategory = &skirmishAiCallback_UnitDef_getNoChaseCategory;
-	callback->UnitDef_isLeaveTracks = &skirmishAiCallback_UnitDef_isLeaveTracks;
-	callback->UnitDef_getTrackWidth = &skirmishAiCallback_UnitDef_getTrackWidth;
-	callback->UnitDef_getTrackOffset = &skirmishAiCallback_UnitDef_getTrackOffset;
-	callback->UnitDef_getTrackStrength = &skirmishAiCallback_UnitDef_getTrackStrength;
-	callback->UnitDef_getTrackStretch = &skirmishAiCallback_UnitDef_getTrackStretch;
-	callback->UnitDef_getTrackType = &skirmishAiCallback_UnitDef_getTrackType;
-	callback->UnitDef_isAbleToDropFlare = &skirmishAiCallback_UnitDef_isAbleToDropFlare;
-	callback->UnitDef_getFlareReloadTime = &skirmishAiCallback_UnitDef_getFlareReloadTime;
-	callback->UnitDef_getFlareEfficiency = &skirmishAiCallback_UnitDef_getFlareEfficiency;
-	callback->UnitDef_getFlareDelay = &skirmishAiCallback_UnitDef_getFlareDelay;
-	callback->UnitDef_getFlareDropVector = &skirmishAiCallback_UnitDef_getFlareDropVector;
-	callback->UnitDef_getFlareTime = &skirmishAiCallback_UnitDef_getFlareTime;
-	callback->UnitDef_getFlareSalvoSize = &skirmishAiCallback_UnitDef_getFlareSalvoSize;
-	callback->UnitDef_getFlareSalvoDelay = &skirmishAiCallback_UnitDef_getFlareSalvoDelay;
-	callback->UnitDef_isAbleToLoopbackAttack = &skirmishAiCallback_UnitDef_isAbleToLoopbackAttack;
-	callback->UnitDef_isLevelGround = &skirmishAiCallback_UnitDef_isLevelGround;
-	callback->UnitDef_isUseBuildingGroundDecal = &skirmishAiCallback_UnitDef_isUseBuildingGroundDecal;
-	callback->UnitDef_getBuildingDecalType = &skirmishAiCallback_UnitDef_getBuildingDecalType;
-	callback->UnitDef_getBuildingDecalSizeX = &skirmishAiCallback_UnitDef_getBuildingDecalSizeX;
-	callback->UnitDef_getBuildingDecalSizeY = &skirmishAiCallback_UnitDef_getBuildingDecalSizeY;
-	callback->UnitDef_getBuildingDecalDecaySpeed = &skirmishAiCallback_UnitDef_getBuildingDecalDecaySpeed;
-	callback->UnitDef_getMaxThisUnit = &skirmishAiCallback_UnitDef_getMaxThisUnit;
-	callback->UnitDef_getDecoyDef = &skirmishAiCallback_UnitDef_getDecoyDef;
-	callback->UnitDef_isDontLand = &skirmishAiCallback_UnitDef_isDontLand;
-	callback->UnitDef_getShieldDef = &skirmishAiCallback_UnitDef_getShieldDef;
-	callback->UnitDef_getStockpileDef = &skirmishAiCallback_UnitDef_getStockpileDef;
-	callback->UnitDef_getBuildOptions = &skirmishAiCallback_UnitDef_getBuildOptions;
-	callback->UnitDef_getCustomParams = &skirmishAiCallback_UnitDef_getCustomParams;
-	callback->UnitDef_isMoveDataAvailable = &skirmishAiCallback_UnitDef_isMoveDataAvailable;
-	callback->UnitDef_MoveData_getMaxAcceleration = &skirmishAiCallback_UnitDef_MoveData_getMaxAcceleration;
-	callback->UnitDef_MoveData_getMaxBreaking = &skirmishAiCallback_UnitDef_MoveData_getMaxBreaking;
-	callback->UnitDef_MoveData_getMaxSpeed = &skirmishAiCallback_UnitDef_MoveData_getMaxSpeed;
-	callback->UnitDef_MoveData_getMaxTurnRate = &skirmishAiCallback_UnitDef_MoveData_getMaxTurnRate;
-	callback->UnitDef_MoveData_getXSize = &skirmishAiCallback_UnitDef_MoveData_getXSize;
-	callback->UnitDef_MoveData_getZSize = &skirmishAiCallback_UnitDef_MoveData_getZSize;
-	callback->UnitDef_MoveData_getDepth = &skirmishAiCallback_UnitDef_MoveData_getDepth;
-	callback->UnitDef_MoveData_getMaxSlope = &skirmishAiCallback_UnitDef_MoveData_getMaxSlope;
-	callback->UnitDef_MoveData_getSlopeMod = &skirmishAiCallback_UnitDef_MoveData_getSlopeMod;
-	callback->UnitDef_MoveData_getDepthMod = &skirmishAiCallback_UnitDef_MoveData_getDepthMod;
-	callback->UnitDef_MoveData_getPathType = &skirmishAiCallback_UnitDef_MoveData_getPathType;
-	callback->UnitDef_MoveData_getCrushStrength = &skirmishAiCallback_UnitDef_MoveData_getCrushStrength;
-	callback->UnitDef_MoveData_getMoveType = &skirmishAiCallback_UnitDef_MoveData_getMoveType;
-	callback->UnitDef_MoveData_getSpeedModClass = &skirmishAiCallback_UnitDef_MoveData_getSpeedModClass;
-	callback->UnitDef_MoveData_getTerrainClass = &skirmishAiCallback_UnitDef_MoveData_getTerrainClass;
-	callback->UnitDef_MoveData_getFollowGround = &skirmishAiCallback_UnitDef_MoveData_getFollowGround;
-	callback->UnitDef_MoveData_isSubMarine = &skirmishAiCallback_UnitDef_MoveData_isSubMarine;
-	callback->UnitDef_MoveData_getName = &skirmishAiCallback_UnitDef_MoveData_getName;
-	callback->UnitDef_getWeaponMounts = &skirmishAiCallback_UnitDef_getWeaponMounts;
-	callback->UnitDef_WeaponMount_getName = &skirmishAiCallback_UnitDef_WeaponMount_getName;
-	callback->UnitDef_WeaponMount_getWeaponDef = &skirmishAiCallback_UnitDef_WeaponMount_getWeaponDef;
-	callback->UnitDef_WeaponMount_getSlavedTo = &skirmishAiCallback_UnitDef_WeaponMount_getSlavedTo;
-	callback->UnitDef_WeaponMount_getMainDir = &skirmishAiCallback_UnitDef_WeaponMount_getMainDir;
-	callback->UnitDef_WeaponMount_getMaxAngleDif = &skirmishAiCallback_UnitDef_WeaponMount_getMaxAngleDif;
-	callback->UnitDef_WeaponMount_getBadTargetCategory = &skirmishAiCallback_UnitDef_WeaponMount_getBadTargetCategory;
-	callback->UnitDef_WeaponMount_getOnlyTargetCategory = &skirmishAiCallback_UnitDef_WeaponMount_getOnlyTargetCategory;
-	callback->Unit_getLimit = &skirmishAiCallback_Unit_getLimit;
-	callback->Unit_getMax = &skirmishAiCallback_Unit_getMax;
-	callback->getEnemyUnits = &skirmishAiCallback_getEnemyUnits;
-	callback->getEnemyUnitsIn = &skirmishAiCallback_getEnemyUnitsIn;
-	callback->getEnemyUnitsInRadarAndLos = &skirmishAiCallback_getEnemyUnitsInRadarAndLos;
-	callback->getFriendlyUnits = &skirmishAiCallback_getFriendlyUnits;
-	callback->getFriendlyUnitsIn = &skirmishAiCallback_getFriendlyUnitsIn;
-	callback->getNeutralUnits = &skirmishAiCallback_getNeutralUnits;
-	callback->getNeutralUnitsIn = &skirmishAiCallback_getNeutralUnitsIn;
-	callback->getTeamUnits = &skirmishAiCallback_getTeamUnits;
-	callback->getSelectedUnits = &skirmishAiCallback_getSelectedUnits;
-	callback->Unit_getDef = &skirmishAiCallback_Unit_getDef;
-	callback->Unit_getRulesParamFloat = &skirmishAiCallback_Unit_getRulesParamFloat;
-	callback->Unit_getRulesParamString = &skirmishAiCallback_Unit_getRulesParamString;
-	callback->Unit_getTeam = &skirmishAiCallback_Unit_getTeam;
-	callback->Unit_getAllyTeam = &skirmishAiCallback_Unit_getAllyTeam;
-	callback->Unit_getAiHint = &skirmishAiCallback_Unit_getAiHint;
-	callback->Unit_getStockpile = &skirmishAiCallback_Unit_getStockpile;
-	callback->Unit_getStockpileQueued = &skirmishAiCallback_Unit_getStockpileQueued;
-	callback->Unit_getMaxSpeed = &skirmishAiCallback_Unit_getMaxSpeed;
-	callback->Unit_getMaxRange = &skirmishAiCallback_Unit_getMaxRange;
-	callback->Unit_getMaxHealth = &skirmishAiCallback_Unit_getMaxHealth;
-	callback->Unit_getExperience = &skirmishAiCallback_Unit_getExperience;
-	callback->Unit_getGroup = &skirmishAiCallback_Unit_getGroup;
-	callback->Unit_getCurrentCommands = &skirmishAiCallback_Unit_getCurrentCommands;
-	callback->Unit_CurrentCommand_getType = &skirmishAiCallback_Unit_CurrentCommand_getType;
-	callback->Unit_CurrentCommand_getId = &skirmishAiCallback_Unit_CurrentCommand_getId;
-	callback->Unit_CurrentCommand_getOptions = &skirmishAiCallback_Unit_CurrentCommand_getOptions;
-	callback->Unit_CurrentCommand_getTag = &skirmishAiCallback_Unit_CurrentCommand_getTag;
-	callback->Unit_CurrentCommand_getTimeOut = &skirmishAiCallback_Unit_CurrentCommand_getTimeOut;
-	callback->Unit_CurrentCommand_getParams = &skirmishAiCallback_Unit_CurrentCommand_getParams;
-	callback->Unit_getSupportedCommands = &skirmishAiCallback_Unit_getSupportedCommands;
-	callback->Unit_SupportedCommand_getId = &skirmishAiCallback_Unit_SupportedCommand_getId;
-	callback->Unit_SupportedCommand_getName = &skirmishAiCallback_Unit_SupportedCommand_getName;
-	callback->Unit_SupportedCommand_getToolTip = &skirmishAiCallback_Unit_SupportedCommand_getToolTip;
-	callback->Unit_SupportedCommand_isShowUnique = &skirmishAiCallback_Unit_SupportedCommand_isShowUnique;
-	callback->Unit_SupportedCommand_isDisabled = &skirmishAiCallback_Unit_SupportedCommand_isDisabled;
-	callback->Unit_SupportedCommand_getParams = &skirmishAiCallback_Unit_SupportedCommand_getParams;
-	callback->Unit_getHealth = &skirmishAiCallback_Unit_getHealth;
-	callback->Unit_getParalyzeDamage = &skirmishAiCallback_Unit_getParalyzeDamage;
-	callback->Unit_getCaptureProgress = &skirmishAiCallback_Unit_getCaptureProgress;
-	callback->Unit_getBuildProgress = &skirmishAiCallback_Unit_getBuildProgress;
-	callback->Unit_getSpeed = &skirmishAiCallback_Unit_getSpeed;
-	callback->Unit_getPower = &skirmishAiCallback_Unit_getPower;
-	callback->Unit_getResourceUse = &skirmishAiCallback_Unit_getResourceUse;
-	callback->Unit_getResourceMake = &skirmishAiCallback_Unit_getResourceMake;
-	callback->Unit_getPos = &skirmishAiCallback_Unit_getPos;
-	callback->Unit_getVel = &skirmishAiCallback_Unit_getVel;
-	callback->Unit_isActivated = &skirmishAiCallback_Unit_isActivated;
-	callback->Unit_isBeingBuilt = &skirmishAiCallback_Unit_isBeingBuilt;
-	callback->Unit_isCloaked = &skirmishAiCallback_Unit_isCloaked;
-	callback->Unit_isParalyzed = &skirmishAiCallback_Unit_isParalyzed;
-	callback->Unit_isNeutral = &skirmishAiCallback_Unit_isNeutral;
-	callback->Unit_getBuildingFacing = &skirmishAiCallback_Unit_getBuildingFacing;
-	callback->Unit_getLastUserOrderFrame = &skirmishAiCallback_Unit_getLastUserOrderFrame;
-	callback->Unit_getWeapons = &skirmishAiCallback_Unit_getWeapons;
-	callback->Unit_getWeapon = &skirmishAiCallback_Unit_getWeapon;
-	callback->Team_hasAIController = &skirmishAiCallback_Team_hasAIController;
-	callback->getEnemyTeams = &skirmishAiCallback_getEnemyTeams;
-	callback->getAllyTeams = &skirmishAiCallback_getAllyTeams;
-	callback->Team_getRulesParamFloat = &skirmishAiCallback_Team_getRulesParamFloat;
-	callback->Team_getRulesParamString = &skirmishAiCallback_Team_getRulesParamString;
-	callback->getGroups = &skirmishAiCallback_getGroups;
-	callback->Group_getSupportedCommands = &skirmishAiCallback_Group_getSupportedCommands;
-	callback->Group_SupportedCommand_getId = &skirmishAiCallback_Group_SupportedCommand_getId;
-	callback->Group_SupportedCommand_getName = &skirmishAiCallback_Group_SupportedCommand_getName;
-	callback->Group_SupportedCommand_getToolTip = &skirmishAiCallback_Group_SupportedCommand_getToolTip;
-	callback->Group_SupportedCommand_isShowUnique = &skirmishAiCallback_Group_SupportedCommand_isShowUnique;
-	callback->Group_SupportedCommand_isDisabled = &skirmishAiCallback_Group_SupportedCommand_isDisabled;
-	callback->Group_SupportedCommand_getParams = &skirmishAiCallback_Group_SupportedCommand_getParams;
-	callback->Group_OrderPreview_getId = &skirmishAiCallback_Group_OrderPreview_getId;
-	callback->Group_OrderPreview_getOptions = &skirmishAiCallback_Group_OrderPreview_getOptions;
-	callback->Group_OrderPreview_getTag = &skirmishAiCallback_Group_OrderPreview_getTag;
-	callback->Group_OrderPreview_getTimeOut = &skirmishAiCallback_Group_OrderPreview_getTimeOut;
-	callback->Group_OrderPreview_getParams = &skirmishAiCallback_Group_OrderPreview_getParams;
-	callback->Group_isSelected = &skirmishAiCallback_Group_isSelected;
-	callback->Mod_getFileName = &skirmishAiCallback_Mod_getFileName;
-	callback->Mod_getHash = &skirmishAiCallback_Mod_getHash;
-	callback->Mod_getHumanName = &skirmishAiCallback_Mod_getHumanName;
-	callback->Mod_getShortName = &skirmishAiCallback_Mod_getShortName;
-	callback->Mod_getVersion = &skirmishAiCallback_Mod_getVersion;
-	callback->Mod_getMutator = &skirmishAiCallback_Mod_getMutator;
-	callback->Mod_getDescription = &skirmishAiCallback_Mod_getDescription;
-	callback->Mod_getAllowTeamColors = &skirmishAiCallback_Mod_getAllowTeamColors;
-	callback->Mod_getConstructionDecay = &skirmishAiCallback_Mod_getConstructionDecay;
-	callback->Mod_getConstructionDecayTime = &skirmishAiCallback_Mod_getConstructionDecayTime;
-	callback->Mod_getConstructionDecaySpeed = &skirmishAiCallback_Mod_getConstructionDecaySpeed;
-	callback->Mod_getMultiReclaim = &skirmishAiCallback_Mod_getMultiReclaim;
-	callback->Mod_getReclaimMethod = &skirmishAiCallback_Mod_getReclaimMethod;
-	callback->Mod_getReclaimUnitMethod = &skirmishAiCallback_Mod_getReclaimUnitMethod;
-	callback->Mod_getReclaimUnitEnergyCostFactor = &skirmishAiCallback_Mod_getReclaimUnitEnergyCostFactor;
-	callback->Mod_getReclaimUnitEfficiency = &skirmishAiCallback_Mod_getReclaimUnitEfficiency;
-	callback->Mod_getReclaimFeatureEnergyCostFactor = &skirmishAiCallback_Mod_getReclaimFeatureEnergyCostFactor;
-	callback->Mod_getReclaimAllowEnemies = &skirmishAiCallback_Mod_getReclaimAllowEnemies;
-	callback->Mod_getReclaimAllowAllies = &skirmishAiCallback_Mod_getReclaimAllowAllies;
-	callback->Mod_getRepairEnergyCostFactor = &skirmishAiCallback_Mod_getRepairEnergyCostFactor;
-	callback->Mod_getResurrectEnergyCostFactor = &skirmishAiCallback_Mod_getResurrectEnergyCostFactor;
-	callback->Mod_getCaptureEnergyCostFactor = &skirmishAiCallback_Mod_getCaptureEnergyCostFactor;
-	callback->Mod_getTransportGround = &skirmishAiCallback_Mod_getTransportGround;
-	callback->Mod_getTransportHover = &skirmishAiCallback_Mod_getTransportHover;
-	callback->Mod_getTransportShip = &skirmishAiCallback_Mod_getTransportShip;
-	callback->Mod_getTransportAir = &skirmishAiCallback_Mod_getTransportAir;
-	callback->Mod_getFireAtKilled = &skirmishAiCallback_Mod_getFireAtKilled;
-	callback->Mod_getFireAtCrashing = &skirmishAiCallback_Mod_getFireAtCrashing;
-	callback->Mod_getFlankingBonusModeDefault = &skirmishAiCallback_Mod_getFlankingBonusModeDefault;
-	callback->Mod_getLosMipLevel = &skirmishAiCallback_Mod_getLosMipLevel;
-	callback->Mod_getAirMipLevel = &skirmishAiCallback_Mod_getAirMipLevel;
-	callback->Mod_getRadarMipLevel = &skirmishAiCallback_Mod_getRadarMipLevel;
-	callback->Mod_getRequireSonarUnderWater = &skirmishAiCallback_Mod_getRequireSonarUnderWater;
-	callback->Map_getChecksum = &skirmishAiCallback_Map_getChecksum;
-	callback->Map_getStartPos = &skirmishAiCallback_Map_getStartPos;
-	callback->Map_getMousePos = &skirmishAiCallback_Map_getMousePos;
-	callback->Map_isPosInCamera = &skirmishAiCallback_Map_isPosInCamera;
-	callback->Map_getWidth = &skirmishAiCallback_Map_getWidth;
-	callback->Map_getHeight = &skirmishAiCallback_Map_getHeight;
-	callback->Map_getHeightMap = &skirmishAiCallback_Map_getHeightMap;
-	callback->Map_getCornersHeightMap = &skirmishAiCallback_Map_getCornersHeightMap;
-	callback->Map_getMinHeight = &skirmishAiCallback_Map_getMinHeight;
-	callback->Map_getMaxHeight = &skirmishAiCallback_Map_getMaxHeight;
-	callback->Map_getSlopeMap = &skirmishAiCallback_Map_getSlopeMap;
-	callback->Map_getLosMap = &skirmishAiCallback_Map_getLosMap;
-	callback->Map_getAirLosMap = &skirmishAiCallback_Map_getAirLosMap;
-	callback->Map_getRadarMap = &skirmishAiCallback_Map_getRadarMap;
-	callback->Map_getSonarMap = &skirmishAiCallback_Map_getSonarMap;
-	callback->Map_getSeismicMap = &skirmishAiCallback_Map_getSeismicMap;
-	callback->Map_getJammerMap = &skirmishAiCallback_Map_getJammerMap;
-	callback->Map_getSonarJammerMap = &skirmishAiCallback_Map_getSonarJammerMap;
-	callback->Map_getResourceMapRaw = &skirmishAiCallback_Map_getResourceMapRaw;
-	callback->Map_getResourceMapSpotsPositions = &skirmishAiCallback_Map_getResourceMapSpotsPositions;
-	callback->Map_getResourceMapSpotsAverageIncome = &skirmishAiCallback_Map_getResourceMapSpotsAverageIncome;
-	callback->Map_getResourceMapSpotsNearest = &skirmishAiCallback_Map_getResourceMapSpotsNearest;
-	callback->Map_getHash = &skirmishAiCallback_Map_getHash;
-	callback->Map_getName = &skirmishAiCallback_Map_getName;
-	callback->Map_getHumanName = &skirmishAiCallback_Map_getHumanName;
-	callback->Map_getElevationAt = &skirmishAiCallback_Map_getElevationAt;
-	callback->Map_getMaxResource = &skirmishAiCallback_Map_getMaxResource;
-	callback->Map_getExtractorRadius = &skirmishAiCallback_Map_getExtractorRadius;
-	callback->Map_getMinWind = &skirmishAiCallback_Map_getMinWind;
-	callback->Map_getMaxWind = &skirmishAiCallback_Map_getMaxWind;
-	callback->Map_getCurWind = &skirmishAiCallback_Map_getCurWind;
-	callback->Map_getTidalStrength = &skirmishAiCallback_Map_getTidalStrength;
-	callback->Map_getGravity = &skirmishAiCallback_Map_getGravity;
-	callback->Map_getWaterDamage = &skirmishAiCallback_Map_getWaterDamage;
-	callback->Map_isDeformable = &skirmishAiCallback_Map_isDeformable;
-	callback->Map_getHardness = &skirmishAiCallback_Map_getHardness;
-	callback->Map_getHardnessModMap = &skirmishAiCallback_Map_getHardnessModMap;
-	callback->Map_getSpeedModMap = &skirmishAiCallback_Map_getSpeedModMap;
-	callback->Map_getPoints = &skirmishAiCallback_Map_getPoints;
-	callback->Map_Point_getPosition = &skirmishAiCallback_Map_Point_getPosition;
-	callback->Map_Point_getColor = &skirmishAiCallback_Map_Point_getColor;
-	callback->Map_Point_getLabel = &skirmishAiCallback_Map_Point_getLabel;
-	callback->Map_getLines = &skirmishAiCallback_Map_getLines;
-	callback->Map_Line_getFirstPosition = &skirmishAiCallback_Map_Line_getFirstPosition;
-	callback->Map_Line_getSecondPosition = &skirmishAiCallback_Map_Line_getSecondPosition;
-	callback->Map_Line_getColor = &skirmishAiCallback_Map_Line_getColor;
-	callback->Map_isPossibleToBuildAt = &skirmishAiCallback_Map_isPossibleToBuildAt;
-	callback->Map_findClosestBuildSite = &skirmishAiCallback_Map_findClosestBuildSite;
-	callback->getFeatureDefs = &skirmishAiCallback_getFeatureDefs;
-	callback->FeatureDef_getName = &skirmishAiCallback_FeatureDef_getName;
-	callback->FeatureDef_getDescription = &skirmishAiCallback_FeatureDef_getDescription;
-	callback->FeatureDef_getFileName = &skirmishAiCallback_FeatureDef_getFileName;
-	callback->FeatureDef_getContainedResource = &skirmishAiCallback_FeatureDef_getContainedResource;
-	callback->FeatureDef_getMaxHealth = &skirmishAiCallback_FeatureDef_getMaxHealth;
-	callback->FeatureDef_getReclaimTime = &skirmishAiCallback_FeatureDef_getReclaimTime;
-	callback->FeatureDef_getMass = &skirmishAiCallback_FeatureDef_getMass;
-	callback->FeatureDef_isUpright = &skirmishAiCallback_FeatureDef_isUpright;
-	callback->FeatureDef_getDrawType = &skirmishAiCallback_FeatureDef_getDrawType;
-	callback->FeatureDef_getModelName = &skirmishAiCallback_FeatureDef_getModelName;
-	callback->FeatureDef_getResurrectable = &skirmishAiCallback_FeatureDef_getResurrectable;
-	callback->FeatureDef_getSmokeTime = &skirmishAiCallback_FeatureDef_getSmokeTime;
-	callback->FeatureDef_isDestructable = &skirmishAiCallback_FeatureDef_isDestructable;
-	callback->FeatureDef_isReclaimable = &skirmishAiCallback_FeatureDef_isReclaimable;
-	callback->FeatureDef_isBlocking = &skirmishAiCallback_FeatureDef_isBlocking;
-	callback->FeatureDef_isBurnable = &skirmishAiCallback_FeatureDef_isBurnable;
-	callback->FeatureDef_isFloating = &skirmishAiCallback_FeatureDef_isFloating;
-	callback->FeatureDef_isNoSelect = &skirmishAiCallback_FeatureDef_isNoSelect;
-	callback->FeatureDef_isGeoThermal = &skirmishAiCallback_FeatureDef_isGeoThermal;
-	callback->FeatureDef_getDeathFeature = &skirmishAiCallback_FeatureDef_getDeathFeature;
-	callback->FeatureDef_getXSize = &skirmishAiCallback_FeatureDef_getXSize;
-	callback->FeatureDef_getZSize = &skirmishAiCallback_FeatureDef_getZSize;
-	callback->FeatureDef_getCustomParams = &skirmishAiCallback_FeatureDef_getCustomParams;
-	callback->getFeatures = &skirmishAiCallback_getFeatures;
-	callback->getFeaturesIn = &skirmishAiCallback_getFeaturesIn;
-	callback->Feature_getDef = &skirmishAiCallback_Feature_getDef;
-	callback->Feature_getHealth = &skirmishAiCallback_Feature_getHealth;
-	callback->Feature_getReclaimLeft = &skirmishAiCallback_Feature_getReclaimLeft;
-	callback->Feature_getPosition = &skirmishAiCallback_Feature_getPosition;
-	callback->Feature_getRulesParamFloat = &skirmishAiCallback_Feature_getRulesParamFloat;
-	callback->Feature_getRulesParamString = &skirmishAiCallback_Feature_getRulesParamString;
-	callback->getWeaponDefs = &skirmishAiCallback_getWeaponDefs;
-	callback->getWeaponDefByName = &skirmishAiCallback_getWeaponDefByName;
-	callback->WeaponDef_getName = &skirmishAiCallback_WeaponDef_getName;
-	callback->WeaponDef_getType = &skirmishAiCallback_WeaponDef_getType;
-	callback->WeaponDef_getDescription = &skirmishAiCallback_WeaponDef_getDescription;
-	callback->WeaponDef_getFileName = &skirmishAiCallback_WeaponDef_getFileName;
-	callback->WeaponDef_getCegTag = &skirmishAiCallback_WeaponDef_getCegTag;
-	callback->WeaponDef_getRange = &skirmishAiCallback_WeaponDef_getRange;
-	callback->WeaponDef_getHeightMod = &skirmishAiCallback_WeaponDef_getHeightMod;
-	callback->WeaponDef_getAccuracy = &skirmishAiCallback_WeaponDef_getAccuracy;
-	callback->WeaponDef_getSprayAngle = &skirmishAiCallback_WeaponDef_getSprayAngle;
-	callback->WeaponDef_getMovingAccuracy = &skirmishAiCallback_WeaponDef_getMovingAccuracy;
-	callback->WeaponDef_getTargetMoveError = &skirmishAiCallback_WeaponDef_getTargetMoveError;
-	callback->WeaponDef_getLeadLimit = &skirmishAiCallback_WeaponDef_getLeadLimit;
-	callback->WeaponDef_getLeadBonus = &skirmishAiCallback_WeaponDef_getLeadBonus;
-	callback->WeaponDef_getPredictBoost = &skirmishAiCallback_WeaponDef_getPredictBoost;
-	callback->WeaponDef_getNumDamageTypes = &skirmishAiCallback_WeaponDef_getNumDamageTypes;
-	callback->WeaponDef_Damage_getParalyzeDamageTime = &skirmishAiCallback_WeaponDef_Damage_getParalyzeDamageTime;
-	callback->WeaponDef_Damage_getImpulseFactor = &skirmishAiCallback_WeaponDef_Damage_getImpulseFactor;
-	callback->WeaponDef_Damage_getImpulseBoost = &skirmishAiCallback_WeaponDef_Damage_getImpulseBoost;
-	callback->WeaponDef_Damage_getCraterMult = &skirmishAiCallback_WeaponDef_Damage_getCraterMult;
-	callback->WeaponDef_Damage_getCraterBoost = &skirmishAiCallback_WeaponDef_Damage_getCraterBoost;
-	callback->WeaponDef_Damage_getTypes = &skirmishAiCallback_WeaponDef_Damage_getTypes;
-	callback->WeaponDef_getAreaOfEffect = &skirmishAiCallback_WeaponDef_getAreaOfEffect;
-	callback->WeaponDef_isNoSelfDamage = &skirmishAiCallback_WeaponDef_isNoSelfDamage;
-	callback->WeaponDef_getFireStarter = &skirmishAiCallback_WeaponDef_getFireStarter;
-	callback->WeaponDef_getEdgeEffectiveness = &skirmishAiCallback_WeaponDef_getEdgeEffectiveness;
-	callback->WeaponDef_getSize = &skirmishAiCallback_WeaponDef_getSize;
-	callback->WeaponDef_getSizeGrowth = &skirmishAiCallback_WeaponDef_getSizeGrowth;
-	callback->WeaponDef_getCollisionSize = &skirmishAiCallback_WeaponDef_getCollisionSize;
-	callback->WeaponDef_getSalvoSize = &skirmishAiCallback_WeaponDef_getSalvoSize;
-	callback->WeaponDef_getSalvoDelay = &skirmishAiCallback_WeaponDef_getSalvoDelay;
-	callback->WeaponDef_getReload = &skirmishAiCallback_WeaponDef_getReload;
-	callback->WeaponDef_getBeamTime = &skirmishAiCallback_WeaponDef_getBeamTime;
-	callback->WeaponDef_isBeamBurst = &skirmishAiCallback_WeaponDef_isBeamBurst;
-	callback->WeaponDef_isWaterBounce = &skirmishAiCallback_WeaponDef_isWaterBounce;
-	callback->WeaponDef_isGroundBounce = &skirmishAiCallback_WeaponDef_isGroundBounce;
-	callback->WeaponDef_getBounceRebound = &skirmishAiCallback_WeaponDef_getBounceRebound;
-	callback->WeaponDef_getBounceSlip = &skirmishAiCallback_WeaponDef_getBounceSlip;
-	callback->WeaponDef_getNumBounce = &skirmishAiCallback_WeaponDef_getNumBounce;
-	callback->WeaponDef_getMaxAngle = &skirmishAiCallback_WeaponDef_getMaxAngle;
-	callback->WeaponDef_getUpTime = &skirmishAiCallback_WeaponDef_getUpTime;
-	callback->WeaponDef_getFlightTime = &skirmishAiCallback_WeaponDef_getFlightTime;
-	callback->WeaponDef_getCost = &skirmishAiCallback_WeaponDef_getCost;
-	callback->WeaponDef_getProjectilesPerShot = &skirmishAiCallback_WeaponDef_getProjectilesPerShot;
-	callback->WeaponDef_isTurret = &skirmishAiCallback_WeaponDef_isTurret;
-	callback->WeaponDef_isOnlyForward = &skirmishAiCallback_WeaponDef_isOnlyForward;
-	callback->WeaponDef_isFixedLauncher = &skirmishAiCallback_WeaponDef_isFixedLauncher;
-	callback->WeaponDef_isWaterWeapon = &skirmishAiCallback_WeaponDef_isWaterWeapon;
-	callback->WeaponDef_isFireSubmersed = &skirmishAiCallback_WeaponDef_isFireSubmersed;
-	callback->WeaponDef_isSubMissile = &skirmishAiCallback_WeaponDef_isSubMissile;
-	callback->WeaponDef_isTracks = &skirmishAiCallback_WeaponDef_isTracks;
-	callback->WeaponDef_isDropped = &skirmishAiCallback_WeaponDef_isDropped;
-	callback->WeaponDef_isParalyzer = &skirmishAiCallback_WeaponDef_isParalyzer;
-	callback->WeaponDef_isImpactOnly = &skirmishAiCallback_WeaponDef_isImpactOnly;
-	callback->WeaponDef_isNoAutoTarget = &skirmishAiCallback_WeaponDef_isNoAutoTarget;
-	callback->WeaponDef_isManualFire = &skirmishAiCallback_WeaponDef_isManualFire;
-	callback->WeaponDef_getInterceptor = &skirmishAiCallback_WeaponDef_getInterceptor;
-	callback->WeaponDef_getTargetable = &skirmishAiCallback_WeaponDef_getTargetable;
-	callback->WeaponDef_isStockpileable = &skirmishAiCallback_WeaponDef_isStockpileable;
-	callback->WeaponDef_getCoverageRange = &skirmishAiCallback_WeaponDef_getCoverageRange;
-	callback->WeaponDef_getStockpileTime = &skirmishAiCallback_WeaponDef_getStockpileTime;
-	callback->WeaponDef_getIntensity = &skirmishAiCallback_WeaponDef_getIntensity;
-	callback->WeaponDef_getThickness = &skirmishAiCallback_WeaponDef_getThickness;
-	callback->WeaponDef_getLaserFlareSize = &skirmishAiCallback_WeaponDef_getLaserFlareSize;
-	callback->WeaponDef_getCoreThickness = &skirmishAiCallback_WeaponDef_getCoreThickness;
-	callback->WeaponDef_getDuration = &skirmishAiCallback_WeaponDef_getDuration;
-	callback->WeaponDef_getLodDistance = &skirmishAiCallback_WeaponDef_getLodDistance;
-	callback->WeaponDef_getFalloffRate = &skirmishAiCallback_WeaponDef_getFalloffRate;
-	callback->WeaponDef_getGraphicsType = &skirmishAiCallback_WeaponDef_getGraphicsType;
-	callback->WeaponDef_isSoundTrigger = &skirmishAiCallback_WeaponDef_isSoundTrigger;
-	callback->WeaponDef_isSelfExplode = &skirmishAiCallback_WeaponDef_isSelfExplode;
-	callback->WeaponDef_isGravityAffected = &skirmishAiCallback_WeaponDef_isGravityAffected;
-	callback->WeaponDef_getHighTrajectory = &skirmishAiCallback_WeaponDef_getHighTrajectory;
-	callback->WeaponDef_getMyGravity = &skirmishAiCallback_WeaponDef_getMyGravity;
-	callback->WeaponDef_isNoExplode = &skirmishAiCallback_WeaponDef_isNoExplode;
-	callback->WeaponDef_getStartVelocity = &skirmishAiCallback_WeaponDef_getStartVelocity;
-	callback->WeaponDef_getWeaponAcceleration = &skirmishAiCallback_WeaponDef_getWeaponAcceleration;
-	callback->WeaponDef_getTurnRate = &skirmishAiCallback_WeaponDef_getTurnRate;
-	callback->WeaponDef_getMaxVelocity = &skirmishAiCallback_WeaponDef_getMaxVelocity;
-	callback->WeaponDef_getProjectileSpeed = &skirmishAiCallback_WeaponDef_getProjectileSpeed;
-	callback->WeaponDef_getExplosionSpeed = &skirmishAiCallback_WeaponDef_getExplosionSpeed;
-	callback->WeaponDef_getOnlyTargetCategory = &skirmishAiCallback_WeaponDef_getOnlyTargetCategory;
-	callback->WeaponDef_getWobble = &skirmishAiCallback_WeaponDef_getWobble;
-	callback->WeaponDef_getDance = &skirmishAiCallback_WeaponDef_getDance;
-	callback->WeaponDef_getTrajectoryHeight = &skirmishAiCallback_WeaponDef_getTrajectoryHeight;
-	callback->WeaponDef_isLargeBeamLaser = &skirmishAiCallback_WeaponDef_isLargeBeamLaser;
-	callback->WeaponDef_isShield = &skirmishAiCallback_WeaponDef_isShield;
-	callback->WeaponDef_isShieldRepulser = &skirmishAiCallback_WeaponDef_isShieldRepulser;
-	callback->WeaponDef_isSmartShield = &skirmishAiCallback_WeaponDef_isSmartShield;
-	callback->WeaponDef_isExteriorShield = &skirmishAiCallback_WeaponDef_isExteriorShield;
-	callback->WeaponDef_isVisibleShield = &skirmishAiCallback_WeaponDef_isVisibleShield;
-	callback->WeaponDef_isVisibleShieldRepulse = &skirmishAiCallback_WeaponDef_isVisibleShieldRepulse;
-	callback->WeaponDef_getVisibleShieldHitFrames = &skirmishAiCallback_WeaponDef_getVisibleShieldHitFrames;
-	callback->WeaponDef_Shield_getResourceUse = &skirmishAiCallback_WeaponDef_Shield_getResourceUse;
-	callback->WeaponDef_Shield_getRadius = &skirmishAiCallback_WeaponDef_Shield_getRadius;
-	callback->WeaponDef_Shield_getForce = &skirmishAiCallback_WeaponDef_Shield_getForce;
-	callback->WeaponDef_Shield_getMaxSpeed = &skirmishAiCallback_WeaponDef_Shield_getMaxSpeed;
-	callback->WeaponDef_Shield_getPower = &skirmishAiCallback_WeaponDef_Shield_getPower;
-	callback->WeaponDef_Shield_getPowerRegen = &skirmishAiCallback_WeaponDef_Shield_getPowerRegen;
-	callback->WeaponDef_Shield_getPowerRegenResource = &skirmishAiCallback_WeaponDef_Shield_getPowerRegenResource;
-	callback->WeaponDef_Shield_getStartingPower = &skirmishAiCallback_WeaponDef_Shield_getStartingPower;
-	callback->WeaponDef_Shield_getRechargeDelay = &skirmishAiCallback_WeaponDef_Shield_getRechargeDelay;
-	callback->WeaponDef_Shield_getGoodColor = &skirmishAiCallback_WeaponDef_Shield_getGoodColor;
-	callback->WeaponDef_Shield_getBadColor = &skirmishAiCallback_WeaponDef_Shield_getBadColor;
-	callback->WeaponDef_Shield_getAlpha = &skirmishAiCallback_WeaponDef_Shield_getAlpha;
-	callback->WeaponDef_Shield_getInterceptType = &skirmishAiCallback_WeaponDef_Shield_getInterceptType;
-	callback->WeaponDef_getInterceptedByShieldType = &skirmishAiCallback_WeaponDef_getInterceptedByShieldType;
-	callback->WeaponDef_isAvoidFriendly = &skirmishAiCallback_WeaponDef_isAvoidFriendly;
-	callback->WeaponDef_isAvoidFeature = &skirmishAiCallback_WeaponDef_isAvoidFeature;
-	callback->WeaponDef_isAvoidNeutral = &skirmishAiCallback_WeaponDef_isAvoidNeutral;
-	callback->WeaponDef_getTargetBorder = &skirmishAiCallback_WeaponDef_getTargetBorder;
-	callback->WeaponDef_getCylinderTargetting = &skirmishAiCallback_WeaponDef_getCylinderTargetting;
-	callback->WeaponDef_getMinIntensity = &skirmishAiCallback_WeaponDef_getMinIntensity;
-	callback->WeaponDef_getHeightBoostFactor = &skirmishAiCallback_WeaponDef_getHeightBoostFactor;
-	callback->WeaponDef_getProximityPriority = &skirmishAiCallback_WeaponDef_getProximityPriority;
-	callback->WeaponDef_getCollisionFlags = &skirmishAiCallback_WeaponDef_getCollisionFlags;
-	callback->WeaponDef_isSweepFire = &skirmishAiCallback_WeaponDef_isSweepFire;
-	callback->WeaponDef_isAbleToAttackGround = &skirmishAiCallback_WeaponDef_isAbleToAttackGround;
-	callback->WeaponDef_getCameraShake = &skirmishAiCallback_WeaponDef_getCameraShake;
-	callback->WeaponDef_getDynDamageExp = &skirmishAiCallback_WeaponDef_getDynDamageExp;
-	callback->WeaponDef_getDynDamageMin = &skirmishAiCallback_WeaponDef_getDynDamageMin;
-	callback->WeaponDef_getDynDamageRange = &skirmishAiCallback_WeaponDef_getDynDamageRange;
-	callback->WeaponDef_isDynDamageInverted = &skirmishAiCallback_WeaponDef_isDynDamageInverted;
-	callback->WeaponDef_getCustomParams = &skirmishAiCallback_WeaponDef_getCustomParams;
-	callback->Unit_Weapon_getDef = &skirmishAiCallback_Unit_Weapon_getDef;
-	callback->Unit_Weapon_getReloadFrame = &skirmishAiCallback_Unit_Weapon_getReloadFrame;
-	callback->Unit_Weapon_getReloadTime = &skirmishAiCallback_Unit_Weapon_getReloadTime;
-	callback->Unit_Weapon_getRange = &skirmishAiCallback_Unit_Weapon_getRange;
-	callback->Unit_Weapon_isShieldEnabled = &skirmishAiCallback_Unit_Weapon_isShieldEnabled;
-	callback->Unit_Weapon_getShieldPower = &skirmishAiCallback_Unit_Weapon_getShieldPower;
-	callback->Debug_GraphDrawer_isEnabled = &skirmishAiCallback_Debug_GraphDrawer_isEnabled;
+	callback->Engine_handleCommand = AI_CALLBACK(skirmishAiCallback_Engine_handleCommand);
+	callback->Engine_executeCommand = AI_CALLBACK(skirmishAiCallback_Engine_executeCommand);
+
+	callback->Engine_Version_getMajor = AI_CALLBACK(skirmishAiCallback_Engine_Version_getMajor);
+	callback->Engine_Version_getMinor = AI_CALLBACK(skirmishAiCallback_Engine_Version_getMinor);
+	callback->Engine_Version_getPatchset = AI_CALLBACK(skirmishAiCallback_Engine_Version_getPatchset);
+	callback->Engine_Version_getCommits = AI_CALLBACK(skirmishAiCallback_Engine_Version_getCommits);
+	callback->Engine_Version_getHash = AI_CALLBACK(skirmishAiCallback_Engine_Version_getHash);
+	callback->Engine_Version_getBranch = AI_CALLBACK(skirmishAiCallback_Engine_Version_getBranch);
+	callback->Engine_Version_getAdditional = AI_CALLBACK(skirmishAiCallback_Engine_Version_getAdditional);
+	callback->Engine_Version_getBuildTime = AI_CALLBACK(skirmishAiCallback_Engine_Version_getBuildTime);
+	callback->Engine_Version_isRelease = AI_CALLBACK(skirmishAiCallback_Engine_Version_isRelease);
+	callback->Engine_Version_getNormal = AI_CALLBACK(skirmishAiCallback_Engine_Version_getNormal);
+	callback->Engine_Version_getSync = AI_CALLBACK(skirmishAiCallback_Engine_Version_getSync);
+	callback->Engine_Version_getFull = AI_CALLBACK(skirmishAiCallback_Engine_Version_getFull);
+	callback->Teams_getSize = AI_CALLBACK(skirmishAiCallback_Teams_getSize);
+	callback->SkirmishAIs_getSize = AI_CALLBACK(skirmishAiCallback_SkirmishAIs_getSize);
+	callback->SkirmishAIs_getMax = AI_CALLBACK(skirmishAiCallback_SkirmishAIs_getMax);
+	callback->SkirmishAI_getTeamId = AI_CALLBACK(skirmishAiCallback_SkirmishAI_getTeamId);
+	callback->SkirmishAI_Info_getSize = AI_CALLBACK(skirmishAiCallback_SkirmishAI_Info_getSize);
+	callback->SkirmishAI_Info_getKey = AI_CALLBACK(skirmishAiCallback_SkirmishAI_Info_getKey);
+	callback->SkirmishAI_Info_getValue = AI_CALLBACK(skirmishAiCallback_SkirmishAI_Info_getValue);
+	callback->SkirmishAI_Info_getDescription = AI_CALLBACK(skirmishAiCallback_SkirmishAI_Info_getDescription);
+	callback->SkirmishAI_Info_getValueByKey = AI_CALLBACK(skirmishAiCallback_SkirmishAI_Info_getValueByKey);
+	callback->SkirmishAI_OptionValues_getSize = AI_CALLBACK(skirmishAiCallback_SkirmishAI_OptionValues_getSize);
+	callback->SkirmishAI_OptionValues_getKey = AI_CALLBACK(skirmishAiCallback_SkirmishAI_OptionValues_getKey);
+	callback->SkirmishAI_OptionValues_getValue = AI_CALLBACK(skirmishAiCallback_SkirmishAI_OptionValues_getValue);
+	callback->SkirmishAI_OptionValues_getValueByKey = AI_CALLBACK(skirmishAiCallback_SkirmishAI_OptionValues_getValueByKey);
+	callback->Log_log = AI_CALLBACK(skirmishAiCallback_Log_log);
+	callback->Log_exception = AI_CALLBACK(skirmishAiCallback_Log_exception);
+	callback->DataDirs_getPathSeparator = AI_CALLBACK(skirmishAiCallback_DataDirs_getPathSeparator);
+	callback->DataDirs_getConfigDir = AI_CALLBACK(skirmishAiCallback_DataDirs_getConfigDir);
+	callback->DataDirs_getWriteableDir = AI_CALLBACK(skirmishAiCallback_DataDirs_getWriteableDir);
+	callback->DataDirs_locatePath = AI_CALLBACK(skirmishAiCallback_DataDirs_locatePath);
+	callback->DataDirs_allocatePath = AI_CALLBACK(skirmishAiCallback_DataDirs_allocatePath);
+	callback->DataDirs_Roots_getSize = AI_CALLBACK(skirmishAiCallback_DataDirs_Roots_getSize);
+	callback->DataDirs_Roots_getDir = AI_CALLBACK(skirmishAiCallback_DataDirs_Roots_getDir);
+	callback->DataDirs_Roots_locatePath = AI_CALLBACK(skirmishAiCallback_DataDirs_Roots_locatePath);
+	callback->DataDirs_Roots_allocatePath = AI_CALLBACK(skirmishAiCallback_DataDirs_Roots_allocatePath);
+	callback->Game_getCurrentFrame = AI_CALLBACK(skirmishAiCallback_Game_getCurrentFrame);
+	callback->Game_getAiInterfaceVersion = AI_CALLBACK(skirmishAiCallback_Game_getAiInterfaceVersion);
+	callback->Game_getMyTeam = AI_CALLBACK(skirmishAiCallback_Game_getMyTeam);
+	callback->Game_getMyAllyTeam = AI_CALLBACK(skirmishAiCallback_Game_getMyAllyTeam);
+	callback->Game_getPlayerTeam = AI_CALLBACK(skirmishAiCallback_Game_getPlayerTeam);
+	callback->Game_getTeams = AI_CALLBACK(skirmishAiCallback_Game_getTeams);
+	callback->Game_getTeamSide = AI_CALLBACK(skirmishAiCallback_Game_getTeamSide);
+	callback->Game_getTeamColor = AI_CALLBACK(skirmishAiCallback_Game_getTeamColor);
+	callback->Game_getTeamIncomeMultiplier = AI_CALLBACK(skirmishAiCallback_Game_getTeamIncomeMultiplier);
+	callback->Game_getTeamAllyTeam = AI_CALLBACK(skirmishAiCallback_Game_getTeamAllyTeam);
+	callback->Game_getTeamResourceCurrent = AI_CALLBACK(skirmishAiCallback_Game_getTeamResourceCurrent);
+	callback->Game_getTeamResourceIncome = AI_CALLBACK(skirmishAiCallback_Game_getTeamResourceIncome);
+	callback->Game_getTeamResourceUsage = AI_CALLBACK(skirmishAiCallback_Game_getTeamResourceUsage);
+	callback->Game_getTeamResourceStorage = AI_CALLBACK(skirmishAiCallback_Game_getTeamResourceStorage);
+	callback->Game_getTeamResourcePull = AI_CALLBACK(skirmishAiCallback_Game_getTeamResourcePull);
+	callback->Game_getTeamResourceShare = AI_CALLBACK(skirmishAiCallback_Game_getTeamResourceShare);
+	callback->Game_getTeamResourceSent = AI_CALLBACK(skirmishAiCallback_Game_getTeamResourceSent);
+	callback->Game_getTeamResourceReceived = AI_CALLBACK(skirmishAiCallback_Game_getTeamResourceReceived);
+	callback->Game_getTeamResourceExcess = AI_CALLBACK(skirmishAiCallback_Game_getTeamResourceExcess);
+	callback->Game_isAllied = AI_CALLBACK(skirmishAiCallback_Game_isAllied);
+	callback->Game_isDebugModeEnabled = AI_CALLBACK(skirmishAiCallback_Game_isDebugModeEnabled);
+	callback->Game_isPaused = AI_CALLBACK(skirmishAiCallback_Game_isPaused);
+	callback->Game_getSpeedFactor = AI_CALLBACK(skirmishAiCallback_Game_getSpeedFactor);
+	callback->Game_getSetupScript = AI_CALLBACK(skirmishAiCallback_Game_getSetupScript);
+	callback->Game_getCategoryFlag = AI_CALLBACK(skirmishAiCallback_Game_getCategoryFlag);
+	callback->Game_getCategoriesFlag = AI_CALLBACK(skirmishAiCallback_Game_getCategoriesFlag);
+	callback->Game_getCategoryName = AI_CALLBACK(skirmishAiCallback_Game_getCategoryName);
+	callback->Game_getRulesParamFloat = AI_CALLBACK(skirmishAiCallback_Game_getRulesParamFloat);
+	callback->Game_getRulesParamString = AI_CALLBACK(skirmishAiCallback_Game_getRulesParamString);
+	callback->Gui_getViewRange = AI_CALLBACK(skirmishAiCallback_Gui_getViewRange);
+	callback->Gui_getScreenX = AI_CALLBACK(skirmishAiCallback_Gui_getScreenX);
+	callback->Gui_getScreenY = AI_CALLBACK(skirmishAiCallback_Gui_getScreenY);
+	callback->Gui_Camera_getDirection = AI_CALLBACK(skirmishAiCallback_Gui_Camera_getDirection);
+	callback->Gui_Camera_getPosition = AI_CALLBACK(skirmishAiCallback_Gui_Camera_getPosition);
+	callback->Cheats_isEnabled = AI_CALLBACK(skirmishAiCallback_Cheats_isEnabled);
+	callback->Cheats_setEnabled = AI_CALLBACK(skirmishAiCallback_Cheats_setEnabled);
+	callback->Cheats_setEventsEnabled = AI_CALLBACK(skirmishAiCallback_Cheats_setEventsEnabled);
+	callback->Cheats_isOnlyPassive = AI_CALLBACK(skirmishAiCallback_Cheats_isOnlyPassive);
+	callback->getResources = AI_CALLBACK(skirmishAiCallback_getResources);
+	callback->getResourceByName = AI_CALLBACK(skirmishAiCallback_getResourceByName);
+	callback->Resource_getName = AI_CALLBACK(skirmishAiCallback_Resource_getName);
+	callback->Resource_getOptimum = AI_CALLBACK(skirmishAiCallback_Resource_getOptimum);
+	callback->Economy_getCurrent = AI_CALLBACK(skirmishAiCallback_Economy_getCurrent);
+	callback->Economy_getIncome = AI_CALLBACK(skirmishAiCallback_Economy_getIncome);
+	callback->Economy_getUsage = AI_CALLBACK(skirmishAiCallback_Economy_getUsage);
+	callback->Economy_getStorage = AI_CALLBACK(skirmishAiCallback_Economy_getStorage);
+	callback->Economy_getPull = AI_CALLBACK(skirmishAiCallback_Economy_getPull);
+	callback->Economy_getShare = AI_CALLBACK(skirmishAiCallback_Economy_getShare);
+	callback->Economy_getSent = AI_CALLBACK(skirmishAiCallback_Economy_getSent);
+	callback->Economy_getReceived = AI_CALLBACK(skirmishAiCallback_Economy_getReceived);
+	callback->Economy_getExcess = AI_CALLBACK(skirmishAiCallback_Economy_getExcess);
+	callback->File_getSize = AI_CALLBACK(skirmishAiCallback_File_getSize);
+	callback->File_getContent = AI_CALLBACK(skirmishAiCallback_File_getContent);
+	callback->getUnitDefs = AI_CALLBACK(skirmishAiCallback_getUnitDefs);
+	callback->getUnitDefByName = AI_CALLBACK(skirmishAiCallback_getUnitDefByName);
+	callback->UnitDef_getHeight = AI_CALLBACK(skirmishAiCallback_UnitDef_getHeight);
+	callback->UnitDef_getRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getRadius);
+	callback->UnitDef_getName = AI_CALLBACK(skirmishAiCallback_UnitDef_getName);
+	callback->UnitDef_getHumanName = AI_CALLBACK(skirmishAiCallback_UnitDef_getHumanName);
+	callback->UnitDef_getFileName = AI_CALLBACK(skirmishAiCallback_UnitDef_getFileName);
+	callback->UnitDef_getAiHint = AI_CALLBACK(skirmishAiCallback_UnitDef_getAiHint);
+	callback->UnitDef_getCobId = AI_CALLBACK(skirmishAiCallback_UnitDef_getCobId);
+	callback->UnitDef_getTechLevel = AI_CALLBACK(skirmishAiCallback_UnitDef_getTechLevel);
+	callback->UnitDef_getGaia = AI_CALLBACK(skirmishAiCallback_UnitDef_getGaia);
+	callback->UnitDef_getUpkeep = AI_CALLBACK(skirmishAiCallback_UnitDef_getUpkeep);
+	callback->UnitDef_getResourceMake = AI_CALLBACK(skirmishAiCallback_UnitDef_getResourceMake);
+	callback->UnitDef_getMakesResource = AI_CALLBACK(skirmishAiCallback_UnitDef_getMakesResource);
+	callback->UnitDef_getCost = AI_CALLBACK(skirmishAiCallback_UnitDef_getCost);
+	callback->UnitDef_getExtractsResource = AI_CALLBACK(skirmishAiCallback_UnitDef_getExtractsResource);
+	callback->UnitDef_getResourceExtractorRange = AI_CALLBACK(skirmishAiCallback_UnitDef_getResourceExtractorRange);
+	callback->UnitDef_getWindResourceGenerator = AI_CALLBACK(skirmishAiCallback_UnitDef_getWindResourceGenerator);
+	callback->UnitDef_getTidalResourceGenerator = AI_CALLBACK(skirmishAiCallback_UnitDef_getTidalResourceGenerator);
+	callback->UnitDef_getStorage = AI_CALLBACK(skirmishAiCallback_UnitDef_getStorage);
+	callback->UnitDef_isSquareResourceExtractor = AI_CALLBACK(skirmishAiCallback_UnitDef_isSquareResourceExtractor);
+	callback->UnitDef_getBuildTime = AI_CALLBACK(skirmishAiCallback_UnitDef_getBuildTime);
+	callback->UnitDef_getAutoHeal = AI_CALLBACK(skirmishAiCallback_UnitDef_getAutoHeal);
+	callback->UnitDef_getIdleAutoHeal = AI_CALLBACK(skirmishAiCallback_UnitDef_getIdleAutoHeal);
+	callback->UnitDef_getIdleTime = AI_CALLBACK(skirmishAiCallback_UnitDef_getIdleTime);
+	callback->UnitDef_getPower = AI_CALLBACK(skirmishAiCallback_UnitDef_getPower);
+	callback->UnitDef_getHealth = AI_CALLBACK(skirmishAiCallback_UnitDef_getHealth);
+	callback->UnitDef_getCategory = AI_CALLBACK(skirmishAiCallback_UnitDef_getCategory);
+	callback->UnitDef_getSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getSpeed);
+	callback->UnitDef_getTurnRate = AI_CALLBACK(skirmishAiCallback_UnitDef_getTurnRate);
+	callback->UnitDef_isTurnInPlace = AI_CALLBACK(skirmishAiCallback_UnitDef_isTurnInPlace);
+	callback->UnitDef_getTurnInPlaceDistance = AI_CALLBACK(skirmishAiCallback_UnitDef_getTurnInPlaceDistance);
+	callback->UnitDef_getTurnInPlaceSpeedLimit = AI_CALLBACK(skirmishAiCallback_UnitDef_getTurnInPlaceSpeedLimit);
+	callback->UnitDef_isUpright = AI_CALLBACK(skirmishAiCallback_UnitDef_isUpright);
+	callback->UnitDef_isCollide = AI_CALLBACK(skirmishAiCallback_UnitDef_isCollide);
+	callback->UnitDef_getLosRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getLosRadius);
+	callback->UnitDef_getAirLosRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getAirLosRadius);
+	callback->UnitDef_getLosHeight = AI_CALLBACK(skirmishAiCallback_UnitDef_getLosHeight);
+	callback->UnitDef_getRadarRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getRadarRadius);
+	callback->UnitDef_getSonarRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getSonarRadius);
+	callback->UnitDef_getJammerRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getJammerRadius);
+	callback->UnitDef_getSonarJamRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getSonarJamRadius);
+	callback->UnitDef_getSeismicRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getSeismicRadius);
+	callback->UnitDef_getSeismicSignature = AI_CALLBACK(skirmishAiCallback_UnitDef_getSeismicSignature);
+	callback->UnitDef_isStealth = AI_CALLBACK(skirmishAiCallback_UnitDef_isStealth);
+	callback->UnitDef_isSonarStealth = AI_CALLBACK(skirmishAiCallback_UnitDef_isSonarStealth);
+	callback->UnitDef_isBuildRange3D = AI_CALLBACK(skirmishAiCallback_UnitDef_isBuildRange3D);
+	callback->UnitDef_getBuildDistance = AI_CALLBACK(skirmishAiCallback_UnitDef_getBuildDistance);
+	callback->UnitDef_getBuildSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getBuildSpeed);
+	callback->UnitDef_getReclaimSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getReclaimSpeed);
+	callback->UnitDef_getRepairSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getRepairSpeed);
+	callback->UnitDef_getMaxRepairSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxRepairSpeed);
+	callback->UnitDef_getResurrectSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getResurrectSpeed);
+	callback->UnitDef_getCaptureSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getCaptureSpeed);
+	callback->UnitDef_getTerraformSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getTerraformSpeed);
+	callback->UnitDef_getMass = AI_CALLBACK(skirmishAiCallback_UnitDef_getMass);
+	callback->UnitDef_isPushResistant = AI_CALLBACK(skirmishAiCallback_UnitDef_isPushResistant);
+	callback->UnitDef_isStrafeToAttack = AI_CALLBACK(skirmishAiCallback_UnitDef_isStrafeToAttack);
+	callback->UnitDef_getMinCollisionSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getMinCollisionSpeed);
+	callback->UnitDef_getSlideTolerance = AI_CALLBACK(skirmishAiCallback_UnitDef_getSlideTolerance);
+	callback->UnitDef_getMaxSlope = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxSlope);
+	callback->UnitDef_getMaxHeightDif = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxHeightDif);
+	callback->UnitDef_getMinWaterDepth = AI_CALLBACK(skirmishAiCallback_UnitDef_getMinWaterDepth);
+	callback->UnitDef_getWaterline = AI_CALLBACK(skirmishAiCallback_UnitDef_getWaterline);
+	callback->UnitDef_getMaxWaterDepth = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxWaterDepth);
+	callback->UnitDef_getArmoredMultiple = AI_CALLBACK(skirmishAiCallback_UnitDef_getArmoredMultiple);
+	callback->UnitDef_getArmorType = AI_CALLBACK(skirmishAiCallback_UnitDef_getArmorType);
+	callback->UnitDef_FlankingBonus_getMode = AI_CALLBACK(skirmishAiCallback_UnitDef_FlankingBonus_getMode);
+	callback->UnitDef_FlankingBonus_getDir = AI_CALLBACK(skirmishAiCallback_UnitDef_FlankingBonus_getDir);
+	callback->UnitDef_FlankingBonus_getMax = AI_CALLBACK(skirmishAiCallback_UnitDef_FlankingBonus_getMax);
+	callback->UnitDef_FlankingBonus_getMin = AI_CALLBACK(skirmishAiCallback_UnitDef_FlankingBonus_getMin);
+	callback->UnitDef_FlankingBonus_getMobilityAdd = AI_CALLBACK(skirmishAiCallback_UnitDef_FlankingBonus_getMobilityAdd);
+	callback->UnitDef_getMaxWeaponRange = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxWeaponRange);
+	callback->UnitDef_getType = AI_CALLBACK(skirmishAiCallback_UnitDef_getType);
+	callback->UnitDef_getTooltip = AI_CALLBACK(skirmishAiCallback_UnitDef_getTooltip);
+	callback->UnitDef_getWreckName = AI_CALLBACK(skirmishAiCallback_UnitDef_getWreckName);
+	callback->UnitDef_getDeathExplosion = AI_CALLBACK(skirmishAiCallback_UnitDef_getDeathExplosion);
+	callback->UnitDef_getSelfDExplosion = AI_CALLBACK(skirmishAiCallback_UnitDef_getSelfDExplosion);
+	callback->UnitDef_getCategoryString = AI_CALLBACK(skirmishAiCallback_UnitDef_getCategoryString);
+	callback->UnitDef_isAbleToSelfD = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToSelfD);
+	callback->UnitDef_getSelfDCountdown = AI_CALLBACK(skirmishAiCallback_UnitDef_getSelfDCountdown);
+	callback->UnitDef_isAbleToSubmerge = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToSubmerge);
+	callback->UnitDef_isAbleToFly = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToFly);
+	callback->UnitDef_isAbleToMove = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToMove);
+	callback->UnitDef_isAbleToHover = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToHover);
+	callback->UnitDef_isFloater = AI_CALLBACK(skirmishAiCallback_UnitDef_isFloater);
+	callback->UnitDef_isBuilder = AI_CALLBACK(skirmishAiCallback_UnitDef_isBuilder);
+	callback->UnitDef_isActivateWhenBuilt = AI_CALLBACK(skirmishAiCallback_UnitDef_isActivateWhenBuilt);
+	callback->UnitDef_isOnOffable = AI_CALLBACK(skirmishAiCallback_UnitDef_isOnOffable);
+	callback->UnitDef_isFullHealthFactory = AI_CALLBACK(skirmishAiCallback_UnitDef_isFullHealthFactory);
+	callback->UnitDef_isFactoryHeadingTakeoff = AI_CALLBACK(skirmishAiCallback_UnitDef_isFactoryHeadingTakeoff);
+	callback->UnitDef_isReclaimable = AI_CALLBACK(skirmishAiCallback_UnitDef_isReclaimable);
+	callback->UnitDef_isCapturable = AI_CALLBACK(skirmishAiCallback_UnitDef_isCapturable);
+	callback->UnitDef_isAbleToRestore = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToRestore);
+	callback->UnitDef_isAbleToRepair = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToRepair);
+	callback->UnitDef_isAbleToSelfRepair = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToSelfRepair);
+	callback->UnitDef_isAbleToReclaim = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToReclaim);
+	callback->UnitDef_isAbleToAttack = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToAttack);
+	callback->UnitDef_isAbleToPatrol = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToPatrol);
+	callback->UnitDef_isAbleToFight = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToFight);
+	callback->UnitDef_isAbleToGuard = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToGuard);
+	callback->UnitDef_isAbleToAssist = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToAssist);
+	callback->UnitDef_isAssistable = AI_CALLBACK(skirmishAiCallback_UnitDef_isAssistable);
+	callback->UnitDef_isAbleToRepeat = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToRepeat);
+	callback->UnitDef_isAbleToFireControl = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToFireControl);
+	callback->UnitDef_getFireState = AI_CALLBACK(skirmishAiCallback_UnitDef_getFireState);
+	callback->UnitDef_getMoveState = AI_CALLBACK(skirmishAiCallback_UnitDef_getMoveState);
+	callback->UnitDef_getWingDrag = AI_CALLBACK(skirmishAiCallback_UnitDef_getWingDrag);
+	callback->UnitDef_getWingAngle = AI_CALLBACK(skirmishAiCallback_UnitDef_getWingAngle);
+	callback->UnitDef_getDrag = AI_CALLBACK(skirmishAiCallback_UnitDef_getDrag);
+	callback->UnitDef_getFrontToSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getFrontToSpeed);
+	callback->UnitDef_getSpeedToFront = AI_CALLBACK(skirmishAiCallback_UnitDef_getSpeedToFront);
+	callback->UnitDef_getMyGravity = AI_CALLBACK(skirmishAiCallback_UnitDef_getMyGravity);
+	callback->UnitDef_getMaxBank = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxBank);
+	callback->UnitDef_getMaxPitch = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxPitch);
+	callback->UnitDef_getTurnRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getTurnRadius);
+	callback->UnitDef_getWantedHeight = AI_CALLBACK(skirmishAiCallback_UnitDef_getWantedHeight);
+	callback->UnitDef_getVerticalSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getVerticalSpeed);
+	callback->UnitDef_isAbleToCrash = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToCrash);
+	callback->UnitDef_isHoverAttack = AI_CALLBACK(skirmishAiCallback_UnitDef_isHoverAttack);
+	callback->UnitDef_isAirStrafe = AI_CALLBACK(skirmishAiCallback_UnitDef_isAirStrafe);
+	callback->UnitDef_getDlHoverFactor = AI_CALLBACK(skirmishAiCallback_UnitDef_getDlHoverFactor);
+	callback->UnitDef_getMaxAcceleration = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxAcceleration);
+	callback->UnitDef_getMaxDeceleration = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxDeceleration);
+	callback->UnitDef_getMaxAileron = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxAileron);
+	callback->UnitDef_getMaxElevator = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxElevator);
+	callback->UnitDef_getMaxRudder = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxRudder);
+	callback->UnitDef_getYardMap = AI_CALLBACK(skirmishAiCallback_UnitDef_getYardMap);
+	callback->UnitDef_getXSize = AI_CALLBACK(skirmishAiCallback_UnitDef_getXSize);
+	callback->UnitDef_getZSize = AI_CALLBACK(skirmishAiCallback_UnitDef_getZSize);
+	callback->UnitDef_getBuildAngle = AI_CALLBACK(skirmishAiCallback_UnitDef_getBuildAngle);
+	callback->UnitDef_getLoadingRadius = AI_CALLBACK(skirmishAiCallback_UnitDef_getLoadingRadius);
+	callback->UnitDef_getUnloadSpread = AI_CALLBACK(skirmishAiCallback_UnitDef_getUnloadSpread);
+	callback->UnitDef_getTransportCapacity = AI_CALLBACK(skirmishAiCallback_UnitDef_getTransportCapacity);
+	callback->UnitDef_getTransportSize = AI_CALLBACK(skirmishAiCallback_UnitDef_getTransportSize);
+	callback->UnitDef_getMinTransportSize = AI_CALLBACK(skirmishAiCallback_UnitDef_getMinTransportSize);
+	callback->UnitDef_isAirBase = AI_CALLBACK(skirmishAiCallback_UnitDef_isAirBase);
+	callback->UnitDef_isFirePlatform = AI_CALLBACK(skirmishAiCallback_UnitDef_isFirePlatform);
+	callback->UnitDef_getTransportMass = AI_CALLBACK(skirmishAiCallback_UnitDef_getTransportMass);
+	callback->UnitDef_getMinTransportMass = AI_CALLBACK(skirmishAiCallback_UnitDef_getMinTransportMass);
+	callback->UnitDef_isHoldSteady = AI_CALLBACK(skirmishAiCallback_UnitDef_isHoldSteady);
+	callback->UnitDef_isReleaseHeld = AI_CALLBACK(skirmishAiCallback_UnitDef_isReleaseHeld);
+	callback->UnitDef_isNotTransportable = AI_CALLBACK(skirmishAiCallback_UnitDef_isNotTransportable);
+	callback->UnitDef_isTransportByEnemy = AI_CALLBACK(skirmishAiCallback_UnitDef_isTransportByEnemy);
+	callback->UnitDef_getTransportUnloadMethod = AI_CALLBACK(skirmishAiCallback_UnitDef_getTransportUnloadMethod);
+	callback->UnitDef_getFallSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getFallSpeed);
+	callback->UnitDef_getUnitFallSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getUnitFallSpeed);
+	callback->UnitDef_isAbleToCloak = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToCloak);
+	callback->UnitDef_isStartCloaked = AI_CALLBACK(skirmishAiCallback_UnitDef_isStartCloaked);
+	callback->UnitDef_getCloakCost = AI_CALLBACK(skirmishAiCallback_UnitDef_getCloakCost);
+	callback->UnitDef_getCloakCostMoving = AI_CALLBACK(skirmishAiCallback_UnitDef_getCloakCostMoving);
+	callback->UnitDef_getDecloakDistance = AI_CALLBACK(skirmishAiCallback_UnitDef_getDecloakDistance);
+	callback->UnitDef_isDecloakSpherical = AI_CALLBACK(skirmishAiCallback_UnitDef_isDecloakSpherical);
+	callback->UnitDef_isDecloakOnFire = AI_CALLBACK(skirmishAiCallback_UnitDef_isDecloakOnFire);
+	callback->UnitDef_isAbleToKamikaze = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToKamikaze);
+	callback->UnitDef_getKamikazeDist = AI_CALLBACK(skirmishAiCallback_UnitDef_getKamikazeDist);
+	callback->UnitDef_isTargetingFacility = AI_CALLBACK(skirmishAiCallback_UnitDef_isTargetingFacility);
+	callback->UnitDef_canManualFire = AI_CALLBACK(skirmishAiCallback_UnitDef_canManualFire);
+	callback->UnitDef_isNeedGeo = AI_CALLBACK(skirmishAiCallback_UnitDef_isNeedGeo);
+	callback->UnitDef_isFeature = AI_CALLBACK(skirmishAiCallback_UnitDef_isFeature);
+	callback->UnitDef_isHideDamage = AI_CALLBACK(skirmishAiCallback_UnitDef_isHideDamage);
+	callback->UnitDef_isCommander = AI_CALLBACK(skirmishAiCallback_UnitDef_isCommander);
+	callback->UnitDef_isShowPlayerName = AI_CALLBACK(skirmishAiCallback_UnitDef_isShowPlayerName);
+	callback->UnitDef_isAbleToResurrect = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToResurrect);
+	callback->UnitDef_isAbleToCapture = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToCapture);
+	callback->UnitDef_getHighTrajectoryType = AI_CALLBACK(skirmishAiCallback_UnitDef_getHighTrajectoryType);
+	callback->UnitDef_getNoChaseCategory = AI_CALLBACK(skirmishAiCallback_UnitDef_getNoChaseCategory);
+	callback->UnitDef_isLeaveTracks = AI_CALLBACK(skirmishAiCallback_UnitDef_isLeaveTracks);
+	callback->UnitDef_getTrackWidth = AI_CALLBACK(skirmishAiCallback_UnitDef_getTrackWidth);
+	callback->UnitDef_getTrackOffset = AI_CALLBACK(skirmishAiCallback_UnitDef_getTrackOffset);
+	callback->UnitDef_getTrackStrength = AI_CALLBACK(skirmishAiCallback_UnitDef_getTrackStrength);
+	callback->UnitDef_getTrackStretch = AI_CALLBACK(skirmishAiCallback_UnitDef_getTrackStretch);
+	callback->UnitDef_getTrackType = AI_CALLBACK(skirmishAiCallback_UnitDef_getTrackType);
+	callback->UnitDef_isAbleToDropFlare = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToDropFlare);
+	callback->UnitDef_getFlareReloadTime = AI_CALLBACK(skirmishAiCallback_UnitDef_getFlareReloadTime);
+	callback->UnitDef_getFlareEfficiency = AI_CALLBACK(skirmishAiCallback_UnitDef_getFlareEfficiency);
+	callback->UnitDef_getFlareDelay = AI_CALLBACK(skirmishAiCallback_UnitDef_getFlareDelay);
+	callback->UnitDef_getFlareDropVector = AI_CALLBACK(skirmishAiCallback_UnitDef_getFlareDropVector);
+	callback->UnitDef_getFlareTime = AI_CALLBACK(skirmishAiCallback_UnitDef_getFlareTime);
+	callback->UnitDef_getFlareSalvoSize = AI_CALLBACK(skirmishAiCallback_UnitDef_getFlareSalvoSize);
+	callback->UnitDef_getFlareSalvoDelay = AI_CALLBACK(skirmishAiCallback_UnitDef_getFlareSalvoDelay);
+	callback->UnitDef_isAbleToLoopbackAttack = AI_CALLBACK(skirmishAiCallback_UnitDef_isAbleToLoopbackAttack);
+	callback->UnitDef_isLevelGround = AI_CALLBACK(skirmishAiCallback_UnitDef_isLevelGround);
+	callback->UnitDef_isUseBuildingGroundDecal = AI_CALLBACK(skirmishAiCallback_UnitDef_isUseBuildingGroundDecal);
+	callback->UnitDef_getBuildingDecalType = AI_CALLBACK(skirmishAiCallback_UnitDef_getBuildingDecalType);
+	callback->UnitDef_getBuildingDecalSizeX = AI_CALLBACK(skirmishAiCallback_UnitDef_getBuildingDecalSizeX);
+	callback->UnitDef_getBuildingDecalSizeY = AI_CALLBACK(skirmishAiCallback_UnitDef_getBuildingDecalSizeY);
+	callback->UnitDef_getBuildingDecalDecaySpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_getBuildingDecalDecaySpeed);
+	callback->UnitDef_getMaxThisUnit = AI_CALLBACK(skirmishAiCallback_UnitDef_getMaxThisUnit);
+	callback->UnitDef_getDecoyDef = AI_CALLBACK(skirmishAiCallback_UnitDef_getDecoyDef);
+	callback->UnitDef_isDontLand = AI_CALLBACK(skirmishAiCallback_UnitDef_isDontLand);
+	callback->UnitDef_getShieldDef = AI_CALLBACK(skirmishAiCallback_UnitDef_getShieldDef);
+	callback->UnitDef_getStockpileDef = AI_CALLBACK(skirmishAiCallback_UnitDef_getStockpileDef);
+	callback->UnitDef_getBuildOptions = AI_CALLBACK(skirmishAiCallback_UnitDef_getBuildOptions);
+	callback->UnitDef_getCustomParams = AI_CALLBACK(skirmishAiCallback_UnitDef_getCustomParams);
+	callback->UnitDef_isMoveDataAvailable = AI_CALLBACK(skirmishAiCallback_UnitDef_isMoveDataAvailable);
+	callback->UnitDef_MoveData_getMaxAcceleration = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getMaxAcceleration);
+	callback->UnitDef_MoveData_getMaxBreaking = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getMaxBreaking);
+	callback->UnitDef_MoveData_getMaxSpeed = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getMaxSpeed);
+	callback->UnitDef_MoveData_getMaxTurnRate = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getMaxTurnRate);
+	callback->UnitDef_MoveData_getXSize = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getXSize);
+	callback->UnitDef_MoveData_getZSize = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getZSize);
+	callback->UnitDef_MoveData_getDepth = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getDepth);
+	callback->UnitDef_MoveData_getMaxSlope = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getMaxSlope);
+	callback->UnitDef_MoveData_getSlopeMod = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getSlopeMod);
+	callback->UnitDef_MoveData_getDepthMod = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getDepthMod);
+	callback->UnitDef_MoveData_getPathType = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getPathType);
+	callback->UnitDef_MoveData_getCrushStrength = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getCrushStrength);
+	callback->UnitDef_MoveData_getMoveType = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getMoveType);
+	callback->UnitDef_MoveData_getSpeedModClass = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getSpeedModClass);
+	callback->UnitDef_MoveData_getTerrainClass = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getTerrainClass);
+	callback->UnitDef_MoveData_getFollowGround = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getFollowGround);
+	callback->UnitDef_MoveData_isSubMarine = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_isSubMarine);
+	callback->UnitDef_MoveData_getName = AI_CALLBACK(skirmishAiCallback_UnitDef_MoveData_getName);
+	callback->UnitDef_getWeaponMounts = AI_CALLBACK(skirmishAiCallback_UnitDef_getWeaponMounts);
+	callback->UnitDef_WeaponMount_getName = AI_CALLBACK(skirmishAiCallback_UnitDef_WeaponMount_getName);
+	callback->UnitDef_WeaponMount_getWeaponDef = AI_CALLBACK(skirmishAiCallback_UnitDef_WeaponMount_getWeaponDef);
+	callback->UnitDef_WeaponMount_getSlavedTo = AI_CALLBACK(skirmishAiCallback_UnitDef_WeaponMount_getSlavedTo);
+	callback->UnitDef_WeaponMount_getMainDir = AI_CALLBACK(skirmishAiCallback_UnitDef_WeaponMount_getMainDir);
+	callback->UnitDef_WeaponMount_getMaxAngleDif = AI_CALLBACK(skirmishAiCallback_UnitDef_WeaponMount_getMaxAngleDif);
+	callback->UnitDef_WeaponMount_getBadTargetCategory = AI_CALLBACK(skirmishAiCallback_UnitDef_WeaponMount_getBadTargetCategory);
+	callback->UnitDef_WeaponMount_getOnlyTargetCategory = AI_CALLBACK(skirmishAiCallback_UnitDef_WeaponMount_getOnlyTargetCategory);
+	callback->Unit_getLimit = AI_CALLBACK(skirmishAiCallback_Unit_getLimit);
+	callback->Unit_getMax = AI_CALLBACK(skirmishAiCallback_Unit_getMax);
+	callback->getEnemyUnits = AI_CALLBACK(skirmishAiCallback_getEnemyUnits);
+	callback->getEnemyUnitsIn = AI_CALLBACK(skirmishAiCallback_getEnemyUnitsIn);
+	callback->getEnemyUnitsInRadarAndLos = AI_CALLBACK(skirmishAiCallback_getEnemyUnitsInRadarAndLos);
+	callback->getFriendlyUnits = AI_CALLBACK(skirmishAiCallback_getFriendlyUnits);
+	callback->getFriendlyUnitsIn = AI_CALLBACK(skirmishAiCallback_getFriendlyUnitsIn);
+	callback->getNeutralUnits = AI_CALLBACK(skirmishAiCallback_getNeutralUnits);
+	callback->getNeutralUnitsIn = AI_CALLBACK(skirmishAiCallback_getNeutralUnitsIn);
+	callback->getTeamUnits = AI_CALLBACK(skirmishAiCallback_getTeamUnits);
+	callback->getSelectedUnits = AI_CALLBACK(skirmishAiCallback_getSelectedUnits);
+	callback->getUnitsPos = AI_CALLBACK(skirmishAiCallback_getUnitsPos);
+	callback->getUnitsVel = AI_CALLBACK(skirmishAiCallback_getUnitsVel);
+	callback->getUnitsHealth = AI_CALLBACK(skirmishAiCallback_getUnitsHealth);
+	callback->getUnitsDef = AI_CALLBACK(skirmishAiCallback_getUnitsDef);
+	callback->getUnitsCurrentCommand = AI_CALLBACK(skirmishAiCallback_getUnitsCurrentCommand);
+	callback->Unit_getDef = AI_CALLBACK(skirmishAiCallback_Unit_getDef);
+	callback->Unit_getRulesParamFloat = AI_CALLBACK(skirmishAiCallback_Unit_getRulesParamFloat);
+	callback->Unit_getRulesParamString = AI_CALLBACK(skirmishAiCallback_Unit_getRulesParamString);
+	callback->Unit_getTeam = AI_CALLBACK(skirmishAiCallback_Unit_getTeam);
+	callback->Unit_getAllyTeam = AI_CALLBACK(skirmishAiCallback_Unit_getAllyTeam);
+	callback->Unit_getAiHint = AI_CALLBACK(skirmishAiCallback_Unit_getAiHint);
+	callback->Unit_getStockpile = AI_CALLBACK(skirmishAiCallback_Unit_getStockpile);
+	callback->Unit_getStockpileQueued = AI_CALLBACK(skirmishAiCallback_Unit_getStockpileQueued);
+	callback->Unit_getMaxSpeed = AI_CALLBACK(skirmishAiCallback_Unit_getMaxSpeed);
+	callback->Unit_getMaxRange = AI_CALLBACK(skirmishAiCallback_Unit_getMaxRange);
+	callback->Unit_getMaxHealth = AI_CALLBACK(skirmishAiCallback_Unit_getMaxHealth);
+	callback->Unit_getExperience = AI_CALLBACK(skirmishAiCallback_Unit_getExperience);
+	callback->Unit_getGroup = AI_CALLBACK(skirmishAiCallback_Unit_getGroup);
+	callback->Unit_getCurrentCommands = AI_CALLBACK(skirmishAiCallback_Unit_getCurrentCommands);
+	callback->Unit_CurrentCommand_getType = AI_CALLBACK(skirmishAiCallback_Unit_CurrentCommand_getType);
+	callback->Unit_CurrentCommand_getId = AI_CALLBACK(skirmishAiCallback_Unit_CurrentCommand_getId);
+	callback->Unit_CurrentCommand_getOptions = AI_CALLBACK(skirmishAiCallback_Unit_CurrentCommand_getOptions);
+	callback->Unit_CurrentCommand_getTag = AI_CALLBACK(skirmishAiCallback_Unit_CurrentCommand_getTag);
+	callback->Unit_CurrentCommand_getTimeOut = AI_CALLBACK(skirmishAiCallback_Unit_CurrentCommand_getTimeOut);
+	callback->Unit_CurrentCommand_getParams = AI_CALLBACK(skirmishAiCallback_Unit_CurrentCommand_getParams);
+	callback->Unit_getSupportedCommands = AI_CALLBACK(skirmishAiCallback_Unit_getSupportedCommands);
+	callback->Unit_SupportedCommand_getId = AI_CALLBACK(skirmishAiCallback_Unit_SupportedCommand_getId);
+	callback->Unit_SupportedCommand_getName = AI_CALLBACK(skirmishAiCallback_Unit_SupportedCommand_getName);
+	callback->Unit_SupportedCommand_getToolTip = AI_CALLBACK(skirmishAiCallback_Unit_SupportedCommand_getToolTip);
+	callback->Unit_SupportedCommand_isShowUnique = AI_CALLBACK(skirmishAiCallback_Unit_SupportedCommand_isShowUnique);
+	callback->Unit_SupportedCommand_isDisabled = AI_CALLBACK(skirmishAiCallback_Unit_SupportedCommand_isDisabled);
+	callback->Unit_SupportedCommand_getParams = AI_CALLBACK(skirmishAiCallback_Unit_SupportedCommand_getParams);
+	callback->Unit_getHealth = AI_CALLBACK(skirmishAiCallback_Unit_getHealth);
+	callback->Unit_getParalyzeDamage = AI_CALLBACK(skirmishAiCallback_Unit_getParalyzeDamage);
+	callback->Unit_getCaptureProgress = AI_CALLBACK(skirmishAiCallback_Unit_getCaptureProgress);
+	callback->Unit_getBuildProgress = AI_CALLBACK(skirmishAiCallback_Unit_getBuildProgress);
+	callback->Unit_getSpeed = AI_CALLBACK(skirmishAiCallback_Unit_getSpeed);
+	callback->Unit_getPower = AI_CALLBACK(skirmishAiCallback_Unit_getPower);
+	callback->Unit_getResourceUse = AI_CALLBACK(skirmishAiCallback_Unit_getResourceUse);
+	callback->Unit_getResourceMake = AI_CALLBACK(skirmishAiCallback_Unit_getResourceMake);
+	callback->Unit_getPos = AI_CALLBACK(skirmishAiCallback_Unit_getPos);
+	callback->Unit_getVel = AI_CALLBACK(skirmishAiCallback_Unit_getVel);
+	callback->Unit_isActivated = AI_CALLBACK(skirmishAiCallback_Unit_isActivated);
+	callback->Unit_isBeingBuilt = AI_CALLBACK(skirmishAiCallback_Unit_isBeingBuilt);
+	callback->Unit_isCloaked = AI_CALLBACK(skirmishAiCallback_Unit_isCloaked);
+	callback->Unit_isParalyzed = AI_CALLBACK(skirmishAiCallback_Unit_isParalyzed);
+	callback->Unit_isNeutral = AI_CALLBACK(skirmishAiCallback_Unit_isNeutral);
+	callback->Unit_getBuildingFacing = AI_CALLBACK(skirmishAiCallback_Unit_getBuildingFacing);
+	callback->Unit_getLastUserOrderFrame = AI_CALLBACK(skirmishAiCallback_Unit_getLastUserOrderFrame);
+	callback->Unit_getWeapons = AI_CALLBACK(skirmishAiCallback_Unit_getWeapons);
+	callback->Unit_getWeapon = AI_CALLBACK(skirmishAiCallback_Unit_getWeapon);
+	callback->Team_hasAIController = AI_CALLBACK(skirmishAiCallback_Team_hasAIController);
+	callback->getEnemyTeams = AI_CALLBACK(skirmishAiCallback_getEnemyTeams);
+	callback->getAllyTeams = AI_CALLBACK(skirmishAiCallback_getAllyTeams);
+	callback->Team_getRulesParamFloat = AI_CALLBACK(skirmishAiCallback_Team_getRulesParamFloat);
+	callback->Team_getRulesParamString = AI_CALLBACK(skirmishAiCallback_Team_getRulesParamString);
+	callback->getGroups = AI_CALLBACK(skirmishAiCallback_getGroups);
+	callback->Group_getSupportedCommands = AI_CALLBACK(skirmishAiCallback_Group_getSupportedCommands);
+	callback->Group_SupportedCommand_getId = AI_CALLBACK(skirmishAiCallback_Group_SupportedCommand_getId);
+	callback->Group_SupportedCommand_getName = AI_CALLBACK(skirmishAiCallback_Group_SupportedCommand_getName);
+	callback->Group_SupportedCommand_getToolTip = AI_CALLBACK(skirmishAiCallback_Group_SupportedCommand_getToolTip);
+	callback->Group_SupportedCommand_isShowUnique = AI_CALLBACK(skirmishAiCallback_Group_SupportedCommand_isShowUnique);
+	callback->Group_SupportedCommand_isDisabled = AI_CALLBACK(skirmishAiCallback_Group_SupportedCommand_isDisabled);
+	callback->Group_SupportedCommand_getParams = AI_CALLBACK(skirmishAiCallback_Group_SupportedCommand_getParams);
+	callback->Group_OrderPreview_getId = AI_CALLBACK(skirmishAiCallback_Group_OrderPreview_getId);
+	callback->Group_OrderPreview_getOptions = AI_CALLBACK(skirmishAiCallback_Group_OrderPreview_getOptions);
+	callback->Group_OrderPreview_getTag = AI_CALLBACK(skirmishAiCallback_Group_OrderPreview_getTag);
+	callback->Group_OrderPreview_getTimeOut = AI_CALLBACK(skirmishAiCallback_Group_OrderPreview_getTimeOut);
+	callback->Group_OrderPreview_getParams = AI_CALLBACK(skirmishAiCallback_Group_OrderPreview_getParams);
+	callback->Group_isSelected = AI_CALLBACK(skirmishAiCallback_Group_isSelected);
+	callback->Mod_getFileName = AI_CALLBACK(skirmishAiCallback_Mod_getFileName);
+	callback->Mod_getHash = AI_CALLBACK(skirmishAiCallback_Mod_getHash);
+	callback->Mod_getHumanName = AI_CALLBACK(skirmishAiCallback_Mod_getHumanName);
+	callback->Mod_getShortName = AI_CALLBACK(skirmishAiCallback_Mod_getShortName);
+	callback->Mod_getVersion = AI_CALLBACK(skirmishAiCallback_Mod_getVersion);
+	callback->Mod_getMutator = AI_CALLBACK(skirmishAiCallback_Mod_getMutator);
+	callback->Mod_getDescription = AI_CALLBACK(skirmishAiCallback_Mod_getDescription);
+	callback->Mod_getAllowTeamColors = AI_CALLBACK(skirmishAiCallback_Mod_getAllowTeamColors);
+	callback->Mod_getConstructionDecay = AI_CALLBACK(skirmishAiCallback_Mod_getConstructionDecay);
+	callback->Mod_getConstructionDecayTime = AI_CALLBACK(skirmishAiCallback_Mod_getConstructionDecayTime);
+	callback->Mod_getConstructionDecaySpeed = AI_CALLBACK(skirmishAiCallback_Mod_getConstructionDecaySpeed);
+	callback->Mod_getMultiReclaim = AI_CALLBACK(skirmishAiCallback_Mod_getMultiReclaim);
+	callback->Mod_getReclaimMethod = AI_CALLBACK(skirmishAiCallback_Mod_getReclaimMethod);
+	callback->Mod_getReclaimUnitMethod = AI_CALLBACK(skirmishAiCallback_Mod_getReclaimUnitMethod);
+	callback->Mod_getReclaimUnitEnergyCostFactor = AI_CALLBACK(skirmishAiCallback_Mod_getReclaimUnitEnergyCostFactor);
+	callback->Mod_getReclaimUnitEfficiency = AI_CALLBACK(skirmishAiCallback_Mod_getReclaimUnitEfficiency);
+	callback->Mod_getReclaimFeatureEnergyCostFactor = AI_CALLBACK(skirmishAiCallback_Mod_getReclaimFeatureEnergyCostFactor);
+	callback->Mod_getReclaimAllowEnemies = AI_CALLBACK(skirmishAiCallback_Mod_getReclaimAllowEnemies);
+	callback->Mod_getReclaimAllowAllies = AI_CALLBACK(skirmishAiCallback_Mod_getReclaimAllowAllies);
+	callback->Mod_getRepairEnergyCostFactor = AI_CALLBACK(skirmishAiCallback_Mod_getRepairEnergyCostFactor);
+	callback->Mod_getResurrectEnergyCostFactor = AI_CALLBACK(skirmishAiCallback_Mod_getResurrectEnergyCostFactor);
+	callback->Mod_getCaptureEnergyCostFactor = AI_CALLBACK(skirmishAiCallback_Mod_getCaptureEnergyCostFactor);
+	callback->Mod_getTransportGround = AI_CALLBACK(skirmishAiCallback_Mod_getTransportGround);
+	callback->Mod_getTransportHover = AI_CALLBACK(skirmishAiCallback_Mod_getTransportHover);
+	callback->Mod_getTransportShip = AI_CALLBACK(skirmishAiCallback_Mod_getTransportShip);
+	callback->Mod_getTransportAir = AI_CALLBACK(skirmishAiCallback_Mod_getTransportAir);
+	callback->Mod_getFireAtKilled = AI_CALLBACK(skirmishAiCallback_Mod_getFireAtKilled);
+	callback->Mod_getFireAtCrashing = AI_CALLBACK(skirmishAiCallback_Mod_getFireAtCrashing);
+	callback->Mod_getFlankingBonusModeDefault = AI_CALLBACK(skirmishAiCallback_Mod_getFlankingBonusModeDefault);
+	callback->Mod_getLosMipLevel = AI_CALLBACK(skirmishAiCallback_Mod_getLosMipLevel);
+	callback->Mod_getAirMipLevel = AI_CALLBACK(skirmishAiCallback_Mod_getAirMipLevel);
+	callback->Mod_getRadarMipLevel = AI_CALLBACK(skirmishAiCallback_Mod_getRadarMipLevel);
+	callback->Mod_getRequireSonarUnderWater = AI_CALLBACK(skirmishAiCallback_Mod_getRequireSonarUnderWater);
+	callback->Map_getChecksum = AI_CALLBACK(skirmishAiCallback_Map_getChecksum);
+	callback->Map_getStartPos = AI_CALLBACK(skirmishAiCallback_Map_getStartPos);
+	callback->Map_getMousePos = AI_CALLBACK(skirmishAiCallback_Map_getMousePos);
+	callback->Map_isPosInCamera = AI_CALLBACK(skirmishAiCallback_Map_isPosInCamera);
+	callback->Map_getWidth = AI_CALLBACK(skirmishAiCallback_Map_getWidth);
+	callback->Map_getHeight = AI_CALLBACK(skirmishAiCallback_Map_getHeight);
+	callback->Map_getHeightMap = AI_CALLBACK(skirmishAiCallback_Map_getHeightMap);
+	callback->Map_getCornersHeightMap = AI_CALLBACK(skirmishAiCallback_Map_getCornersHeightMap);
+	callback->Map_getMinHeight = AI_CALLBACK(skirmishAiCallback_Map_getMinHeight);
+	callback->Map_getMaxHeight = AI_CALLBACK(skirmishAiCallback_Map_getMaxHeight);
+	callback->Map_getSlopeMap = AI_CALLBACK(skirmishAiCallback_Map_getSlopeMap);
+	callback->Map_getLosMap = AI_CALLBACK(skirmishAiCallback_Map_getLosMap);
+	callback->Map_getAirLosMap = AI_CALLBACK(skirmishAiCallback_Map_getAirLosMap);
+	callback->Map_getRadarMap = AI_CALLBACK(skirmishAiCallback_Map_getRadarMap);
+	callback->Map_getSonarMap = AI_CALLBACK(skirmishAiCallback_Map_getSonarMap);
+	callback->Map_getSeismicMap = AI_CALLBACK(skirmishAiCallback_Map_getSeismicMap);
+	callback->Map_getJammerMap = AI_CALLBACK(skirmishAiCallback_Map_getJammerMap);
+	callback->Map_getSonarJammerMap = AI_CALLBACK(skirmishAiCallback_Map_getSonarJammerMap);
+	callback->Map_getResourceMapRaw = AI_CALLBACK(skirmishAiCallback_Map_getResourceMapRaw);
+	callback->Map_getResourceMapSpotsPositions = AI_CALLBACK(skirmishAiCallback_Map_getResourceMapSpotsPositions);
+	callback->Map_getResourceMapSpotsAverageIncome = AI_CALLBACK(skirmishAiCallback_Map_getResourceMapSpotsAverageIncome);
+	callback->Map_getResourceMapSpotsNearest = AI_CALLBACK(skirmishAiCallback_Map_getResourceMapSpotsNearest);
+	callback->Map_getHash = AI_CALLBACK(skirmishAiCallback_Map_getHash);
+	callback->Map_getName = AI_CALLBACK(skirmishAiCallback_Map_getName);
+	callback->Map_getHumanName = AI_CALLBACK(skirmishAiCallback_Map_getHumanName);
+	callback->Map_getElevationAt = AI_CALLBACK(skirmishAiCallback_Map_getElevationAt);
+	callback->Map_getMaxResource = AI_CALLBACK(skirmishAiCallback_Map_getMaxResource);
+	callback->Map_getExtractorRadius = AI_CALLBACK(skirmishAiCallback_Map_getExtractorRadius);
+	callback->Map_getMinWind = AI_CALLBACK(skirmishAiCallback_Map_getMinWind);
+	callback->Map_getMaxWind = AI_CALLBACK(skirmishAiCallback_Map_getMaxWind);
+	callback->Map_getCurWind = AI_CALLBACK(skirmishAiCallback_Map_getCurWind);
+	callback->Map_getTidalStrength = AI_CALLBACK(skirmishAiCallback_Map_getTidalStrength);
+	callback->Map_getGravity = AI_CALLBACK(skirmishAiCallback_Map_getGravity);
+	callback->Map_getWaterDamage = AI_CALLBACK(skirmishAiCallback_Map_getWaterDamage);
+	callback->Map_isDeformable = AI_CALLBACK(skirmishAiCallback_Map_isDeformable);
+	callback->Map_getHardness = AI_CALLBACK(skirmishAiCallback_Map_getHardness);
+	callback->Map_getHardnessModMap = AI_CALLBACK(skirmishAiCallback_Map_getHardnessModMap);
+	callback->Map_getSpeedModMap = AI_CALLBACK(skirmishAiCallback_Map_getSpeedModMap);
+	callback->Map_getPoints = AI_CALLBACK(skirmishAiCallback_Map_getPoints);
+	callback->Map_Point_getPosition = AI_CALLBACK(skirmishAiCallback_Map_Point_getPosition);
+	callback->Map_Point_getColor = AI_CALLBACK(skirmishAiCallback_Map_Point_getColor);
+	callback->Map_Point_getLabel = AI_CALLBACK(skirmishAiCallback_Map_Point_getLabel);
+	callback->Map_getLines = AI_CALLBACK(skirmishAiCallback_Map_getLines);
+	callback->Map_Line_getFirstPosition = AI_CALLBACK(skirmishAiCallback_Map_Line_getFirstPosition);
+	callback->Map_Line_getSecondPosition = AI_CALLBACK(skirmishAiCallback_Map_Line_getSecondPosition);
+	callback->Map_Line_getColor = AI_CALLBACK(skirmishAiCallback_Map_Line_getColor);
+	callback->Map_isPossibleToBuildAt = AI_CALLBACK(skirmishAiCallback_Map_isPossibleToBuildAt);
+	callback->Map_findClosestBuildSite = AI_CALLBACK(skirmishAiCallback_Map_findClosestBuildSite);
+	callback->getFeatureDefs = AI_CALLBACK(skirmishAiCallback_getFeatureDefs);
+	callback->FeatureDef_getName = AI_CALLBACK(skirmishAiCallback_FeatureDef_getName);
+	callback->FeatureDef_getDescription = AI_CALLBACK(skirmishAiCallback_FeatureDef_getDescription);
+	callback->FeatureDef_getFileName = AI_CALLBACK(skirmishAiCallback_FeatureDef_getFileName);
+	callback->FeatureDef_getContainedResource = AI_CALLBACK(skirmishAiCallback_FeatureDef_getContainedResource);
+	callback->FeatureDef_getMaxHealth = AI_CALLBACK(skirmishAiCallback_FeatureDef_getMaxHealth);
+	callback->FeatureDef_getReclaimTime = AI_CALLBACK(skirmishAiCallback_FeatureDef_getReclaimTime);
+	callback->FeatureDef_getMass = AI_CALLBACK(skirmishAiCallback_FeatureDef_getMass);
+	callback->FeatureDef_isUpright = AI_CALLBACK(skirmishAiCallback_FeatureDef_isUpright);
+	callback->FeatureDef_getDrawType = AI_CALLBACK(skirmishAiCallback_FeatureDef_getDrawType);
+	callback->FeatureDef_getModelName = AI_CALLBACK(skirmishAiCallback_FeatureDef_getModelName);
+	callback->FeatureDef_getResurrectable = AI_CALLBACK(skirmishAiCallback_FeatureDef_getResurrectable);
+	callback->FeatureDef_getSmokeTime = AI_CALLBACK(skirmishAiCallback_FeatureDef_getSmokeTime);
+	callback->FeatureDef_isDestructable = AI_CALLBACK(skirmishAiCallback_FeatureDef_isDestructable);
+	callback->FeatureDef_isReclaimable = AI_CALLBACK(skirmishAiCallback_FeatureDef_isReclaimable);
+	callback->FeatureDef_isBlocking = AI_CALLBACK(skirmishAiCallback_FeatureDef_isBlocking);
+	callback->FeatureDef_isBurnable = AI_CALLBACK(skirmishAiCallback_FeatureDef_isBurnable);
+	callback->FeatureDef_isFloating = AI_CALLBACK(skirmishAiCallback_FeatureDef_isFloating);
+	callback->FeatureDef_isNoSelect = AI_CALLBACK(skirmishAiCallback_FeatureDef_isNoSelect);
+	callback->FeatureDef_isGeoThermal = AI_CALLBACK(skirmishAiCallback_FeatureDef_isGeoThermal);
+	callback->FeatureDef_getDeathFeature = AI_CALLBACK(skirmishAiCallback_FeatureDef_getDeathFeature);
+	callback->FeatureDef_getXSize = AI_CALLBACK(skirmishAiCallback_FeatureDef_getXSize);
+	callback->FeatureDef_getZSize = AI_CALLBACK(skirmishAiCallback_FeatureDef_getZSize);
+	callback->FeatureDef_getCustomParams = AI_CALLBACK(skirmishAiCallback_FeatureDef_getCustomParams);
+	callback->getFeatures = AI_CALLBACK(skirmishAiCallback_getFeatures);
+	callback->getFeaturesIn = AI_CALLBACK(skirmishAiCallback_getFeaturesIn);
+	callback->Feature_getDef = AI_CALLBACK(skirmishAiCallback_Feature_getDef);
+	callback->Feature_getHealth = AI_CALLBACK(skirmishAiCallback_Feature_getHealth);
+	callback->Feature_getReclaimLeft = AI_CALLBACK(skirmishAiCallback_Feature_getReclaimLeft);
+	callback->Feature_getPosition = AI_CALLBACK(skirmishAiCallback_Feature_getPosition);
+	callback->Feature_getRulesParamFloat = AI_CALLBACK(skirmishAiCallback_Feature_getRulesParamFloat);
+	callback->Feature_getRulesParamString = AI_CALLBACK(skirmishAiCallback_Feature_getRulesParamString);
+	callback->getWeaponDefs = AI_CALLBACK(skirmishAiCallback_getWeaponDefs);
+	callback->getWeaponDefByName = AI_CALLBACK(skirmishAiCallback_getWeaponDefByName);
+	callback->WeaponDef_getName = AI_CALLBACK(skirmishAiCallback_WeaponDef_getName);
+	callback->WeaponDef_getType = AI_CALLBACK(skirmishAiCallback_WeaponDef_getType);
+	callback->WeaponDef_getDescription = AI_CALLBACK(skirmishAiCallback_WeaponDef_getDescription);
+	callback->WeaponDef_getFileName = AI_CALLBACK(skirmishAiCallback_WeaponDef_getFileName);
+	callback->WeaponDef_getCegTag = AI_CALLBACK(skirmishAiCallback_WeaponDef_getCegTag);
+	callback->WeaponDef_getRange = AI_CALLBACK(skirmishAiCallback_WeaponDef_getRange);
+	callback->WeaponDef_getHeightMod = AI_CALLBACK(skirmishAiCallback_WeaponDef_getHeightMod);
+	callback->WeaponDef_getAccuracy = AI_CALLBACK(skirmishAiCallback_WeaponDef_getAccuracy);
+	callback->WeaponDef_getSprayAngle = AI_CALLBACK(skirmishAiCallback_WeaponDef_getSprayAngle);
+	callback->WeaponDef_getMovingAccuracy = AI_CALLBACK(skirmishAiCallback_WeaponDef_getMovingAccuracy);
+	callback->WeaponDef_getTargetMoveError = AI_CALLBACK(skirmishAiCallback_WeaponDef_getTargetMoveError);
+	callback->WeaponDef_getLeadLimit = AI_CALLBACK(skirmishAiCallback_WeaponDef_getLeadLimit);
+	callback->WeaponDef_getLeadBonus = AI_CALLBACK(skirmishAiCallback_WeaponDef_getLeadBonus);
+	callback->WeaponDef_getPredictBoost = AI_CALLBACK(skirmishAiCallback_WeaponDef_getPredictBoost);
+	callback->WeaponDef_getNumDamageTypes = AI_CALLBACK(skirmishAiCallback_WeaponDef_getNumDamageTypes);
+	callback->WeaponDef_Damage_getParalyzeDamageTime = AI_CALLBACK(skirmishAiCallback_WeaponDef_Damage_getParalyzeDamageTime);
+	callback->WeaponDef_Damage_getImpulseFactor = AI_CALLBACK(skirmishAiCallback_WeaponDef_Damage_getImpulseFactor);
+	callback->WeaponDef_Damage_getImpulseBoost = AI_CALLBACK(skirmishAiCallback_WeaponDef_Damage_getImpulseBoost);
+	callback->WeaponDef_Damage_getCraterMult = AI_CALLBACK(skirmishAiCallback_WeaponDef_Damage_getCraterMult);
+	callback->WeaponDef_Damage_getCraterBoost = AI_CALLBACK(skirmishAiCallback_WeaponDef_Damage_getCraterBoost);
+	callback->WeaponDef_Damage_getTypes = AI_CALLBACK(skirmishAiCallback_WeaponDef_Damage_getTypes);
+	callback->WeaponDef_getAreaOfEffect = AI_CALLBACK(skirmishAiCallback_WeaponDef_getAreaOfEffect);
+	callback->WeaponDef_isNoSelfDamage = AI_CALLBACK(skirmishAiCallback_WeaponDef_isNoSelfDamage);
+	callback->WeaponDef_getFireStarter = AI_CALLBACK(skirmishAiCallback_WeaponDef_getFireStarter);
+	callback->WeaponDef_getEdgeEffectiveness = AI_CALLBACK(skirmishAiCallback_WeaponDef_getEdgeEffectiveness);
+	callback->WeaponDef_getSize = AI_CALLBACK(skirmishAiCallback_WeaponDef_getSize);
+	callback->WeaponDef_getSizeGrowth = AI_CALLBACK(skirmishAiCallback_WeaponDef_getSizeGrowth);
+	callback->WeaponDef_getCollisionSize = AI_CALLBACK(skirmishAiCallback_WeaponDef_getCollisionSize);
+	callback->WeaponDef_getSalvoSize = AI_CALLBACK(skirmishAiCallback_WeaponDef_getSalvoSize);
+	callback->WeaponDef_getSalvoDelay = AI_CALLBACK(skirmishAiCallback_WeaponDef_getSalvoDelay);
+	callback->WeaponDef_getReload = AI_CALLBACK(skirmishAiCallback_WeaponDef_getReload);
+	callback->WeaponDef_getBeamTime = AI_CALLBACK(skirmishAiCallback_WeaponDef_getBeamTime);
+	callback->WeaponDef_isBeamBurst = AI_CALLBACK(skirmishAiCallback_WeaponDef_isBeamBurst);
+	callback->WeaponDef_isWaterBounce = AI_CALLBACK(skirmishAiCallback_WeaponDef_isWaterBounce);
+	callback->WeaponDef_isGroundBounce = AI_CALLBACK(skirmishAiCallback_WeaponDef_isGroundBounce);
+	callback->WeaponDef_getBounceRebound = AI_CALLBACK(skirmishAiCallback_WeaponDef_getBounceRebound);
+	callback->WeaponDef_getBounceSlip = AI_CALLBACK(skirmishAiCallback_WeaponDef_getBounceSlip);
+	callback->WeaponDef_getNumBounce = AI_CALLBACK(skirmishAiCallback_WeaponDef_getNumBounce);
+	callback->WeaponDef_getMaxAngle = AI_CALLBACK(skirmishAiCallback_WeaponDef_getMaxAngle);
+	callback->WeaponDef_getUpTime = AI_CALLBACK(skirmishAiCallback_WeaponDef_getUpTime);
+	callback->WeaponDef_getFlightTime = AI_CALLBACK(skirmishAiCallback_WeaponDef_getFlightTime);
+	callback->WeaponDef_getCost = AI_CALLBACK(skirmishAiCallback_WeaponDef_getCost);
+	callback->WeaponDef_getProjectilesPerShot = AI_CALLBACK(skirmishAiCallback_WeaponDef_getProjectilesPerShot);
+	callback->WeaponDef_isTurret = AI_CALLBACK(skirmishAiCallback_WeaponDef_isTurret);
+	callback->WeaponDef_isOnlyForward = AI_CALLBACK(skirmishAiCallback_WeaponDef_isOnlyForward);
+	callback->WeaponDef_isFixedLauncher = AI_CALLBACK(skirmishAiCallback_WeaponDef_isFixedLauncher);
+	callback->WeaponDef_isWaterWeapon = AI_CALLBACK(skirmishAiCallback_WeaponDef_isWaterWeapon);
+	callback->WeaponDef_isFireSubmersed = AI_CALLBACK(skirmishAiCallback_WeaponDef_isFireSubmersed);
+	callback->WeaponDef_isSubMissile = AI_CALLBACK(skirmishAiCallback_WeaponDef_isSubMissile);
+	callback->WeaponDef_isTracks = AI_CALLBACK(skirmishAiCallback_WeaponDef_isTracks);
+	callback->WeaponDef_isDropped = AI_CALLBACK(skirmishAiCallback_WeaponDef_isDropped);
+	callback->WeaponDef_isParalyzer = AI_CALLBACK(skirmishAiCallback_WeaponDef_isParalyzer);
+	callback->WeaponDef_isImpactOnly = AI_CALLBACK(skirmishAiCallback_WeaponDef_isImpactOnly);
+	callback->WeaponDef_isNoAutoTarget = AI_CALLBACK(skirmishAiCallback_WeaponDef_isNoAutoTarget);
+	callback->WeaponDef_isManualFire = AI_CALLBACK(skirmishAiCallback_WeaponDef_isManualFire);
+	callback->WeaponDef_getInterceptor = AI_CALLBACK(skirmishAiCallback_WeaponDef_getInterceptor);
+	callback->WeaponDef_getTargetable = AI_CALLBACK(skirmishAiCallback_WeaponDef_getTargetable);
+	callback->WeaponDef_isStockpileable = AI_CALLBACK(skirmishAiCallback_WeaponDef_isStockpileable);
+	callback->WeaponDef_getCoverageRange = AI_CALLBACK(skirmishAiCallback_WeaponDef_getCoverageRange);
+	callback->WeaponDef_getStockpileTime = AI_CALLBACK(skirmishAiCallback_WeaponDef_getStockpileTime);
+	callback->WeaponDef_getIntensity = AI_CALLBACK(skirmishAiCallback_WeaponDef_getIntensity);
+	callback->WeaponDef_getThickness = AI_CALLBACK(skirmishAiCallback_WeaponDef_getThickness);
+	callback->WeaponDef_getLaserFlareSize = AI_CALLBACK(skirmishAiCallback_WeaponDef_getLaserFlareSize);
+	callback->WeaponDef_getCoreThickness = AI_CALLBACK(skirmishAiCallback_WeaponDef_getCoreThickness);
+	callback->WeaponDef_getDuration = AI_CALLBACK(skirmishAiCallback_WeaponDef_getDuration);
+	callback->WeaponDef_getLodDistance = AI_CALLBACK(skirmishAiCallback_WeaponDef_getLodDistance);
+	callback->WeaponDef_getFalloffRate = AI_CALLBACK(skirmishAiCallback_WeaponDef_getFalloffRate);
+	callback->WeaponDef_getGraphicsType = AI_CALLBACK(skirmishAiCallback_WeaponDef_getGraphicsType);
+	callback->WeaponDef_isSoundTrigger = AI_CALLBACK(skirmishAiCallback_WeaponDef_isSoundTrigger);
+	callback->WeaponDef_isSelfExplode = AI_CALLBACK(skirmishAiCallback_WeaponDef_isSelfExplode);
+	callback->WeaponDef_isGravityAffected = AI_CALLBACK(skirmishAiCallback_WeaponDef_isGravityAffected);
+	callback->WeaponDef_getHighTrajectory = AI_CALLBACK(skirmishAiCallback_WeaponDef_getHighTrajectory);
+	callback->WeaponDef_getMyGravity = AI_CALLBACK(skirmishAiCallback_WeaponDef_getMyGravity);
+	callback->WeaponDef_isNoExplode = AI_CALLBACK(skirmishAiCallback_WeaponDef_isNoExplode);
+	callback->WeaponDef_getStartVelocity = AI_CALLBACK(skirmishAiCallback_WeaponDef_getStartVelocity);
+	callback->WeaponDef_getWeaponAcceleration = AI_CALLBACK(skirmishAiCallback_WeaponDef_getWeaponAcceleration);
+	callback->WeaponDef_getTurnRate = AI_CALLBACK(skirmishAiCallback_WeaponDef_getTurnRate);
+	callback->WeaponDef_getMaxVelocity = AI_CALLBACK(skirmishAiCallback_WeaponDef_getMaxVelocity);
+	callback->WeaponDef_getProjectileSpeed = AI_CALLBACK(skirmishAiCallback_WeaponDef_getProjectileSpeed);
+	callback->WeaponDef_getExplosionSpeed = AI_CALLBACK(skirmishAiCallback_WeaponDef_getExplosionSpeed);
+	callback->WeaponDef_getOnlyTargetCategory = AI_CALLBACK(skirmishAiCallback_WeaponDef_getOnlyTargetCategory);
+	callback->WeaponDef_getWobble = AI_CALLBACK(skirmishAiCallback_WeaponDef_getWobble);
+	callback->WeaponDef_getDance = AI_CALLBACK(skirmishAiCallback_WeaponDef_getDance);
+	callback->WeaponDef_getTrajectoryHeight = AI_CALLBACK(skirmishAiCallback_WeaponDef_getTrajectoryHeight);
+	callback->WeaponDef_isLargeBeamLaser = AI_CALLBACK(skirmishAiCallback_WeaponDef_isLargeBeamLaser);
+	callback->WeaponDef_isShield = AI_CALLBACK(skirmishAiCallback_WeaponDef_isShield);
+	callback->WeaponDef_isShieldRepulser = AI_CALLBACK(skirmishAiCallback_WeaponDef_isShieldRepulser);
+	callback->WeaponDef_isSmartShield = AI_CALLBACK(skirmishAiCallback_WeaponDef_isSmartShield);
+	callback->WeaponDef_isExteriorShield = AI_CALLBACK(skirmishAiCallback_WeaponDef_isExteriorShield);
+	callback->WeaponDef_isVisibleShield = AI_CALLBACK(skirmishAiCallback_WeaponDef_isVisibleShield);
+	callback->WeaponDef_isVisibleShieldRepulse = AI_CALLBACK(skirmishAiCallback_WeaponDef_isVisibleShieldRepulse);
+	callback->WeaponDef_getVisibleShieldHitFrames = AI_CALLBACK(skirmishAiCallback_WeaponDef_getVisibleShieldHitFrames);
+	callback->WeaponDef_Shield_getResourceUse = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getResourceUse);
+	callback->WeaponDef_Shield_getRadius = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getRadius);
+	callback->WeaponDef_Shield_getForce = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getForce);
+	callback->WeaponDef_Shield_getMaxSpeed = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getMaxSpeed);
+	callback->WeaponDef_Shield_getPower = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getPower);
+	callback->WeaponDef_Shield_getPowerRegen = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getPowerRegen);
+	callback->WeaponDef_Shield_getPowerRegenResource = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getPowerRegenResource);
+	callback->WeaponDef_Shield_getStartingPower = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getStartingPower);
+	callback->WeaponDef_Shield_getRechargeDelay = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getRechargeDelay);
+	callback->WeaponDef_Shield_getGoodColor = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getGoodColor);
+	callback->WeaponDef_Shield_getBadColor = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getBadColor);
+	callback->WeaponDef_Shield_getAlpha = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getAlpha);
+	callback->WeaponDef_Shield_getInterceptType = AI_CALLBACK(skirmishAiCallback_WeaponDef_Shield_getInterceptType);
+	callback->WeaponDef_getInterceptedByShieldType = AI_CALLBACK(skirmishAiCallback_WeaponDef_getInterceptedByShieldType);
+	callback->WeaponDef_isAvoidFriendly = AI_CALLBACK(skirmishAiCallback_WeaponDef_isAvoidFriendly);
+	callback->WeaponDef_isAvoidFeature = AI_CALLBACK(skirmishAiCallback_WeaponDef_isAvoidFeature);
+	callback->WeaponDef_isAvoidNeutral = AI_CALLBACK(skirmishAiCallback_WeaponDef_isAvoidNeutral);
+	callback->WeaponDef_getTargetBorder = AI_CALLBACK(skirmishAiCallback_WeaponDef_getTargetBorder);
+	callback->WeaponDef_getCylinderTargetting = AI_CALLBACK(skirmishAiCallback_WeaponDef_getCylinderTargetting);
+	callback->WeaponDef_getMinIntensity = AI_CALLBACK(skirmishAiCallback_WeaponDef_getMinIntensity);
+	callback->WeaponDef_getHeightBoostFactor = AI_CALLBACK(skirmishAiCallback_WeaponDef_getHeightBoostFactor);
+	callback->WeaponDef_getProximityPriority = AI_CALLBACK(skirmishAiCallback_WeaponDef_getProximityPriority);
+	callback->WeaponDef_getCollisionFlags = AI_CALLBACK(skirmishAiCallback_WeaponDef_getCollisionFlags);
+	callback->WeaponDef_isSweepFire = AI_CALLBACK(skirmishAiCallback_WeaponDef_isSweepFire);
+	callback->WeaponDef_isAbleToAttackGround = AI_CALLBACK(skirmishAiCallback_WeaponDef_isAbleToAttackGround);
+	callback->WeaponDef_getCameraShake = AI_CALLBACK(skirmishAiCallback_WeaponDef_getCameraShake);
+	callback->WeaponDef_getDynDamageExp = AI_CALLBACK(skirmishAiCallback_WeaponDef_getDynDamageExp);
+	callback->WeaponDef_getDynDamageMin = AI_CALLBACK(skirmishAiCallback_WeaponDef_getDynDamageMin);
+	callback->WeaponDef_getDynDamageRange = AI_CALLBACK(skirmishAiCallback_WeaponDef_getDynDamageRange);
+	callback->WeaponDef_isDynDamageInverted = AI_CALLBACK(skirmishAiCallback_WeaponDef_isDynDamageInverted);
+	callback->WeaponDef_getCustomParams = AI_CALLBACK(skirmishAiCallback_WeaponDef_getCustomParams);
+	callback->Unit_Weapon_getDef = AI_CALLBACK(skirmishAiCallback_Unit_Weapon_getDef);
+	callback->Unit_Weapon_getReloadFrame = AI_CALLBACK(skirmishAiCallback_Unit_Weapon_getReloadFrame);
+	callback->Unit_Weapon_getReloadTime = AI_CALLBACK(skirmishAiCallback_Unit_Weapon_getReloadTime);
+	callback->Unit_Weapon_getRange = AI_CALLBACK(skirmishAiCallback_Unit_Weapon_getRange);
+	callback->Unit_Weapon_isShieldEnabled = AI_CALLBACK(skirmishAiCallback_Unit_Weapon_isShieldEnabled);
+	callback->Unit_Weapon_getShieldPower = AI_CALLBACK(skirmishAiCallback_Unit_Weapon_getShieldPower);
+	callback->Debug_GraphDrawer_isEnabled = AI_CALLBACK(skirmishAiCallback_Debug_GraphDrawer_isEnabled);
 }
 
 SSkirmishAICallback* skirmishAiCallback_getInstanceFor(
 	int skirmishAIId,
 	int teamId,
 	CAICallback* aiCallback,
-	CAICheats* aiCheats
+	CAICheats* aiCheats,
+	bool lockCallbacks
 ) {
 	skirmishAIId_callback[skirmishAIId]      = aiCallback;
 	skirmishAIId_cheatCallback[skirmishAIId] = aiCheats;
@@ -5946,7 +6050,7 @@ SSkirmishAICallback* skirmishAiCallback_getInstanceFor(
 	skirmishAIId_teamId[skirmishAIId]        = teamId;
 
 	skirmishAIId_cCallback[skirmishAIId].reset(new SSkirmishAICallback());
-	skirmishAiCallback_init(skirmishAIId_cCallback[skirmishAIId].get());
+	skirmishAiCallback_init(skirmishAIId_cCallback[skirmishAIId].get(), lockCallbacks);
 
 	return skirmishAIId_cCallback[skirmishAIId].get();
 }
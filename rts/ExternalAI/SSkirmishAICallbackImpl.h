@@ -692,6 +692,16 @@ EXPORT(int              ) skirmishAiCallback_getTeamUnits(int skirmishAIId, int*
 
 EXPORT(int              ) skirmishAiCallback_getSelectedUnits(int skirmishAIId, int* unitIds, int unitIds_sizeMax);
 
+EXPORT(int              ) skirmishAiCallback_getUnitsPos(int skirmishAIId, int* unitIds, int unitIds_size, float* positions_AposF3, int positions_AposF3_sizeMax);
+
+EXPORT(int              ) skirmishAiCallback_getUnitsVel(int skirmishAIId, int* unitIds, int unitIds_size, float* velocities_AposF3, int velocities_AposF3_sizeMax);
+
+EXPORT(int              ) skirmishAiCallback_getUnitsHealth(int skirmishAIId, int* unitIds, int unitIds_size, float* healths, int healths_sizeMax);
+
+EXPORT(int              ) skirmishAiCallback_getUnitsDef(int skirmishAIId, int* unitIds, int unitIds_size, int* unitDefIds, int unitDefIds_sizeMax);
+
+EXPORT(int              ) skirmishAiCallback_getUnitsCurrentCommand(int skirmishAIId, int* unitIds, int unitIds_size, int* commandIds, int commandIds_sizeMax);
+
 EXPORT(int              ) skirmishAiCallback_Unit_getDef(int skirmishAIId, int unitId);
 
 EXPORT(float            ) skirmishAiCallback_Unit_getRulesParamFloat(int skirmishAIId, int unitId, const char* rulesParamName, float defaultValue);
@@ -1368,9 +1378,11 @@ class CAICheats;
 
 /**
  * Create the C Skirmish AI callback instance for a specific AI.
+ * @param lockCallbacks serialize all entry-points, required if the AI
+ *   is updated on its own thread
  * @see skirmishAiCallback_release
  */
-SSkirmishAICallback* skirmishAiCallback_getInstanceFor(int skirmishAIId, int teamId, CAICallback* aiCallback, CAICheats* aiCheats);
+SSkirmishAICallback* skirmishAiCallback_getInstanceFor(int skirmishAIId, int teamId, CAICallback* aiCallback, CAICheats* aiCheats, bool lockCallbacks);
 
 /**
  * Releases the C Skirmish AI callback instance for a specific AI.
@@ -25,11 +25,13 @@ CR_REG_METADATA(CSkirmishAIHandler, (
 	CR_MEMBER(id_dieReason),
 	CR_MEMBER(id_libKey),
 	CR_MEMBER(gameInitialized),
-	CR_MEMBER(luaAIShortNames),
-	CR_IGNORED(currentAIId)
+	CR_MEMBER(luaAIShortNames)
 ))
 
 
+thread_local unsigned char CSkirmishAIHandler::currentAIId = MAX_AIS;
+
+
 // not extern'ed, so static
 static CSkirmishAIHandler* gSkirmishAIHandler = nullptr;
 
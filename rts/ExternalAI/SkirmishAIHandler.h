@@ -181,6 +181,7 @@ public:
 
 	const std::set<std::string>& GetLuaAIImplShortNames() const { return luaAIShortNames; }
 
+	// per-thread; AIs updated concurrently (AIThreadedUpdate) each set their own
 	unsigned char GetCurrentAIID() { return currentAIId; }
 	void SetCurrentAIID(unsigned char id) { currentAIId = id; }
 
@@ -209,8 +210,8 @@ private:
 
 	std::set<std::string> luaAIShortNames;
 
-	// the current local AI ID that is executing, MAX_AIS if none (e.g. LuaUI)
-	unsigned char currentAIId;
+	// the current local AI ID that is executing on this thread, MAX_AIS if none (e.g. LuaUI)
+	static thread_local unsigned char currentAIId;
 
 	bool gameInitialized;
 };
@@ -25,6 +25,8 @@
 #include "System/FileSystem/FileQueryFlags.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/Log/ILog.h"
+#include "System/myMath.h"
+#include "System/Platform/Threading.h"
 #include "System/TimeProfiler.h"
 #include "System/StringUtil.h"
 
@@ -45,6 +47,16 @@ CR_REG_METADATA(CSkirmishAIWrapper, (
 	CR_IGNORED(cheats),
 
 	CR_MEMBER(timerName),
+	CR_MEMBER(timerHash),
+
+	CR_IGNORED(updateThread),
+	CR_IGNORED(updateMutex),
+	CR_IGNORED(updateCond),
+	CR_IGNORED(lastUpdateTime),
+	CR_IGNORED(avgUpdateTime),
+	CR_IGNORED(lastUpdateStart),
+	CR_IGNORED(updateFrame),
+	CR_IGNORED(updateThreadQuit),
 
 	CR_MEMBER(skirmishAIId),
 	CR_MEMBER(teamId),
@@ -66,6 +78,9 @@ CSkirmishAIWrapper::CSkirmishAIWrapper():
 	library(nullptr),
 	sCallback(nullptr),
 
+	updateFrame(-1),
+	updateThreadQuit(false),
+
 	skirmishAIId(-1),
 	teamId(-1),
 
@@ -82,6 +97,9 @@ CSkirmishAIWrapper::CSkirmishAIWrapper(const int skirmishAIId):
 	library(nullptr),
 	sCallback(nullptr),
 
+	updateFrame(-1),
+	updateThreadQuit(false),
+
 	skirmishAIId(skirmishAIId),
 	teamId(-1),
 
@@ -101,6 +119,7 @@ CSkirmishAIWrapper::CSkirmishAIWrapper(const int skirmishAIId):
 	timerName += (" id:" + IntToString(skirmishAIId));
 	timerName += (" " + key.GetShortName());
 	timerName += (" " + key.GetVersion());
+	timerHash = ProfilerZoneHash(timerName.c_str());
 
 	CreateCallback();
 }
@@ -109,15 +128,17 @@ void CSkirmishAIWrapper::CreateCallback() {
 	callback.reset(new CAICallback(teamId));
 	cheats.reset(new CAICheats(this));
 
-	sCallback = skirmishAiCallback_getInstanceFor(skirmishAIId, teamId, callback.get(), cheats.get());
+	sCallback = skirmishAiCallback_getInstanceFor(skirmishAIId, teamId, callback.get(), cheats.get(), CEngineOutHandler::IsThreadedUpdate());
 }
 
 CSkirmishAIWrapper::~CSkirmishAIWrapper() {
+	StopUpdateThread();
+
 	// send release event
 	Release(skirmishAIHandler.GetLocalSkirmishAIDieReason(skirmishAIId));
 
 	{
-		SCOPED_TIMER(timerName.c_str());
+		ScopedTimer timer(timerName.c_str(), timerHash);
 
 		if (initOk)
 			library->Release(skirmishAIId);
@@ -148,7 +169,7 @@ void CSkirmishAIWrapper::PostLoad() {
 
 bool CSkirmishAIWrapper::LoadSkirmishAI(bool postLoad) {
 	{
-		SCOPED_TIMER(timerName.c_str());
+		ScopedTimer timer(timerName.c_str(), timerHash);
 
 		library = IAILibraryManager::GetInstance()->FetchSkirmishAILibrary(key);
 
@@ -410,8 +431,97 @@ void CSkirmishAIWrapper::EnemyDamaged(
 }
 
 void CSkirmishAIWrapper::Update(int frame) {
+	const spring_time t0 = spring_gettime();
 	const SUpdateEvent evtData = {frame};
+
 	HandleEvent(EVENT_UPDATE, &evtData);
+	SetUpdateTime(spring_gettime() - t0);
+}
+
+void CSkirmishAIWrapper::UpdateAsync(int frame) {
+	if (!updateThread.joinable())
+		StartUpdateThread();
+
+	{
+		std::lock_guard<spring::mutex> lock(updateMutex);
+		assert(updateFrame == -1);
+		updateFrame = frame;
+	}
+
+	updateCond.notify_all();
+}
+
+void CSkirmishAIWrapper::WaitForUpdate() {
+	{
+		std::unique_lock<spring::mutex> lock(updateMutex);
+		updateCond.wait(lock, [&]() { return (updateFrame == -1); });
+	}
+
+	// ScopedTimer is not thread-safe, so the update-thread only measures its
+	// Update and the per-AI timer is charged here on behalf of it (the same
+	// thing SCOPED_TIMER in HandleEvent records for synchronous updates)
+	profiler.AddTime(timerName.c_str(), timerHash, lastUpdateStart, lastUpdateTime);
+
+	if (profiler.IsTracing())
+		profiler.AddTraceEvent(timerName.c_str(), timerHash, lastUpdateStart, lastUpdateStart + lastUpdateTime);
+}
+
+void CSkirmishAIWrapper::StartUpdateThread() {
+	updateThreadQuit = false;
+	updateThread = spring::thread(std::bind(&CSkirmishAIWrapper::UpdateThreadFunc, this));
+}
+
+void CSkirmishAIWrapper::StopUpdateThread() {
+	if (!updateThread.joinable())
+		return;
+
+	{
+		std::lock_guard<spring::mutex> lock(updateMutex);
+		updateThreadQuit = true;
+	}
+
+	updateCond.notify_all();
+	updateThread.join();
+}
+
+void CSkirmishAIWrapper::UpdateThreadFunc() {
+	Threading::SetThreadName("ai-" + IntToString(skirmishAIId));
+
+	while (true) {
+		int frame = -1;
+
+		{
+			std::unique_lock<spring::mutex> lock(updateMutex);
+			updateCond.wait(lock, [&]() { return (updateThreadQuit || updateFrame != -1); });
+
+			if (updateThreadQuit)
+				return;
+
+			frame = updateFrame;
+		}
+
+		const spring_time t0 = spring_gettime();
+		const SUpdateEvent evtData = {frame};
+
+		// sets this thread's current AI id for the callbacks made by the AI
+		if (!dieing)
+			library->HandleEvent(skirmishAIId, EVENT_UPDATE, &evtData);
+
+		lastUpdateStart = t0;
+		SetUpdateTime(spring_gettime() - t0);
+
+		{
+			std::lock_guard<spring::mutex> lock(updateMutex);
+			updateFrame = -1;
+		}
+
+		updateCond.notify_all();
+	}
+}
+
+void CSkirmishAIWrapper::SetUpdateTime(spring_time dt) {
+	lastUpdateTime = dt;
+	avgUpdateTime = spring_msecs(mix(avgUpdateTime.toMilliSecsf(), dt.toMilliSecsf(), 0.05f));
 }
 
 void CSkirmishAIWrapper::SendChatMessage(const char* msg, int fromPlayerId) {
@@ -461,7 +571,7 @@ void CSkirmishAIWrapper::SeismicPing(
 
 
 int CSkirmishAIWrapper::HandleEvent(int topic, const void* data) const {
-	SCOPED_TIMER(timerName.c_str());
+	ScopedTimer timer(timerName.c_str(), timerHash);
 
 	if (!dieing || (topic == EVENT_RELEASE))
 		return library->HandleEvent(skirmishAIId, topic, data);
@@ -6,6 +6,8 @@
 #include "System/Object.h"
 #include "SkirmishAIKey.h"
 #include "System/Platform/SharedLib.h"
+#include "System/Misc/SpringTime.h"
+#include "System/Threading/SpringThreading.h"
 
 #include <map>
 #include <string>
@@ -92,6 +94,19 @@ public:
 	void CommandFinished(int unitId, int commandId, int commandTopicId);
 	void SeismicPing(int allyTeam, int unitId, const float3& pos, float strength);
 
+	/**
+	 * Threaded update mode (see AIThreadedUpdate): UpdateAsync hands the
+	 * Update event to this AI's own thread, the caller must WaitForUpdate
+	 * before sending any other event or letting the simulation continue.
+	 */
+	void UpdateAsync(int frame);
+	void WaitForUpdate();
+
+	/// wall-clock time spent in the most recent Update event
+	spring_time GetLastUpdateTime() const { return lastUpdateTime; }
+	/// exponential moving average of the Update event times
+	spring_time GetAvgUpdateTime() const { return avgUpdateTime; }
+
 	int GetSkirmishAIID() const { return skirmishAIId; }
 	int GetTeamId() const { return teamId; }
 	const SkirmishAIKey& GetKey() const { return key; }
@@ -107,6 +122,11 @@ private:
 	 */
 	int HandleEvent(int topic, const void* data) const;
 
+	void StartUpdateThread();
+	void StopUpdateThread();
+	void UpdateThreadFunc();
+	void SetUpdateTime(spring_time dt);
+
 private:
 	SkirmishAIKey key;
 
@@ -117,6 +137,21 @@ private:
 	std::unique_ptr<CAICheats> cheats;
 
 	std::string timerName;
+	unsigned int timerHash;
+
+	spring::thread updateThread;
+	spring::mutex updateMutex;
+	spring::condition_variable updateCond;
+
+	spring_time lastUpdateTime;
+	spring_time avgUpdateTime;
+	/// when the update-thread last started processing an Update event
+	spring_time lastUpdateStart;
+
+	/// frame the update-thread should process next, -1 if none is pending
+	int updateFrame;
+
+	bool updateThreadQuit;
 
 
 	int skirmishAIId;
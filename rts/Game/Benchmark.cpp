@@ -1,5 +1,6 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
+#include <algorithm>
 #include <vector>
 #include <cstdio>
 
@@ -14,22 +15,32 @@
 #include "Sim/Units/UnitHandler.h"
 #include "Sim/Features/FeatureHandler.h"
 #include "System/TimeProfiler.h"
+#include "System/Log/ILog.h"
 
 bool CBenchmark::enabled = false;
 int CBenchmark::startFrame = 0;
 int CBenchmark::endFrame = 5 * 60 * GAME_SPEED;
+std::string CBenchmark::jsonFile;
 
 
 CBenchmark::CBenchmark()
 	: CEventClient("[CBenchmark]", 271990, false)
+	, numSampledFrames(0)
 {
 	eventHandler.AddClient(this);
+
+	// non-special timers are no-ops unless the profiler is enabled
+	if (!jsonFile.empty())
+		profiler.SetEnabled(true);
 }
 
 CBenchmark::~CBenchmark()
 {
 	eventHandler.RemoveClient(this);
 
+	if (!jsonFile.empty())
+		WriteTimerStats();
+
 	FILE* pFile = fopen("benchmark.data", "w");
 	std::map<float, float>::const_iterator rit = realFPS.cbegin();
 	std::map<float, float>::const_iterator dit = drawFPS.cbegin();
@@ -68,6 +79,19 @@ CBenchmark::~CBenchmark()
 
 void CBenchmark::GameFrame(int gameFrame)
 {
+	if (!jsonFile.empty()) {
+		// sim-only regression runs replay everything at maximum speed
+		if (gameFrame == 0) {
+			std::vector<string> cmds;
+			cmds.push_back("@@setmaxspeed 100");
+			cmds.push_back("@@setminspeed 100");
+			guihandler->RunCustomCommands(cmds, false);
+		}
+
+		gu->globalQuit |= (gameFrame == endFrame);
+		return;
+	}
+
 	if (gameFrame == 0 && (startFrame - 15 * GAME_SPEED > 0)) {
 		std::vector<string> cmds;
 		cmds.push_back("@@setmaxspeed 100");
@@ -100,3 +124,112 @@ void CBenchmark::DrawWorld()
 		drawFPS[game->lastSimFrame + globalRendering->timeOffset] = (gu->avgDrawFrameTime == 0.0f)? 0.0f: 1000.0f / gu->avgDrawFrameTime;
 	}
 }
+
+
+void CBenchmark::DbgTimingInfo(DbgTimingInfoType type, const spring_time start, const spring_time end)
+{
+	if (jsonFile.empty() || type != TIMING_SIM)
+		return;
+
+	// sent once the "Sim" timer of the frame has closed, so each sample
+	// holds the times of the frame that just ended; the one taken after
+	// the frame preceding startFrame only provides the initial totals
+	if (gs->frameNum >= (startFrame - 1))
+		SampleTimers();
+}
+
+
+void CBenchmark::SampleTimers()
+{
+	// the change in a timer's total since the last call is its time in the
+	// sim-frame that just finished (see DbgTimingInfo)
+	const bool firstSample = timerTotals.empty();
+
+	profiler.ToggleLock(true);
+
+	for (const auto& p: profiler.profile) {
+		spring_time& prevTotal = timerTotals[p.first];
+		std::vector<float>& samples = timerSamples[p.first];
+
+		if (!firstSample) {
+			// timers that first ran in this frame get zeros for all earlier ones
+			samples.resize(numSampledFrames, 0.0f);
+			samples.push_back((p.second.total - prevTotal).toMilliSecsf());
+		}
+
+		prevTotal = p.second.total;
+	}
+
+	profiler.ToggleLock(false);
+
+	numSampledFrames += (!firstSample);
+}
+
+// timer names are free-form, escape them like the profiler's trace writer
+static void WriteJsonString(FILE* file, const std::string& str)
+{
+	fputc('"', file);
+
+	for (const char c: str) {
+		if (c == '"' || c == '\\')
+			fputc('\\', file);
+		if (static_cast<unsigned char>(c) < 0x20)
+			continue;
+
+		fputc(c, file);
+	}
+
+	fputc('"', file);
+}
+
+void CBenchmark::WriteTimerStats() const
+{
+	FILE* file = fopen(jsonFile.c_str(), "w");
+
+	if (file == nullptr) {
+		LOG_L(L_ERROR, "[Benchmark::%s] could not open \"%s\"", __func__, jsonFile.c_str());
+		return;
+	}
+
+	const size_t numFrames = numSampledFrames;
+
+	fprintf(file, "{\n");
+	fprintf(file, "\t\"startFrame\": %d,\n", startFrame);
+	fprintf(file, "\t\"endFrame\": %d,\n", endFrame);
+	fprintf(file, "\t\"numFrames\": %u,\n", unsigned(numFrames));
+	fprintf(file, "\t\"timers\": {");
+
+	const char* sep = "\n";
+
+	// per-frame milliseconds; frames before a timer first ran count as zero
+	for (const auto& p: timerSamples) {
+		const std::string& name = profiler.GetTimerName(p.first);
+
+		if (name.empty() || numFrames == 0)
+			continue;
+
+		std::vector<float> samples = p.second;
+		samples.resize(numFrames, 0.0f);
+
+		std::sort(samples.begin(), samples.end());
+
+		float sum = 0.0f;
+
+		for (const float s: samples) {
+			sum += s;
+		}
+
+		const float p50 = samples[(numFrames - 1) * 50 / 100];
+		const float p99 = samples[(numFrames - 1) * 99 / 100];
+
+		fprintf(file, "%s\t\t", sep);
+		WriteJsonString(file, name);
+		fprintf(file, ": {\"mean\": %f, \"p50\": %f, \"p99\": %f, \"max\": %f}", sum / numFrames, p50, p99, samples.back());
+		sep = ",\n";
+	}
+
+	fprintf(file, "\n\t}\n}\n");
+	fclose(file);
+
+	LOG("[Benchmark::%s] wrote statistics of %u timers over %u frames to \"%s\"", __func__, unsigned(timerSamples.size()), unsigned(numFrames), jsonFile.c_str());
+}
@@ -4,8 +4,11 @@
 #define _ROAM_MESH_DRAWER_H_
 
 #include <map>
+#include <string>
+#include <vector>
 
 #include "System/EventHandler.h"
+#include "System/Misc/SpringTime.h"
 
 
 class CBenchmark : public CEventClient
@@ -14,6 +17,8 @@ public:
 	static bool enabled;
 	static int startFrame;
 	static int endFrame;
+	// if set, per-timer sim-frame statistics are written here as JSON
+	static std::string jsonFile;
 
 public:
 	CBenchmark();
@@ -27,17 +32,25 @@ public:
 		features.clear();
 		gameSpeed.clear();
 		luaUsage.clear();
+		timerSamples.clear();
+		timerTotals.clear();
+		numSampledFrames = 0;
 	}
 
 	// CEventClient interface
 	bool WantsEvent(const std::string& eventName) {
-		return (eventName == "GameFrame") || (eventName == "DrawWorld");
+		return (eventName == "GameFrame") || (eventName == "DrawWorld") || (eventName == "DbgTimingInfo");
 	}
 	bool GetFullRead() const { return true; }
 	int  GetReadAllyTeam() const { return AllAccessTeam; }
 
 	void GameFrame(int gameFrame);
 	void DrawWorld();
+	void DbgTimingInfo(DbgTimingInfoType type, const spring_time start, const spring_time end);
+
+private:
+	void SampleTimers();
+	void WriteTimerStats() const;
 
 private:
 	std::map<float, float> realFPS;
@@ -47,6 +60,13 @@ private:
 	std::map<int, size_t>  features;
 	std::map<int, float>   gameSpeed;
 	std::map<int, float>   luaUsage;
+
+	// milliseconds spent in each profiler timer per sim-frame, and the
+	// timer totals at the previous sample (keyed by timer name hash)
+	std::map<unsigned, std::vector<float>> timerSamples;
+	std::map<unsigned, spring_time> timerTotals;
+
+	size_t numSampledFrames;
 };
 
 #endif // _ROAM_MESH_DRAWER_H_
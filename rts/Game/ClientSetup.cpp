@@ -19,6 +19,8 @@ CONFIG(int, HostPortDefault).defaultValue(8452).minimumValue(0).maximumValue(655
 ClientSetup::ClientSetup()
 	: hostIP(configHandler->GetString("HostIPDefault"))
 	, hostPort(configHandler->GetInt("HostPortDefault"))
+	, autohostIP(configHandler->GetString("AutohostIP"))
+	, autohostPort(configHandler->GetInt("AutohostPort"))
 	, isHost(false)
 {
 }
@@ -66,9 +68,11 @@ void ClientSetup::LoadFromStartScript(const std::string& setup)
 	}
 	if (file.SGetValue(autohostip, "GAME\\AutohostIP")) {
 		configHandler->SetString("AutohostIP", autohostip, true);
+		autohostIP = autohostip;
 	}
 	if (file.SGetValue(autohostport, "GAME\\AutohostPort")) {
 		configHandler->SetString("AutohostPort", autohostport, true);
+		autohostPort = StringToInt(autohostport);
 	}
 
 	file.GetDef(saveFile, "", "GAME\\SaveFile");
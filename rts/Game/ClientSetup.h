@@ -27,6 +27,11 @@ public:
 	//! if this client is the server player, the port over which we accept incoming connections
 	int hostPort;
 
+	//! address of the autohost this game reports to (0 disables the interface)
+	//! kept per setup so several games hosted in one process can use different ones
+	std::string autohostIP;
+	int autohostPort;
+
 	bool isHost;
 };
 
@@ -4,6 +4,11 @@
 
 #include <SDL_keyboard.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
 #include "Game.h"
 #include "Benchmark.h"
 #include "Camera.h"
@@ -13,6 +18,7 @@
 #include "ConsoleHistory.h"
 #include "GameHelper.h"
 #include "GameSetup.h"
+#include "GameVersion.h"
 #include "GlobalUnsynced.h"
 #include "LoadScreen.h"
 #include "SelectedUnitsHandler.h"
@@ -80,6 +86,7 @@
 #include "Sim/Misc/Wind.h"
 #include "Sim/Misc/ResourceHandler.h"
 #include "Sim/MoveTypes/MoveDefHandler.h"
+#include "Sim/MoveTypes/MoveMath/MoveMath.h"
 #include "Sim/MoveTypes/MoveTypeFactory.h"
 #include "Sim/Path/IPathManager.h"
 #include "Sim/Projectiles/ExplosionGenerator.h"
@@ -107,6 +114,7 @@
 #include "UI/ProfileDrawer.h"
 #include "UI/Groups/GroupHandler.h"
 #include "System/Config/ConfigHandler.h"
+#include "System/CRC.h"
 #include "System/EventHandler.h"
 #include "System/Exceptions.h"
 #include "System/Sync/FPUCheck.h"
@@ -114,6 +122,11 @@
 #include "Net/GameServer.h"
 #include "Net/Protocol/NetProtocol.h"
 #include "System/SafeUtil.h"
+#include "System/StringUtil.h"
+#include "System/FileSystem/ArchiveScanner.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileHandler.h"
+#include "System/FileSystem/FileQueryFlags.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/LoadSave/LoadSaveHandler.h"
 #include "System/LoadSave/DemoRecorder.h"
@@ -128,6 +141,10 @@
 #undef CreateDirectory
 
 CONFIG(bool, GameEndOnConnectionLoss).defaultValue(true);
+CONFIG(int, DefsCacheMode).defaultValue(0).minimumValue(0).maximumValue(2).description(
+	"Whether the tables returned by gamedata/defs.lua are cached for later runs with identical game, map and options. "
+	"0 = disabled, 1 = enabled, 2 = always evaluate defs.lua and log whether the cached tables differ."
+);
 CONFIG(bool, WindowedEdgeMove).defaultValue(true).description("Sets whether moving the mouse cursor to the screen edge will move the camera across the map.");
 CONFIG(bool, FullscreenEdgeMove).defaultValue(true).description("see WindowedEdgeMove, just for fullscreen mode");
 CONFIG(bool, ShowFPS).defaultValue(false).description("Displays current framerate.");
@@ -479,6 +496,100 @@ void CGame::LoadMap(const std::string& mapName)
 }
 
 
+static std::string GetDefsCacheKey()
+{
+	// everything defs.lua can observe besides archive contents
+	typedef std::vector< std::pair<std::string, std::string> > OptionList;
+
+	OptionList modOptions(CGameSetup::GetModOptions().begin(), CGameSetup::GetModOptions().end());
+	OptionList mapOptions(CGameSetup::GetMapOptions().begin(), CGameSetup::GetMapOptions().end());
+
+	std::sort(modOptions.begin(), modOptions.end());
+	std::sort(mapOptions.begin(), mapOptions.end());
+
+	std::string cacheKey = SpringVersion::GetSync();
+
+	cacheKey += IntToString(archiveScanner->GetArchiveCompleteChecksum(gameSetup->modName), ";%08x");
+	cacheKey += IntToString(archiveScanner->GetArchiveCompleteChecksum(gameSetup->mapName), ";%08x");
+
+	for (const OptionList* options: {&modOptions, &mapOptions}) {
+		cacheKey += "|";
+
+		// length-prefixed, no two option sets can produce the same key
+		for (const auto& option: *options) {
+			cacheKey += ";" + IntToString(option.first.size()) + ":" + option.first;
+			cacheKey += "=" + IntToString(option.second.size()) + ":" + option.second;
+		}
+	}
+
+	return cacheKey;
+}
+
+static std::string GetDefsCacheFileName(const std::string& cacheKey)
+{
+	return (FileSystem::GetCacheDir() + "/defs/" + IntToString(CRC::GetCRC(cacheKey.data(), cacheKey.size()), "%08x") + ".bin");
+}
+
+// the key is stored in full, a checksum collision must not yield foreign defs
+static bool ReadDefsCache(const std::string& cacheKey, std::vector<std::uint8_t>& defsBlob)
+{
+	CFileHandler f(GetDefsCacheFileName(cacheKey), SPRING_VFS_RAW);
+
+	if (!f.FileExists())
+		return false;
+
+	std::vector<std::uint8_t> buffer(f.FileSize());
+	std::uint32_t header[3] = {0, 0, 0}; // key-size, blob-size, blob-checksum
+
+	if (buffer.size() < sizeof(header) || f.Read(buffer.data(), buffer.size()) != int(buffer.size()))
+		return false;
+
+	memcpy(&header[0], buffer.data(), sizeof(header));
+
+	if (header[0] != cacheKey.size() || (sizeof(header) + header[0] + header[1]) != buffer.size())
+		return false;
+	if (memcmp(&buffer[sizeof(header)], cacheKey.data(), cacheKey.size()) != 0)
+		return false;
+
+	defsBlob.assign(buffer.begin() + sizeof(header) + header[0], buffer.end());
+	return (CRC::GetCRC(defsBlob.data(), defsBlob.size()) == header[2]);
+}
+
+static bool WriteDefsCache(const std::string& cacheKey, const std::vector<std::uint8_t>& defsBlob)
+{
+	const std::string& cacheFileName = GetDefsCacheFileName(cacheKey);
+
+	if (!FileSystem::CreateDirectory(FileSystem::GetDirectory(cacheFileName)))
+		return false;
+
+	const std::string filePath = dataDirsAccess.LocateFile(cacheFileName, FileQueryFlags::WRITE);
+	const std::string tempPath = filePath + ".tmp";
+
+	const std::uint32_t header[3] = {std::uint32_t(cacheKey.size()), std::uint32_t(defsBlob.size()), CRC::GetCRC(defsBlob.data(), defsBlob.size())};
+
+	{
+		std::ofstream ofs(tempPath.c_str(), std::ios::out | std::ios::binary);
+
+		ofs.write(reinterpret_cast<const char*>(&header[0]), sizeof(header));
+		ofs.write(cacheKey.data(), cacheKey.size());
+		ofs.write(reinterpret_cast<const char*>(defsBlob.data()), defsBlob.size());
+
+		if (!ofs.good()) {
+			ofs.close();
+			std::remove(tempPath.c_str());
+			return false;
+		}
+	}
+
+	// concurrently starting processes (e.g. autohost spawns) race harmlessly
+	if (std::rename(tempPath.c_str(), filePath.c_str()) != 0) {
+		std::remove(tempPath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
 void CGame::LoadDefs()
 {
 	ENTER_SYNCED_CODE();
@@ -499,9 +610,40 @@ void CGame::LoadDefs()
 		defsParser->AddFunc("GetMapOptions", LuaSyncedRead::GetMapOptions);
 		defsParser->EndTable();
 
-		// run the parser
-		if (!defsParser->Execute())
-			throw content_error("Defs-Parser: " + defsParser->GetErrorLog());
+		const int defsCacheMode = configHandler->GetInt("DefsCacheMode");
+		const std::string& defsCacheKey = (defsCacheMode != 0)? GetDefsCacheKey(): "";
+
+		std::vector<std::uint8_t> cachedDefs;
+		std::vector<std::uint8_t> parsedDefs;
+
+		// parses that drew from gsRNG are never cached (see below), so a blob
+		// for this key implies defs.lua does not touch the RNG and skipping it
+		// leaves gsRNG in the same state as on clients that evaluate it
+		const bool haveCachedDefs = (defsCacheMode != 0 && ReadDefsCache(defsCacheKey, cachedDefs));
+
+		if (defsCacheMode == 1 && haveCachedDefs && defsParser->ExecuteBlob(cachedDefs)) {
+			LOG("[Game::%s] restored cached gamedata definitions (%u bytes)", __func__, unsigned(cachedDefs.size()));
+		} else {
+			// run the parser
+			if (!defsParser->Execute())
+				throw content_error("Defs-Parser: " + defsParser->GetErrorLog());
+
+			if (defsCacheMode != 0 && defsParser->UsedSyncedRandom()) {
+				// the tables depend on the game seed and restoring them would not advance gsRNG
+				LOG("[Game::%s] gamedata definitions use math.random, not caching them", __func__);
+			} else if (defsCacheMode != 0 && defsParser->SerializeRoot(parsedDefs)) {
+				if (haveCachedDefs && defsCacheMode == 2) {
+					if (parsedDefs != cachedDefs) {
+						LOG_L(L_WARNING, "[Game::%s] cached gamedata definitions differ from evaluated defs.lua (%u vs. %u bytes)", __func__, unsigned(cachedDefs.size()), unsigned(parsedDefs.size()));
+					} else {
+						LOG("[Game::%s] cached gamedata definitions match evaluated defs.lua", __func__);
+					}
+				}
+
+				if (parsedDefs != cachedDefs && !WriteDefsCache(defsCacheKey, parsedDefs))
+					LOG_L(L_WARNING, "[Game::%s] could not cache gamedata definitions", __func__);
+			}
+		}
 
 		const LuaTable& root = defsParser->GetRoot();
 
@@ -602,6 +744,9 @@ void CGame::PostLoadSimulation()
 	//   --> need a way to let Lua flush it or re-calculate map
 	//   checksum (over heightmap + blockmap, not raw archive)
 	mapDamage = IMapDamage::GetMapDamage();
+
+	// PFS precomputation reads positional speed-mods for every square
+	CMoveMath::InitSpeedModRasters();
 	pathManager = IPathManager::GetInstance(modInfo.pathFinderSystem);
 
 	// load map-specific features
@@ -898,6 +1043,7 @@ void CGame::KillSimulation()
 
 	LOG("[Game::%s][3]", __func__);
 	IPathManager::FreeInstance(pathManager);
+	CMoveMath::FreeSpeedModRasters();
 
 	spring::SafeDelete(readMap);
 	spring::SafeDelete(smoothGround);
@@ -1557,6 +1703,9 @@ void CGame::SimFrame() {
 	gs->frameNum += 1;
 	lastFrameTime = spring_gettime();
 
+	// starts or finishes a /profiletrace capture
+	profiler.SetTraceFrame(gs->frameNum);
+
 	// clear allocator statistics periodically
 	// note: allocator itself should do this (so that
 	// stats are reliable when paused) but see LuaUser
@@ -1589,28 +1738,51 @@ void CGame::SimFrame() {
 		SCOPED_SPECIAL_TIMER("Sim");
 		{
 			SCOPED_TIMER("Sim::GameFrame");
+			SCOPED_SYNC_LANE(SYNC_LANE_LUA);
 			eventHandler.GameFrame(gs->frameNum);
 		}
 		helper->Update();
-		mapDamage->Update();
-		pathManager->Update();
-		unitHandler->Update();
-		projectileHandler->Update();
-		featureHandler->Update();
+		{
+			SCOPED_SYNC_LANE(SYNC_LANE_MAPDAMAGE);
+			mapDamage->Update();
+		}
+		{
+			SCOPED_SYNC_LANE(SYNC_LANE_PATH);
+			pathManager->Update();
+		}
+		{
+			SCOPED_SYNC_LANE(SYNC_LANE_UNITS);
+			unitHandler->Update();
+		}
+		{
+			SCOPED_SYNC_LANE(SYNC_LANE_PROJECTILES);
+			projectileHandler->Update();
+		}
+		{
+			SCOPED_SYNC_LANE(SYNC_LANE_FEATURES);
+			featureHandler->Update();
+		}
 		{
 			SCOPED_TIMER("Sim::Script");
+			SCOPED_SYNC_LANE(SYNC_LANE_UNITS);
 			unitScriptEngine->Tick(33);
 		}
 		wind.Update();
-		losHandler->Update();
+		{
+			SCOPED_SYNC_LANE(SYNC_LANE_LOS);
+			losHandler->Update();
+		}
 		// dead ghosts have to be updated in sim, after los,
 		// to make sure they represent the current knowledge correctly.
 		// should probably be split from drawer
 		unitDrawer->UpdateGhostedBuildings();
 		interceptHandler.Update(false);
 
-		teamHandler->GameFrame(gs->frameNum);
-		playerHandler->GameFrame(gs->frameNum);
+		{
+			SCOPED_SYNC_LANE(SYNC_LANE_TEAMS);
+			teamHandler->GameFrame(gs->frameNum);
+			playerHandler->GameFrame(gs->frameNum);
+		}
 	}
 
 	lastSimFrameTime = spring_gettime();
@@ -335,9 +335,12 @@ void CGameHelper::Explosion(const CExplosionParams& params) {
 /**
  * @brief Generic spatial unit query.
  *
- * Filter should implement two methods:
+ * Filter should implement three methods:
  *  - bool Team(int allyTeam): returns true if this allyteam should be considered
  *  - bool Unit(const CUnit*): returns true if the unit should be returned
+ *  - unsigned int Categories(): units must have one of these category bits for
+ *    Unit to possibly accept them (all bits set means any unit); allows skipping
+ *    per-allyteam quad lists that hold no such unit without visiting their units
  *
  * Query should implement three methods:
  *  - float3 GetPos(): returns the center of the (circular) search area
@@ -354,13 +357,19 @@ static inline void QueryUnits(TFilter filter, TQuery& query)
 	QuadFieldQuery qfQuery;
 	quadField->GetQuads(qfQuery, query.pos, query.radius);
 	const int tempNum = gs->GetTempNum();
+	const unsigned int categoryMask = filter.Categories();
 
 	for (int t = 0; t < teamHandler->ActiveAllyTeams(); ++t) { //FIXME
 		if (!filter.Team(t))
 			continue;
 
 		for (const int qi: *qfQuery.quads) {
-			const auto& allyTeamUnits = quadField->GetQuad(qi).teamUnits[t];
+			const CQuadField::Quad& quad = quadField->GetQuad(qi);
+
+			if (categoryMask != -1u && (quad.teamCategories[t] & categoryMask) == 0)
+				continue;
+
+			const auto& allyTeamUnits = quad.teamUnits[t];
 
 			for (CUnit* u: allyTeamUnits) {
 				if (u->tempNum == tempNum)
@@ -388,6 +397,7 @@ namespace {
 		{
 			const int searchAllyteam;
 			Base(int at) : searchAllyteam(at) {}
+			unsigned int Categories() const { return -1u; }
 		};
 
 		/**
@@ -448,6 +458,7 @@ namespace {
 		struct Friendly_All_Plus_Enemy_InLos_NOT_SYNCED
 		{
 			bool Team(int) const { return true; }
+			unsigned int Categories() const { return -1u; }
 			bool Unit(const CUnit* u) const {
 				return (u->allyteam == gu->myAllyTeam) ||
 					   (u->losStatus[gu->myAllyTeam] & (LOS_INLOS | LOS_INRADAR)) ||
@@ -468,8 +479,18 @@ namespace {
 		{
 			const CMobileCAI* const cai;
 
+			unsigned int targetCategories;
+
 			Enemy_InLos_ValidTarget(int at, const CMobileCAI* cai) :
-				Enemy_InLos(nullptr, at), cai(cai) {}
+				Enemy_InLos(nullptr, at), cai(cai), targetCategories(0)
+			{
+				// IsValidTarget needs at least one weapon able to target the unit
+				for (const CWeapon* w: cai->owner->weapons) {
+					targetCategories |= w->onlyTargetCategory;
+				}
+			}
+
+			unsigned int Categories() const { return targetCategories; }
 
 			bool Unit(const CUnit* u) {
 				return Enemy_InLos::Unit(u) && cai->IsValidTarget(u);
@@ -655,7 +676,13 @@ void CGameHelper::GenerateWeaponTargets(const CWeapon* weapon, const CUnit* avoi
 			continue;
 
 		for (const int qi: *qfQuery.quads) {
-			const std::vector<CUnit*>& allyTeamUnits = quadField->GetQuad(qi).teamUnits[t];
+			const CQuadField::Quad& quad = quadField->GetQuad(qi);
+
+			// TestTarget rejects units outside the weapon's target categories
+			if ((quad.teamCategories[t] & weapon->onlyTargetCategory) == 0)
+				continue;
+
+			const std::vector<CUnit*>& allyTeamUnits = quad.teamUnits[t];
 
 			for (CUnit* targetUnit: allyTeamUnits) {
 				if (targetUnit->tempNum == tempNum)
@@ -538,13 +538,18 @@ void CEndGameBox::FillTeamStats()
 	stats.emplace_back("Damage Dealt");
 	stats.emplace_back("Damage Received");
 
+	std::vector<TeamStatistics> statHistory;
+
 	for (int team = 0; team < teamHandler->ActiveTeams(); team++) {
 		const CTeam* pteam = teamHandler->Team(team);
 
 		if (pteam->gaia)
 			continue;
 
-		for (auto si = pteam->statHistory.cbegin(); si != pteam->statHistory.cend(); ++si) {
+		statHistory.clear();
+		pteam->statHistory.GetRange(0, pteam->statHistory.size(), statHistory);
+
+		for (auto si = statHistory.cbegin(); si != statHistory.cend(); ++si) {
 			stats[ 0].AddStat(team, 0);
 
 			stats[ 1].AddStat(team, si->metalUsed);
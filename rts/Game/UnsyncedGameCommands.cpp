@@ -94,8 +94,11 @@
 #include "System/GlobalConfig.h"
 #include "System/SafeUtil.h"
 #include "System/TimeProfiler.h"
+#include "System/LogOutput.h"
 #include "System/Log/ILog.h"
 #include "System/Config/ConfigHandler.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileQueryFlags.h"
 #include "System/FileSystem/SimpleParser.h"
 #include "System/Sound/ISound.h"
 #include "System/Sound/ISoundChannels.h"
@@ -2940,7 +2943,7 @@ class DebugInfoActionExecutor : public IUnsyncedActionExecutor {
 public:
 	DebugInfoActionExecutor() : IUnsyncedActionExecutor(
 		"DebugInfo",
-		"Print debug info to the chat/log-file about either: sound, profiling"
+		"Print debug info to the chat/log-file about either: sound, profiling, log"
 	) {
 	}
 
@@ -2949,8 +2952,10 @@ public:
 			sound->PrintDebugInfo();
 		} else if (action.GetArgs() == "profiling") {
 			profiler.PrintProfilingInfo();
+		} else if (action.GetArgs() == "log") {
+			CLogOutput::LogAsyncInfo();
 		} else {
-			LOG_L(L_WARNING, "Give either of these as argument: sound, profiling");
+			LOG_L(L_WARNING, "Give either of these as argument: sound, profiling, log");
 		}
 		return true;
 	}
@@ -2958,6 +2963,34 @@ public:
 
 
 
+class ProfileTraceActionExecutor : public IUnsyncedActionExecutor {
+public:
+	ProfileTraceActionExecutor() : IUnsyncedActionExecutor(
+		"ProfileTrace",
+		"Records all profiler timers over the given number of sim-frames into a Chrome trace-event file, args: <numFrames> [fileName]"
+	) {
+	}
+
+	bool Execute(const UnsyncedAction& action) const {
+		const std::vector<std::string>& args = _local_strSpaceTokenize(action.GetArgs());
+
+		if (args.empty()) {
+			LOG_L(L_WARNING, "/%s: missing number of frames", GetCommand().c_str());
+			return false;
+		}
+
+		const int numFrames = std::max(1, StringToInt(args[0]));
+		const int begFrame = gs->frameNum + 1;
+
+		const std::string& fileName = (args.size() > 1)? args[1]: ("profile_" + IntToString(begFrame) + ".json");
+		const std::string& filePath = dataDirsAccess.LocateFile(fileName, FileQueryFlags::WRITE);
+
+		profiler.StartTrace(begFrame, begFrame + numFrames - 1, filePath);
+		return true;
+	}
+};
+
+
 class RedirectToSyncedActionExecutor : public IUnsyncedActionExecutor {
 public:
 	RedirectToSyncedActionExecutor(const std::string& command): IUnsyncedActionExecutor(
@@ -3295,6 +3328,7 @@ void UnsyncedGameCommands::AddDefaultActionExecutors() {
 	AddActionExecutor(new ReloadGameActionExecutor());
 	AddActionExecutor(new ReloadShadersActionExecutor());
 	AddActionExecutor(new DebugInfoActionExecutor());
+	AddActionExecutor(new ProfileTraceActionExecutor());
 
 	// XXX are these redirects really required?
 	AddActionExecutor(new RedirectToSyncedActionExecutor("ATM"));
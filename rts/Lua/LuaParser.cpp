@@ -52,6 +52,7 @@ LuaParser::LuaParser(const string& _fileName, const string& _fileModes, const st
 	, valid(false)
 	, lowerKeys(true)
 	, lowerCppKeys(true)
+	, usedSyncedRandom(false)
 {
 	// be on the safe side
 	D.synced = true;
@@ -77,6 +78,7 @@ LuaParser::LuaParser(const string& _textChunk, const string& _accessModes, const
 	, valid(false)
 	, lowerKeys(true)
 	, lowerCppKeys(true)
+	, usedSyncedRandom(false)
 {
 	// be on the safe side
 	D.synced = true;
@@ -244,6 +246,46 @@ bool LuaParser::Execute()
 }
 
 
+bool LuaParser::ExecuteBlob(const std::vector<std::uint8_t>& rootBlob)
+{
+	if (!IsValid()) {
+		errorLog = "could not initialize LUA library";
+		return false;
+	}
+
+	rootRef = LUA_NOREF;
+
+	assert(initDepth == 0);
+
+	// unlike Execute, leaves the state usable on failure so
+	// callers can still fall back to running the actual code
+	if (!LuaUtils::DeserializeTable(L, rootBlob)) {
+		errorLog = "invalid or corrupt table blob";
+		return false;
+	}
+
+	initDepth = -1;
+
+	rootRef = luaL_ref(L, LUA_REGISTRYINDEX);
+	lua_settop(L, 0);
+	valid = true;
+	return true;
+}
+
+bool LuaParser::SerializeRoot(std::vector<std::uint8_t>& rootBlob)
+{
+	if (!valid)
+		return false;
+
+	lua_rawgeti(L, LUA_REGISTRYINDEX, rootRef);
+
+	const bool ret = LuaUtils::SerializeTable(L, -1, rootBlob);
+
+	lua_pop(L, 1);
+	return ret;
+}
+
+
 void LuaParser::AddTable(LuaTable* tbl) { spring::VectorInsertUnique(tables, tbl); }
 void LuaParser::RemoveTable(LuaTable* tbl) { spring::VectorErase(tables, tbl); }
 
@@ -476,6 +518,7 @@ int LuaParser::Random(lua_State* L)
 {
 	// both US and DS depend on LuaParser via MapParser, etc
 	#if (!defined(UNITSYNC) && !defined(DEDICATED))
+	GetLuaParser(L)->usedSyncedRandom = true;
 	lua_pushnumber(L, gsRNG.NextFloat());
 	return 1;
 	#else
@@ -3,6 +3,7 @@
 #ifndef LUA_PARSER_H
 #define LUA_PARSER_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -126,7 +127,12 @@ public:
 	~LuaParser();
 
 	bool Execute();
+	// alternative to Execute, restores a root table serialized by SerializeRoot
+	bool ExecuteBlob(const std::vector<std::uint8_t>& rootBlob);
+	bool SerializeRoot(std::vector<std::uint8_t>& rootBlob);
 	bool IsValid() const { return (L != nullptr); }
+	// true if the parsed code drew from the synced RNG (its results depend on the game seed)
+	bool UsedSyncedRandom() const { return usedSyncedRandom; }
 
 	LuaTable GetRoot();
 	LuaTable SubTableExpr(const string& expr) {
@@ -182,6 +188,7 @@ private:
 	bool valid;
 	bool lowerKeys; // convert all returned keys to lower case
 	bool lowerCppKeys; // convert strings in arguments keys to lower case
+	bool usedSyncedRandom;
 
 	string errorLog;
 
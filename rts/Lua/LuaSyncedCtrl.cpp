@@ -44,6 +44,7 @@
 #include "Sim/Misc/QuadField.h"
 #include "Sim/Misc/BuildingMaskMap.h"
 #include "Sim/MoveTypes/AAirMoveType.h"
+#include "Sim/MoveTypes/MoveMath/MoveMath.h"
 #include "Sim/Path/IPathManager.h"
 #include "Sim/Projectiles/ExplosionGenerator.h"
 #include "Sim/Projectiles/Projectile.h"
@@ -1864,6 +1865,9 @@ int LuaSyncedCtrl::SetUnitLosState(lua_State* L)
 	const unsigned short state = (losStatus & 0xFF00) | newState;
 
 	unit->SetLosStatus(allyTeam, state);
+	// bits set outside the mask must still be cleaned up by the next
+	// LOS status update, even if none of the unit's inputs changed
+	unitHandler->InvalidateUnitLosStatus(unit);
 
 	return 0;
 }
@@ -4023,6 +4027,7 @@ int LuaSyncedCtrl::SetMapSquareTerrainType(lua_State* L)
 	const int ntt = luaL_checkint(L, 3);
 
 	readMap->GetTypeMapSynced()[tz * mapDims.hmapx + tx] = std::max(0, std::min(ntt, (CMapInfo::NUM_TERRAIN_TYPES - 1)));
+	CMoveMath::UpdateSpeedModRasters(SRectangle(hx, hz, hx, hz));
 	pathManager->TerrainChange(hx, hz,  hx + 1, hz + 1,  TERRAINCHANGE_SQUARE_TYPEMAP_INDEX);
 
 	lua_pushnumber(L, ott);
@@ -4059,8 +4064,10 @@ int LuaSyncedCtrl::SetTerrainTypeData(lua_State* L)
 	// hardness changes do not require repathing
 	if (ttHardnessChanged)
 		mapDamage->TerrainTypeHardnessChanged(tti);
-	if (ttSpeedModChanged)
+	if (ttSpeedModChanged) {
+		CMoveMath::UpdateSpeedModRasters(SRectangle(0, 0, mapDims.mapx - 1, mapDims.mapy - 1));
 		mapDamage->TerrainTypeSpeedModChanged(tti);
+	}
 
 	lua_pushboolean(L, true);
 	return 1;
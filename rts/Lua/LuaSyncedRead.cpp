@@ -1344,9 +1344,8 @@ int LuaSyncedRead::GetTeamStatsHistory(lua_State* L)
 		return 1;
 	}
 
-	const auto& teamStats = team->statHistory;
-	auto it = teamStats.cbegin();
-	const int statCount = teamStats.size();
+	const TeamStatisticsHistory& statHistory = team->statHistory;
+	const int statCount = statHistory.size();
 
 	int start = 0;
 	if ((args >= 2) && lua_isnumber(L, 2)) {
@@ -1360,15 +1359,17 @@ int LuaSyncedRead::GetTeamStatsHistory(lua_State* L)
 		end = max(0, min(statCount - 1, end));
 	}
 
-	std::advance(it, start);
+	// only decode the requested range
+	std::vector<TeamStatistics> teamStats;
+	statHistory.GetRange(start, end + 1, teamStats);
 
 	lua_newtable(L);
 	if (statCount > 0) {
 		int count = 1;
-		for (int i = start; i <= end; ++i, ++it) {
-			const TeamStatistics& stats = *it;
+		for (int i = start; i <= end; ++i) {
+			const TeamStatistics& stats = teamStats[i - start];
 			lua_newtable(L); {
-				if (i+1 == teamStats.size()) {
+				if (i+1 == statCount) {
 					// the `stats.frame` var indicates the frame when a new entry needs to get added,
 					// for the most recent stats entry this lies obviously in the future,
 					// so we just output the current frame here
@@ -2113,6 +2114,31 @@ static int ParseAllegiance(lua_State* L, const char* caller, int index)
 	return teamID;
 }
 
+// only visits the per-allyteam quad lists whose units can pass the allegiance test
+static void GetUnitsExactForAllegiance(lua_State* L, QuadFieldQuery& qfQuery, const float3& mins, const float3& maxs, int allegiance)
+{
+	const int readTeam = CLuaHandle::GetHandleReadTeam(L);
+	const int readAllyTeam = CLuaHandle::GetHandleReadAllyTeam(L);
+
+	switch (allegiance) {
+		case AllUnits: {
+			quadField->GetUnitsExact(qfQuery, mins, maxs);
+		} break;
+		case MyUnits: {
+			quadField->GetUnitsExact(qfQuery, mins, maxs, (readTeam >= 0)? teamHandler->AllyTeam(readTeam): -1, CQuadField::ALLYTEAM_ONLY);
+		} break;
+		case AllyUnits: {
+			quadField->GetUnitsExact(qfQuery, mins, maxs, readAllyTeam, CQuadField::ALLYTEAM_ONLY);
+		} break;
+		case EnemyUnits: {
+			quadField->GetUnitsExact(qfQuery, mins, maxs, readAllyTeam, CQuadField::ALLYTEAM_EXCEPT);
+		} break;
+		default: {
+			quadField->GetUnitsExact(qfQuery, mins, maxs, teamHandler->AllyTeam(allegiance), CQuadField::ALLYTEAM_ONLY);
+		} break;
+	}
+}
+
 
 int LuaSyncedRead::GetUnitsInRectangle(lua_State* L)
 {
@@ -2129,7 +2155,7 @@ int LuaSyncedRead::GetUnitsInRectangle(lua_State* L)
 #define RECTANGLE_TEST ; // no test, GetUnitsExact is sufficient
 
 	QuadFieldQuery qfQuery;
-	quadField->GetUnitsExact(qfQuery, mins, maxs);
+	GetUnitsExactForAllegiance(L, qfQuery, mins, maxs, allegiance);
 	const auto& units = (*qfQuery.units);
 
 	if (allegiance >= 0) {
@@ -2178,7 +2204,7 @@ int LuaSyncedRead::GetUnitsInBox(lua_State* L)
 	}
 
 	QuadFieldQuery qfQuery;
-	quadField->GetUnitsExact(qfQuery, mins, maxs);
+	GetUnitsExactForAllegiance(L, qfQuery, mins, maxs, allegiance);
 	const auto& units = (*qfQuery.units);
 
 	if (allegiance >= 0) {
@@ -2228,7 +2254,7 @@ int LuaSyncedRead::GetUnitsInCylinder(lua_State* L)
 	}                                           \
 
 	QuadFieldQuery qfQuery;
-	quadField->GetUnitsExact(qfQuery, mins, maxs);
+	GetUnitsExactForAllegiance(L, qfQuery, mins, maxs, allegiance);
 	const auto& units = (*qfQuery.units);
 
 	if (allegiance >= 0) {
@@ -2282,7 +2308,7 @@ int LuaSyncedRead::GetUnitsInSphere(lua_State* L)
 	}                                           \
 
 	QuadFieldQuery qfQuery;
-	quadField->GetUnitsExact(qfQuery, mins, maxs);
+	GetUnitsExactForAllegiance(L, qfQuery, mins, maxs, allegiance);
 	const auto& units = (*qfQuery.units);
 
 	if (allegiance >= 0) {
@@ -466,6 +466,8 @@ static int MoveDefTable(lua_State* L, const void* data)
 	HSTR_PUSH_NUMBER(L, "heatMod",       md->heatMod);
 	HSTR_PUSH_NUMBER(L, "heatProduced",  md->heatProduced);
 
+	HSTR_PUSH_BOOL(L, "cacheBlockChecks", md->cacheBlockChecks);
+
 	HSTR_PUSH_STRING(L, "name", md->name);
 
 	return 1;
@@ -2,6 +2,7 @@
 
 //#include "System/Platform/Win/win32.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "LuaUtils.h"
@@ -300,6 +301,212 @@ int LuaUtils::Restore(const std::vector<LuaUtils::DataDump> &backup, lua_State*
 }
 
 
+/******************************************************************************/
+/******************************************************************************/
+
+static bool SerializeData(lua_State* L, int index, int depth, std::vector<std::uint8_t>& blob);
+
+static void AppendBlob(std::vector<std::uint8_t>& blob, const void* data, size_t size) {
+	const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(data);
+	blob.insert(blob.end(), bytes, bytes + size);
+}
+
+static bool IsSerializableType(int type, bool isKey) {
+	switch (type) {
+		case LUA_TBOOLEAN:
+		case LUA_TNUMBER:
+		case LUA_TSTRING: return true;
+		case LUA_TTABLE : return !isKey;
+		default         : break;
+	}
+
+	return false;
+}
+
+static bool SerializeTable(lua_State* L, int index, int depth, std::vector<std::uint8_t>& blob) {
+	// also catches cycles
+	if (depth++ > maxDepth)
+		return false;
+
+	const int table = PosAbsLuaIndex(L, index);
+
+	// each pair is serialized separately and sorted by its key bytes
+	std::vector< std::pair< std::vector<std::uint8_t>, std::vector<std::uint8_t> > > pairs;
+
+	for (lua_pushnil(L); lua_next(L, table) != 0; lua_pop(L, 1)) {
+		// functions etc. are invisible to LuaTable anyway
+		if (!IsSerializableType(lua_type(L, -2), true) || !IsSerializableType(lua_type(L, -1), false))
+			continue;
+
+		pairs.emplace_back();
+
+		if (!SerializeData(L, -2, depth, pairs.back().first) || !SerializeData(L, -1, depth, pairs.back().second)) {
+			lua_pop(L, 2);
+			return false;
+		}
+	}
+
+	std::sort(pairs.begin(), pairs.end());
+
+	const std::uint32_t numPairs = pairs.size();
+
+	blob.push_back(LUA_TTABLE);
+	AppendBlob(blob, &numPairs, sizeof(numPairs));
+
+	for (const auto& pair: pairs) {
+		blob.insert(blob.end(), pair.first.begin(), pair.first.end());
+		blob.insert(blob.end(), pair.second.begin(), pair.second.end());
+	}
+
+	return true;
+}
+
+static bool SerializeData(lua_State* L, int index, int depth, std::vector<std::uint8_t>& blob) {
+	const int type = lua_type(L, index);
+
+	switch (type) {
+		case LUA_TBOOLEAN: {
+			blob.push_back(type);
+			blob.push_back(lua_toboolean(L, index));
+		} break;
+		case LUA_TNUMBER: {
+			// never lua_tolstring a number here, would confuse lua_next
+			const lua_Number num = lua_tonumber(L, index);
+
+			blob.push_back(type);
+			AppendBlob(blob, &num, sizeof(num));
+		} break;
+		case LUA_TSTRING: {
+			size_t len = 0;
+			const char* str = lua_tolstring(L, index, &len);
+			const std::uint32_t size = len;
+
+			blob.push_back(type);
+			AppendBlob(blob, &size, sizeof(size));
+			AppendBlob(blob, str, len);
+		} break;
+		case LUA_TTABLE: {
+			return (SerializeTable(L, index, depth, blob));
+		} break;
+		default: {
+			return false;
+		} break;
+	}
+
+	return true;
+}
+
+
+struct BlobReader {
+	bool Read(void* dst, size_t size) {
+		if (size > size_t(end - pos))
+			return false;
+
+		std::memcpy(dst, pos, size);
+		pos += size;
+		return true;
+	}
+
+	const std::uint8_t* pos;
+	const std::uint8_t* end;
+};
+
+static bool DeserializeData(lua_State* L, BlobReader& reader, int depth) {
+	std::uint8_t type = LUA_TNIL;
+
+	if (!reader.Read(&type, sizeof(type)))
+		return false;
+
+	switch (type) {
+		case LUA_TBOOLEAN: {
+			std::uint8_t bol = 0;
+
+			if (!reader.Read(&bol, sizeof(bol)))
+				return false;
+
+			lua_pushboolean(L, bol);
+		} break;
+		case LUA_TNUMBER: {
+			lua_Number num = 0;
+
+			if (!reader.Read(&num, sizeof(num)))
+				return false;
+
+			lua_pushnumber(L, num);
+		} break;
+		case LUA_TSTRING: {
+			std::uint32_t size = 0;
+
+			if (!reader.Read(&size, sizeof(size)) || size > size_t(reader.end - reader.pos))
+				return false;
+
+			lua_pushlstring(L, reinterpret_cast<const char*>(reader.pos), size);
+			reader.pos += size;
+		} break;
+		case LUA_TTABLE: {
+			std::uint32_t numPairs = 0;
+
+			if (depth++ > maxDepth)
+				return false;
+			if (!reader.Read(&numPairs, sizeof(numPairs)))
+				return false;
+			if (!lua_checkstack(L, 3))
+				return false;
+
+			lua_newtable(L);
+
+			for (std::uint32_t n = 0; n < numPairs; n++) {
+				if (!DeserializeData(L, reader, depth) || !DeserializeData(L, reader, depth))
+					return false;
+				// corrupt blob, would raise an error
+				if (lua_isnil(L, -2) || lua_istable(L, -2))
+					return false;
+
+				lua_rawset(L, -3);
+			}
+		} break;
+		default: {
+			return false;
+		} break;
+	}
+
+	return true;
+}
+
+
+bool LuaUtils::SerializeTable(lua_State* L, int index, std::vector<std::uint8_t>& blob) {
+	const int top = lua_gettop(L);
+
+	blob.clear();
+
+	if (!lua_istable(L, index))
+		return false;
+
+	if (!::SerializeTable(L, index, 0, blob)) {
+		lua_settop(L, top);
+		blob.clear();
+		return false;
+	}
+
+	assert(lua_gettop(L) == top);
+	return true;
+}
+
+bool LuaUtils::DeserializeTable(lua_State* L, const std::vector<std::uint8_t>& blob) {
+	const int top = lua_gettop(L);
+
+	BlobReader reader = {blob.data(), blob.data() + blob.size()};
+
+	// trailing garbage also counts as corruption
+	if (!DeserializeData(L, reader, 0) || reader.pos != reader.end || !lua_istable(L, -1)) {
+		lua_settop(L, top);
+		return false;
+	}
+
+	return true;
+}
+
+
 /******************************************************************************/
 /******************************************************************************/
 
@@ -3,6 +3,7 @@
 #ifndef LUA_UTILS_H
 #define LUA_UTILS_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 using std::string;
@@ -77,6 +78,12 @@ class LuaUtils {
 		// Copies lua data between 2 lua_States
 		static int CopyData(lua_State* dst, lua_State* src, int count);
 
+		// Serializes the table at <index> (booleans, numbers, strings and
+		// subtables only) into a blob, keys are sorted so equal tables give
+		// equal blobs; DeserializeTable pushes a new table restored from one
+		static bool SerializeTable(lua_State* L, int index, std::vector<std::uint8_t>& blob);
+		static bool DeserializeTable(lua_State* L, const std::vector<std::uint8_t>& blob);
+
 		// returns stack index of traceback function
 		static int PushDebugTraceback(lua_State* L);
 
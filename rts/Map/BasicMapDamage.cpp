@@ -10,12 +10,16 @@
 #include "Sim/Misc/QuadField.h"
 #include "Sim/Units/Unit.h"
 #include "Sim/Units/UnitHandler.h"
+#include "Sim/MoveTypes/MoveMath/MoveMath.h"
 #include "Sim/Path/IPathManager.h"
 #include "Sim/Features/FeatureHandler.h"
 #include "System/TimeProfiler.h"
+#include "System/Log/ILog.h"
 
 
 CBasicMapDamage::CBasicMapDamage()
+	: rawRecalcArea(0)
+	, optRecalcArea(0)
 {
 	mapHardness = mapInfo->map.hardness;
 	disabled = false;
@@ -45,6 +49,14 @@ CBasicMapDamage::CBasicMapDamage()
 	weightTable[8] = 1.0f / 16.0f;
 }
 
+CBasicMapDamage::~CBasicMapDamage()
+{
+	if (rawRecalcArea == 0)
+		return;
+
+	LOG("[%s] crater recalculation area %llu (requested %llu, %.0f%% saved)", __func__, optRecalcArea, rawRecalcArea, 100.0f - (100.0f * optRecalcArea) / rawRecalcArea);
+}
+
 
 void CBasicMapDamage::TerrainTypeHardnessChanged(int ttIndex)
 {
@@ -206,6 +218,7 @@ void CBasicMapDamage::RecalcArea(int x1, int x2, int y1, int y2)
 {
 	readMap->UpdateHeightMapSynced(SRectangle(x1, y1, x2, y2));
 	featureHandler->TerrainChanged(x1, y1, x2, y2);
+	CMoveMath::UpdateSpeedModRasters(SRectangle(x1, y1, x2, y2));
 	{
 		SCOPED_TIMER("Sim::BasicMapDamage::Los");
 		losHandler->UpdateHeightMapSynced(SRectangle(x1, y1, x2, y2));
@@ -252,10 +265,27 @@ void CBasicMapDamage::Update()
 		}
 
 		if (e.ttl == 0) {
-			RecalcArea(e.x1 - 1, e.x2 + 1, e.y1 - 1, e.y2 + 1);
+			// inclusive bounds, the optimizer treats x2 and z2 as exclusive
+			const SRectangle rect(e.x1 - 1, e.y1 - 1, e.x2 + 2, e.y2 + 2);
+
+			rawRecalcArea += rect.GetArea();
+			dirtyAreas.push_back(rect);
 		}
 	}
 
+	if (!dirtyAreas.empty()) {
+		// overlapping craters would otherwise redo the same normals,
+		// LOS and path-cost work once per explosion
+		dirtyAreas.Optimize();
+
+		for (const SRectangle& rect: dirtyAreas) {
+			optRecalcArea += rect.GetArea();
+			RecalcArea(rect.x1, rect.x2 - 1, rect.z1, rect.z2 - 1);
+		}
+
+		dirtyAreas.clear();
+	}
+
 	while (!explosions.empty()) {
 		const Explo& explosion = explosions.front();
 
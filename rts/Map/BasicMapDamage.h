@@ -4,6 +4,7 @@
 #define _BASIC_MAP_DAMAGE_H
 
 #include "MapDamage.h"
+#include "System/Misc/RectangleOptimizer.h"
 
 #include <deque>
 #include <vector>
@@ -14,6 +15,7 @@ class CBasicMapDamage : public IMapDamage
 {
 public:
 	CBasicMapDamage();
+	~CBasicMapDamage();
 
 	void Explosion(const float3& pos, float strength, float radius) override;
 	void RecalcArea(int x1, int x2, int y1, int y2) override;
@@ -48,6 +50,14 @@ private:
 
 	std::deque<Explo> explosions;
 
+	// areas of all craters finished in the current frame, recalculated
+	// together (with overlaps merged) at the end of Update
+	CRectangleOptimizer dirtyAreas;
+
+	// total heightmap area requested by finished craters vs. recalculated
+	unsigned long long rawRecalcArea;
+	unsigned long long optRecalcArea;
+
 	static const unsigned int CRATER_TABLE_SIZE = 200;
 	static const unsigned int EXPLOSION_LIFETIME = 10;
 
@@ -0,0 +1,236 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "HeightMapUpdate.h"
+#include "Sim/Misc/GlobalConstants.h"
+#include "System/myMath.h"
+#include "System/Threading/ThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+
+// each stage updates the part of its output range that lies within <clip>
+// (inclusive, in squares); the ranges themselves are derived from <rect>
+// exactly as if the stage ran over the whole map
+static void UpdateCenterHeightMap(const HeightMapUpdate::Buffers& bufs, const SRectangle& rect, const SRectangle& clip)
+{
+	const int mapxp1 = bufs.mapx + 1;
+
+	const float* heightMap = bufs.cornerHeightMap;
+	float* centerHeightMap = bufs.mipHeightMaps[0];
+
+	for (int y = std::max(rect.z1, clip.z1), ey = std::min(rect.z2, clip.z2); y <= ey; y++) {
+		for (int x = std::max(rect.x1, clip.x1), ex = std::min(rect.x2, clip.x2); x <= ex; x++) {
+			const int idxTL = (y    ) * mapxp1 + x;
+			const int idxTR = (y    ) * mapxp1 + x + 1;
+			const int idxBL = (y + 1) * mapxp1 + x;
+			const int idxBR = (y + 1) * mapxp1 + x + 1;
+
+			const float height =
+				heightMap[idxTL] +
+				heightMap[idxTR] +
+				heightMap[idxBL] +
+				heightMap[idxBR];
+			centerHeightMap[y * bufs.mapx + x] = height * 0.25f;
+		}
+	}
+}
+
+static void UpdateMipHeightMaps(const HeightMapUpdate::Buffers& bufs, const SRectangle& rect, const SRectangle& clip)
+{
+	for (int i = 0; i < bufs.numMipMaps - 1; i++) {
+		const int hmapx = bufs.mapx >> i;
+
+		// start is even for every tile since TILE_SIZE >> i is, the
+		// (exclusive) end because tiles end on even square-indices
+		const int sx = std::max((rect.x1 >> i) & (~1), clip.x1 >> i);
+		const int ex = std::min((rect.x2 >> i), (clip.x2 + 1) >> i);
+		const int sy = std::max((rect.z1 >> i) & (~1), clip.z1 >> i);
+		const int ey = std::min((rect.z2 >> i), (clip.z2 + 1) >> i);
+
+		const float* topMipMap = bufs.mipHeightMaps[i];
+		      float* subMipMap = bufs.mipHeightMaps[i + 1];
+
+		for (int y = sy; y < ey; y += 2) {
+			for (int x = sx; x < ex; x += 2) {
+				const float height =
+					topMipMap[(x    ) + (y    ) * hmapx] +
+					topMipMap[(x    ) + (y + 1) * hmapx] +
+					topMipMap[(x + 1) + (y    ) * hmapx] +
+					topMipMap[(x + 1) + (y + 1) * hmapx];
+				subMipMap[(x / 2) + (y / 2) * hmapx / 2] = height * 0.25f;
+			}
+		}
+	}
+}
+
+static void UpdateFaceNormals(const HeightMapUpdate::Buffers& bufs, const SRectangle& rect, const SRectangle& clip)
+{
+	const int mapxp1 = bufs.mapx + 1;
+
+	const int z1 = std::max(std::max(            0, rect.z1 - 1), clip.z1);
+	const int x1 = std::max(std::max(            0, rect.x1 - 1), clip.x1);
+	const int z2 = std::min(std::min(bufs.mapy - 1, rect.z2 + 1), clip.z2);
+	const int x2 = std::min(std::min(bufs.mapx - 1, rect.x2 + 1), clip.x2);
+
+	const float* heightMap = bufs.cornerHeightMap;
+
+	for (int y = z1; y <= z2; y++) {
+		float3 fnTL;
+		float3 fnBR;
+
+		for (int x = x1; x <= x2; x++) {
+			const int idxTL = (y    ) * mapxp1 + x; // TL
+			const int idxBL = (y + 1) * mapxp1 + x; // BL
+			const int idxSQ = (y    ) * bufs.mapx + x;
+
+			const float& hTL = heightMap[idxTL    ];
+			const float& hTR = heightMap[idxTL + 1];
+			const float& hBL = heightMap[idxBL    ];
+			const float& hBR = heightMap[idxBL + 1];
+
+			// normal of top-left triangle (face) in square
+			//
+			//  *---> e1
+			//  |
+			//  |
+			//  v
+			//  e2
+			//const float3 e1( SQUARE_SIZE, hTR - hTL,           0);
+			//const float3 e2(           0, hBL - hTL, SQUARE_SIZE);
+			//const float3 fnTL = (e2.cross(e1)).Normalize();
+			fnTL.y = SQUARE_SIZE;
+			fnTL.x = - (hTR - hTL);
+			fnTL.z = - (hBL - hTL);
+			fnTL.Normalize();
+
+			// normal of bottom-right triangle (face) in square
+			//
+			//         e3
+			//         ^
+			//         |
+			//         |
+			//  e4 <---*
+			//const float3 e3(-SQUARE_SIZE, hBL - hBR,           0);
+			//const float3 e4(           0, hTR - hBR,-SQUARE_SIZE);
+			//const float3 fnBR = (e4.cross(e3)).Normalize();
+			fnBR.y = SQUARE_SIZE;
+			fnBR.x = (hBL - hBR);
+			fnBR.z = (hTR - hBR);
+			fnBR.Normalize();
+
+			bufs.faceNormals[idxSQ * 2    ] = fnTL;
+			bufs.faceNormals[idxSQ * 2 + 1] = fnBR;
+			// square-normal
+			bufs.centerNormals[idxSQ] = (fnTL + fnBR).Normalize();
+			bufs.centerNormals2D[idxSQ] = (fnTL + fnBR).Normalize2D();
+
+			if (bufs.faceNormalsCopy != nullptr) {
+				bufs.faceNormalsCopy[idxSQ * 2    ] = bufs.faceNormals[idxSQ * 2    ];
+				bufs.faceNormalsCopy[idxSQ * 2 + 1] = bufs.faceNormals[idxSQ * 2 + 1];
+			}
+			if (bufs.centerNormalsCopy != nullptr) {
+				bufs.centerNormalsCopy[idxSQ] = bufs.centerNormals[idxSQ];
+			}
+		}
+	}
+}
+
+// must run after UpdateFaceNormals (over the same clip-rectangle)
+static void UpdateSlopeMap(const HeightMapUpdate::Buffers& bufs, const SRectangle& rect, const SRectangle& clip)
+{
+	const int hmapx = bufs.mapx / 2;
+	const int hmapy = bufs.mapy / 2;
+
+	const int sx = std::max(std::max(0,         (rect.x1 / 2) - 1), clip.x1 / 2);
+	const int ex = std::min(std::min(hmapx - 1, (rect.x2 / 2) + 1), clip.x2 / 2);
+	const int sy = std::max(std::max(0,         (rect.z1 / 2) - 1), clip.z1 / 2);
+	const int ey = std::min(std::min(hmapy - 1, (rect.z2 / 2) + 1), clip.z2 / 2);
+
+	const float3* faceNormals = bufs.faceNormals;
+
+	for (int y = sy; y <= ey; y++) {
+		for (int x = sx; x <= ex; x++) {
+			const int idx0 = (y*2    ) * (bufs.mapx) + x*2;
+			const int idx1 = (y*2 + 1) * (bufs.mapx) + x*2;
+
+			float avgslope = 0.0f;
+			avgslope += faceNormals[(idx0    ) * 2    ].y;
+			avgslope += faceNormals[(idx0    ) * 2 + 1].y;
+			avgslope += faceNormals[(idx0 + 1) * 2    ].y;
+			avgslope += faceNormals[(idx0 + 1) * 2 + 1].y;
+			avgslope += faceNormals[(idx1    ) * 2    ].y;
+			avgslope += faceNormals[(idx1    ) * 2 + 1].y;
+			avgslope += faceNormals[(idx1 + 1) * 2    ].y;
+			avgslope += faceNormals[(idx1 + 1) * 2 + 1].y;
+			avgslope *= 0.125f;
+
+			float maxslope =              faceNormals[(idx0    ) * 2    ].y;
+			maxslope = std::min(maxslope, faceNormals[(idx0    ) * 2 + 1].y);
+			maxslope = std::min(maxslope, faceNormals[(idx0 + 1) * 2    ].y);
+			maxslope = std::min(maxslope, faceNormals[(idx0 + 1) * 2 + 1].y);
+			maxslope = std::min(maxslope, faceNormals[(idx1    ) * 2    ].y);
+			maxslope = std::min(maxslope, faceNormals[(idx1    ) * 2 + 1].y);
+			maxslope = std::min(maxslope, faceNormals[(idx1 + 1) * 2    ].y);
+			maxslope = std::min(maxslope, faceNormals[(idx1 + 1) * 2 + 1].y);
+
+			// smooth it a bit, so small holes don't block huge tanks
+			const float lerp = maxslope / avgslope;
+			const float slope = mix(maxslope, avgslope, lerp);
+
+			bufs.slopeMap[y * hmapx + x] = 1.0f - slope;
+		}
+	}
+}
+
+static void UpdateAllStages(const HeightMapUpdate::Buffers& bufs, const SRectangle& rect, const SRectangle& clip)
+{
+	UpdateCenterHeightMap(bufs, rect, clip);
+	UpdateMipHeightMaps(bufs, rect, clip);
+	UpdateFaceNormals(bufs, rect, clip);
+	UpdateSlopeMap(bufs, rect, clip);
+}
+
+
+void HeightMapUpdate::UpdateSerial(const Buffers& bufs, const SRectangle& rect)
+{
+	UpdateAllStages(bufs, rect, {0, 0, bufs.mapx - 1, bufs.mapy - 1});
+}
+
+void HeightMapUpdate::UpdateTiled(const Buffers& bufs, const SRectangle& rect)
+{
+	static_assert((TILE_SIZE % 2) == 0, "");
+
+	assert((TILE_SIZE % (1 << std::max(0, bufs.numMipMaps - 1))) == 0);
+
+	// the slopemap stage reaches furthest beyond <rect>, up to 3 squares
+	const int tx1 = std::max(            0, rect.x1 - 3) / TILE_SIZE;
+	const int tz1 = std::max(            0, rect.z1 - 3) / TILE_SIZE;
+	const int tx2 = std::min(bufs.mapx - 1, rect.x2 + 3) / TILE_SIZE;
+	const int tz2 = std::min(bufs.mapy - 1, rect.z2 + 3) / TILE_SIZE;
+
+	const int numTilesX = tx2 - tx1 + 1;
+	const int numTilesZ = tz2 - tz1 + 1;
+
+	const auto UpdateTile = [&](const int i) {
+		const int tx = tx1 + (i % numTilesX);
+		const int tz = tz1 + (i / numTilesX);
+
+		const SRectangle clip = {
+			tx * TILE_SIZE,
+			tz * TILE_SIZE,
+			std::min((tx + 1) * TILE_SIZE, bufs.mapx) - 1,
+			std::min((tz + 1) * TILE_SIZE, bufs.mapy) - 1,
+		};
+
+		UpdateAllStages(bufs, rect, clip);
+	};
+
+	// most deformations (explosions) touch a single tile
+	if (numTilesX * numTilesZ == 1) {
+		UpdateTile(0);
+		return;
+	}
+
+	for_mt(0, numTilesX * numTilesZ, UpdateTile);
+}
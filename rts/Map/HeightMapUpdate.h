@@ -0,0 +1,45 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef HEIGHTMAP_UPDATE_H
+#define HEIGHTMAP_UPDATE_H
+
+#include "System/float3.h"
+#include "System/Rectangle.h"
+
+// computes the fields CReadMap derives from the synced corner heightmap
+// (center heights and their mipmaps, face- and center-normals and the
+// slopemap) over a rectangle of changed heightmap squares
+//
+// UpdateTiled splits the work into square tiles and runs all stages for
+// one tile before moving on to the next, in parallel; since no derived
+// value depends on data outside its own tile the result is bit-identical
+// to UpdateSerial, which runs every stage over the whole rectangle in turn
+namespace HeightMapUpdate {
+	// multiple of the coarsest mip-level's (2 << (numMipMaps - 2)) pixel
+	// size s.t. mipmap and slopemap pixels never straddle two tiles
+	static constexpr int TILE_SIZE = 64;
+
+	struct Buffers {
+		int mapx; //< in squares
+		int mapy;
+		int numMipMaps;
+
+		const float* cornerHeightMap;    //< (mapx + 1) * (mapy + 1)
+		float* const* mipHeightMaps;     //< [0] is the center heightmap (mapx * mapy), [n + 1] half the resolution of [n]
+
+		float3* faceNormals;             //< 2 * mapx * mapy
+		float3* centerNormals;           //< mapx * mapy
+		float3* centerNormals2D;         //< mapx * mapy
+		float* slopeMap;                 //< (mapx / 2) * (mapy / 2)
+
+		// if non-null, these receive copies of faceNormals and centerNormals
+		float3* faceNormalsCopy;
+		float3* centerNormalsCopy;
+	};
+
+	// <rect> is in squares (inclusive) and must lie within the map
+	void UpdateSerial(const Buffers& bufs, const SRectangle& rect);
+	void UpdateTiled(const Buffers& bufs, const SRectangle& rect);
+};
+
+#endif // HEIGHTMAP_UPDATE_H
@@ -7,11 +7,13 @@
 #include "ReadMap.h"
 #include "MapDamage.h"
 #include "MapInfo.h"
+#include "HeightMapUpdate.h"
 #include "MetalMap.h"
 #include "Rendering/Env/MapRendering.h"
 #include "SMF/SMFReadMap.h"
 #include "Game/LoadScreen.h"
 #include "System/bitops.h"
+#include "System/Config/ConfigHandler.h"
 #include "System/EventHandler.h"
 #include "System/Exceptions.h"
 #include "System/myMath.h"
@@ -21,6 +23,7 @@
 #include "System/FileSystem/FileSystem.h"
 #include "System/Log/ILog.h"
 #include "System/Misc/RectangleOptimizer.h"
+#include "System/Platform/Misc.h"
 #include "System/Sync/HsiehHash.h"
 #include "System/SafeUtil.h"
 
@@ -29,6 +32,8 @@
 #include "Sim/Misc/LosHandler.h"
 #endif
 
+CONFIG(bool, CompactHeightMaps).defaultValue(false).headlessValue(true).description("Reduces the memory used by the map's derived heightmap data: unsynced copies share storage with the synced data while they can not diverge and render-only normals are packed. Synced data is unaffected.");
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -87,6 +92,9 @@ CR_REG_METADATA(CReadMap, (
 	CR_IGNORED(sharedCenterNormals),
 	CR_IGNORED(sharedSlopeMaps),
 
+	CR_IGNORED(compactHeightMaps),
+	CR_IGNORED(unsyncedSharesSynced),
+
 	CR_IGNORED(unsyncedHeightMapUpdates),
 	CR_IGNORED(unsyncedHeightMapUpdatesTemp),
 
@@ -113,6 +121,7 @@ std::vector<float> CReadMap::centerHeightMap;
 std::array<std::vector<float>, CReadMap::numHeightMipMaps - 1> CReadMap::mipCenterHeightMaps;
 
 std::vector<float3> CReadMap::visVertexNormals;
+std::vector<uint32_t> CReadMap::visVertexNormalsPacked;
 std::vector<float3> CReadMap::faceNormalsSynced;
 std::vector<float3> CReadMap::faceNormalsUnsynced;
 std::vector<float3> CReadMap::centerNormalsSynced;
@@ -143,6 +152,11 @@ CReadMap* CReadMap::LoadMap(const std::string& mapName)
 {
 	CReadMap* rm = nullptr;
 
+	// the peak can only grow, so the difference is what loading the map added on top
+	const float peakRSS = Platform::GetPeakRSS() / (1024.0f * 1024.0f);
+
+	LOG("[CReadMap::%s] peak RSS %.1fMB before loading \"%s\"", __func__, peakRSS, mapName.c_str());
+
 	if (FileSystem::GetExtension(mapName) == "sm3") {
 		throw content_error("[CReadMap::LoadMap] SM3 maps are no longer supported as of Spring 95.0");
 	} else {
@@ -177,6 +191,9 @@ CReadMap* CReadMap::LoadMap(const std::string& mapName)
 	if (typemapPtr != nullptr)
 		rm->FreeInfoMap("type", typemapPtr);
 
+	const float newPeakRSS = Platform::GetPeakRSS() / (1024.0f * 1024.0f);
+
+	LOG("[CReadMap::%s] peak RSS %.1fMB after loading \"%s\" (+%.1fMB)", __func__, newPeakRSS, mapName.c_str(), newPeakRSS - peakRSS);
 	return rm;
 }
 
@@ -230,24 +247,7 @@ void CReadMap::Serialize(creg::ISerializer* s)
 
 void CReadMap::PostLoad()
 {
-	#ifndef USE_UNSYNCED_HEIGHTMAP
-	heightMapUnsyncedPtr = heightMapSyncedPtr;
-	#endif
-
-	sharedCornerHeightMaps[0] = &(*heightMapUnsyncedPtr)[0];
-	sharedCornerHeightMaps[1] = &(*heightMapSyncedPtr)[0];
-
-	sharedCenterHeightMaps[0] = &centerHeightMap[0]; // NO UNSYNCED VARIANT
-	sharedCenterHeightMaps[1] = &centerHeightMap[0];
-
-	sharedFaceNormals[0] = &faceNormalsUnsynced[0];
-	sharedFaceNormals[1] = &faceNormalsSynced[0];
-
-	sharedCenterNormals[0] = &centerNormalsUnsynced[0];
-	sharedCenterNormals[1] = &centerNormalsSynced[0];
-
-	sharedSlopeMaps[0] = &slopeMap[0]; // NO UNSYNCED VARIANT
-	sharedSlopeMaps[1] = &slopeMap[0];
+	UpdateSharedPointers();
 
 	//FIXME reconstruct
 	/*
@@ -265,9 +265,13 @@ CReadMap::CReadMap()
 	: metalMap(nullptr)
 	, heightMapSyncedPtr(nullptr)
 	, heightMapUnsyncedPtr(nullptr)
+	, compactHeightMaps(configHandler->GetBool("CompactHeightMaps"))
+	, unsyncedSharesSynced(false)
 	, mapChecksum(0)
 	, boundingRadius(0.0f)
 {
+	// decided here since subclasses allocate the unsynced heightmap before Initialize
+	unsyncedSharesSynced = WantUnsyncedSharing();
 }
 
 
@@ -287,12 +291,14 @@ void CReadMap::Initialize()
 	{
 		char loadMsg[512];
 		const char* fmtString = "Loading Map (%u MB)";
+		const unsigned int numCopies = 2 - unsyncedSharesSynced;
+		const unsigned int visNormalSize = compactHeightMaps? sizeof(uint32_t): sizeof(float3);
 		unsigned int reqMemFootPrintKB =
-			((( mapDims.mapxp1)   * mapDims.mapyp1  * 2     * sizeof(float))         / 1024) +   // cornerHeightMap{Synced, Unsynced}
-			((( mapDims.mapxp1)   * mapDims.mapyp1  *         sizeof(float))         / 1024) +   // originalHeightMap
-			((  mapDims.mapx      * mapDims.mapy    * 2 * 2 * sizeof(float3))        / 1024) +   // faceNormals{Synced, Unsynced}
-			((  mapDims.mapx      * mapDims.mapy    * 2     * sizeof(float3))        / 1024) +   // centerNormals{Synced, Unsynced}
-			((( mapDims.mapxp1)   * mapDims.mapyp1          * sizeof(float3))        / 1024) +   // VisVertexNormals
+			((( mapDims.mapxp1)   * mapDims.mapyp1  * numCopies     * sizeof(float))  / 1024) +   // cornerHeightMap{Synced, Unsynced}
+			((( mapDims.mapxp1)   * mapDims.mapyp1  *                 sizeof(float))  / 1024) +   // originalHeightMap
+			((  mapDims.mapx      * mapDims.mapy    * numCopies * 2 * sizeof(float3)) / 1024) +   // faceNormals{Synced, Unsynced}
+			((  mapDims.mapx      * mapDims.mapy    * numCopies     * sizeof(float3)) / 1024) +   // centerNormals{Synced, Unsynced}
+			((( mapDims.mapxp1)   * mapDims.mapyp1                  * visNormalSize)  / 1024) +   // VisVertexNormals
 			((  mapDims.mapx      * mapDims.mapy            * sizeof(float))         / 1024) +   // centerHeightMap
 			((  mapDims.hmapx     * mapDims.hmapy           * sizeof(float))         / 1024) +   // slopeMap
 			((  mapDims.hmapx     * mapDims.hmapy           * sizeof(uint8_t))       / 1024) +   // typeMap
@@ -315,12 +321,18 @@ void CReadMap::Initialize()
 	originalHeightMap.resize(mapDims.mapxp1 * mapDims.mapyp1);
 	faceNormalsSynced.clear();
 	faceNormalsSynced.resize(mapDims.mapx * mapDims.mapy * 2);
-	faceNormalsUnsynced.clear();
-	faceNormalsUnsynced.resize(mapDims.mapx * mapDims.mapy * 2);
 	centerNormalsSynced.clear();
 	centerNormalsSynced.resize(mapDims.mapx * mapDims.mapy);
-	centerNormalsUnsynced.clear();
-	centerNormalsUnsynced.resize(mapDims.mapx * mapDims.mapy);
+
+	if (unsyncedSharesSynced) {
+		std::vector<float3>().swap(faceNormalsUnsynced);
+		std::vector<float3>().swap(centerNormalsUnsynced);
+	} else {
+		faceNormalsUnsynced.clear();
+		faceNormalsUnsynced.resize(mapDims.mapx * mapDims.mapy * 2);
+		centerNormalsUnsynced.clear();
+		centerNormalsUnsynced.resize(mapDims.mapx * mapDims.mapy);
+	}
 	centerNormals2D.clear();
 	centerNormals2D.resize(mapDims.mapx * mapDims.mapy);
 	centerHeightMap.clear();
@@ -343,8 +355,15 @@ void CReadMap::Initialize()
 	typeMap.clear();
 	typeMap.resize(mapDims.hmapx * mapDims.hmapy, 0);
 
-	visVertexNormals.clear();
-	visVertexNormals.resize(mapDims.mapxp1 * mapDims.mapyp1);
+	if (compactHeightMaps) {
+		std::vector<float3>().swap(visVertexNormals);
+		visVertexNormalsPacked.clear();
+		visVertexNormalsPacked.resize(mapDims.mapxp1 * mapDims.mapyp1);
+	} else {
+		std::vector<uint32_t>().swap(visVertexNormalsPacked);
+		visVertexNormals.clear();
+		visVertexNormals.resize(mapDims.mapxp1 * mapDims.mapyp1);
+	}
 
 	// note: if USE_UNSYNCED_HEIGHTMAP is false, then
 	// heightMapUnsyncedPtr points to an empty vector
@@ -352,26 +371,7 @@ void CReadMap::Initialize()
 	assert(heightMapSyncedPtr != nullptr);
 	assert(heightMapUnsyncedPtr != nullptr);
 
-	{
-		#ifndef USE_UNSYNCED_HEIGHTMAP
-		heightMapUnsyncedPtr = heightMapSyncedPtr;
-		#endif
-
-		sharedCornerHeightMaps[0] = &(*heightMapUnsyncedPtr)[0];
-		sharedCornerHeightMaps[1] = &(*heightMapSyncedPtr)[0];
-
-		sharedCenterHeightMaps[0] = &centerHeightMap[0]; // NO UNSYNCED VARIANT
-		sharedCenterHeightMaps[1] = &centerHeightMap[0];
-
-		sharedFaceNormals[0] = &faceNormalsUnsynced[0];
-		sharedFaceNormals[1] = &faceNormalsSynced[0];
-
-		sharedCenterNormals[0] = &centerNormalsUnsynced[0];
-		sharedCenterNormals[1] = &centerNormalsSynced[0];
-
-		sharedSlopeMaps[0] = &slopeMap[0]; // NO UNSYNCED VARIANT
-		sharedSlopeMaps[1] = &slopeMap[0];
-	}
+	UpdateSharedPointers();
 
 	mapChecksum = CalcHeightmapChecksum();
 
@@ -387,6 +387,78 @@ void CReadMap::Initialize()
 }
 
 
+void CReadMap::UpdateSharedPointers()
+{
+	#ifndef USE_UNSYNCED_HEIGHTMAP
+	heightMapUnsyncedPtr = heightMapSyncedPtr;
+	#endif
+
+	const std::vector<float>& cornerHeightMapUnsynced = unsyncedSharesSynced? *heightMapSyncedPtr: *heightMapUnsyncedPtr;
+	const std::vector<float3>& faceNormalsUnsyncedRef = unsyncedSharesSynced? faceNormalsSynced: faceNormalsUnsynced;
+	const std::vector<float3>& centerNormalsUnsyncedRef = unsyncedSharesSynced? centerNormalsSynced: centerNormalsUnsynced;
+
+	sharedCornerHeightMaps[0] = &cornerHeightMapUnsynced[0];
+	sharedCornerHeightMaps[1] = &(*heightMapSyncedPtr)[0];
+
+	sharedCenterHeightMaps[0] = &centerHeightMap[0]; // NO UNSYNCED VARIANT
+	sharedCenterHeightMaps[1] = &centerHeightMap[0];
+
+	sharedFaceNormals[0] = &faceNormalsUnsyncedRef[0];
+	sharedFaceNormals[1] = &faceNormalsSynced[0];
+
+	sharedCenterNormals[0] = &centerNormalsUnsyncedRef[0];
+	sharedCenterNormals[1] = &centerNormalsSynced[0];
+
+	sharedSlopeMaps[0] = &slopeMap[0]; // NO UNSYNCED VARIANT
+	sharedSlopeMaps[1] = &slopeMap[0];
+}
+
+
+bool CReadMap::WantUnsyncedSharing() const
+{
+	if (!compactHeightMaps)
+		return false;
+
+	#if (defined(HEADLESS) || !defined(USE_UNSYNCED_HEIGHTMAP))
+	// nothing is drawn, or the unsynced view is never LOS-limited
+	return true;
+	#else
+	// divergence needs heightmap changes hidden from the local player
+	return (gu != nullptr && gu->spectatingFullView);
+	#endif
+}
+
+void CReadMap::SetUnsyncedSharing(bool share)
+{
+	if (share == unsyncedSharesSynced)
+		return;
+
+	unsyncedSharesSynced = share;
+
+	if (share) {
+		std::vector<float3>().swap(faceNormalsUnsynced);
+		std::vector<float3>().swap(centerNormalsUnsynced);
+		#ifdef USE_UNSYNCED_HEIGHTMAP
+		std::vector<float>().swap(*heightMapUnsyncedPtr);
+		#endif
+	} else {
+		// the unsynced view was the synced data up to now, so the copies are exact
+		faceNormalsUnsynced = faceNormalsSynced;
+		centerNormalsUnsynced = centerNormalsSynced;
+		#ifdef USE_UNSYNCED_HEIGHTMAP
+		*heightMapUnsyncedPtr = *heightMapSyncedPtr;
+		#endif
+	}
+
+	UpdateSharedPointers();
+
+	// the unsynced arrays now show everything, let the
+	// renderer catch up on changes it was not shown yet
+	if (share && losHandler != nullptr)
+		BecomeSpectator();
+}
+
+
 unsigned int CReadMap::CalcHeightmapChecksum()
 {
 	const float* heightmap = GetCornerHeightMapSynced();
@@ -437,6 +509,9 @@ void CReadMap::UpdateDraw(bool firstCall)
 
 	CRectangleOptimizer::container unsyncedHeightMapUpdatesSwap;
 
+	// the local player's view can change at any time (e.g. by spectating)
+	SetUnsyncedSharing(WantUnsyncedSharing());
+
 	{
 		if (!unsyncedHeightMapUpdates.empty())
 			unsyncedHeightMapUpdates.swap(unsyncedHeightMapUpdatesTemp); // swap to avoid Optimize() inside a mutex
@@ -485,10 +560,7 @@ void CReadMap::UpdateHeightMapSynced(SRectangle hmRect, bool initialize)
 	hmRect.x2 = std::min(mapDims.mapxm1, hmRect.x2 + 1);
 	hmRect.z2 = std::min(mapDims.mapym1, hmRect.z2 + 1);
 
-	UpdateCenterHeightmap(hmRect, initialize);
-	UpdateMipHeightmaps(hmRect, initialize);
-	UpdateFaceNormals(hmRect, initialize);
-	UpdateSlopemap(hmRect, initialize); // must happen after UpdateFaceNormals()!
+	UpdateDerivedHeightMaps(hmRect, initialize);
 
 	assert(initialize == (losHandler == nullptr));
 
@@ -520,163 +592,34 @@ void CReadMap::UpdateHeightMapSynced(SRectangle hmRect, bool initialize)
 }
 
 
-void CReadMap::UpdateCenterHeightmap(const SRectangle& rect, bool initialize)
+void CReadMap::UpdateDerivedHeightMaps(const SRectangle& rect, bool initialize)
 {
-	const float* heightmapSynced = GetCornerHeightMapSynced();
-
-	for (int y = rect.z1; y <= rect.z2; y++) {
-		for (int x = rect.x1; x <= rect.x2; x++) {
-			const int idxTL = (y    ) * mapDims.mapxp1 + x;
-			const int idxTR = (y    ) * mapDims.mapxp1 + x + 1;
-			const int idxBL = (y + 1) * mapDims.mapxp1 + x;
-			const int idxBR = (y + 1) * mapDims.mapxp1 + x + 1;
-
-			const float height =
-				heightmapSynced[idxTL] +
-				heightmapSynced[idxTR] +
-				heightmapSynced[idxBL] +
-				heightmapSynced[idxBR];
-			centerHeightMap[y * mapDims.mapx + x] = height * 0.25f;
-		}
-	}
-}
+	HeightMapUpdate::Buffers bufs;
 
+	bufs.mapx = mapDims.mapx;
+	bufs.mapy = mapDims.mapy;
+	bufs.numMipMaps = numHeightMipMaps;
 
-void CReadMap::UpdateMipHeightmaps(const SRectangle& rect, bool initialize)
-{
-	for (int i = 0; i < numHeightMipMaps - 1; i++) {
-		const int hmapx = mapDims.mapx >> i;
-
-		const int sx = (rect.x1 >> i) & (~1);
-		const int ex = (rect.x2 >> i);
-		const int sy = (rect.z1 >> i) & (~1);
-		const int ey = (rect.z2 >> i);
-		float* topMipMap = mipPointerHeightMaps[i];
-		float* subMipMap = mipPointerHeightMaps[i + 1];
-
-		for (int y = sy; y < ey; y += 2) {
-			for (int x = sx; x < ex; x += 2) {
-				const float height =
-					topMipMap[(x    ) + (y    ) * hmapx] +
-					topMipMap[(x    ) + (y + 1) * hmapx] +
-					topMipMap[(x + 1) + (y    ) * hmapx] +
-					topMipMap[(x + 1) + (y + 1) * hmapx];
-				subMipMap[(x / 2) + (y / 2) * hmapx / 2] = height * 0.25f;
-			}
-		}
-	}
-}
+	bufs.cornerHeightMap = GetCornerHeightMapSynced();
+	bufs.mipHeightMaps = &mipPointerHeightMaps[0];
 
+	bufs.faceNormals = &faceNormalsSynced[0];
+	bufs.centerNormals = &centerNormalsSynced[0];
+	bufs.centerNormals2D = &centerNormals2D[0];
+	bufs.slopeMap = &slopeMap[0];
 
-void CReadMap::UpdateFaceNormals(const SRectangle& rect, bool initialize)
-{
-	const float* heightmapSynced = GetCornerHeightMapSynced();
-
-	const int z1 = std::max(             0, rect.z1 - 1);
-	const int x1 = std::max(             0, rect.x1 - 1);
-	const int z2 = std::min(mapDims.mapym1, rect.z2 + 1);
-	const int x2 = std::min(mapDims.mapxm1, rect.x2 + 1);
-
-	for_mt(z1, z2+1, [&](const int y) {
-		float3 fnTL;
-		float3 fnBR;
-
-		for (int x = x1; x <= x2; x++) {
-			const int idxTL = (y    ) * mapDims.mapxp1 + x; // TL
-			const int idxBL = (y + 1) * mapDims.mapxp1 + x; // BL
-
-			const float& hTL = heightmapSynced[idxTL    ];
-			const float& hTR = heightmapSynced[idxTL + 1];
-			const float& hBL = heightmapSynced[idxBL    ];
-			const float& hBR = heightmapSynced[idxBL + 1];
-
-			// normal of top-left triangle (face) in square
-			//
-			//  *---> e1
-			//  |
-			//  |
-			//  v
-			//  e2
-			//const float3 e1( SQUARE_SIZE, hTR - hTL,           0);
-			//const float3 e2(           0, hBL - hTL, SQUARE_SIZE);
-			//const float3 fnTL = (e2.cross(e1)).Normalize();
-			fnTL.y = SQUARE_SIZE;
-			fnTL.x = - (hTR - hTL);
-			fnTL.z = - (hBL - hTL);
-			fnTL.Normalize();
-
-			// normal of bottom-right triangle (face) in square
-			//
-			//         e3
-			//         ^
-			//         |
-			//         |
-			//  e4 <---*
-			//const float3 e3(-SQUARE_SIZE, hBL - hBR,           0);
-			//const float3 e4(           0, hTR - hBR,-SQUARE_SIZE);
-			//const float3 fnBR = (e4.cross(e3)).Normalize();
-			fnBR.y = SQUARE_SIZE;
-			fnBR.x = (hBL - hBR);
-			fnBR.z = (hTR - hBR);
-			fnBR.Normalize();
-
-			faceNormalsSynced[(y * mapDims.mapx + x) * 2    ] = fnTL;
-			faceNormalsSynced[(y * mapDims.mapx + x) * 2 + 1] = fnBR;
-			// square-normal
-			centerNormalsSynced[y * mapDims.mapx + x] = (fnTL + fnBR).Normalize();
-			centerNormals2D[y * mapDims.mapx + x] = (fnTL + fnBR).Normalize2D();
+	bufs.faceNormalsCopy = nullptr;
+	bufs.centerNormalsCopy = nullptr;
 
-			#ifdef USE_UNSYNCED_HEIGHTMAP
-			if (initialize) {
-				faceNormalsUnsynced[(y * mapDims.mapx + x) * 2    ] = faceNormalsSynced[(y * mapDims.mapx + x) * 2    ];
-				faceNormalsUnsynced[(y * mapDims.mapx + x) * 2 + 1] = faceNormalsSynced[(y * mapDims.mapx + x) * 2 + 1];
-				centerNormalsUnsynced[y * mapDims.mapx + x] = centerNormalsSynced[y * mapDims.mapx + x];
-			}
-			#endif
-		}
-	});
-}
-
-
-void CReadMap::UpdateSlopemap(const SRectangle& rect, bool initialize)
-{
-	const int sx = std::max(0,                 (rect.x1 / 2) - 1);
-	const int ex = std::min(mapDims.hmapx - 1, (rect.x2 / 2) + 1);
-	const int sy = std::max(0,                 (rect.z1 / 2) - 1);
-	const int ey = std::min(mapDims.hmapy - 1, (rect.z2 / 2) + 1);
-
-	for (int y = sy; y <= ey; y++) {
-		for (int x = sx; x <= ex; x++) {
-			const int idx0 = (y*2    ) * (mapDims.mapx) + x*2;
-			const int idx1 = (y*2 + 1) * (mapDims.mapx) + x*2;
-
-			float avgslope = 0.0f;
-			avgslope += faceNormalsSynced[(idx0    ) * 2    ].y;
-			avgslope += faceNormalsSynced[(idx0    ) * 2 + 1].y;
-			avgslope += faceNormalsSynced[(idx0 + 1) * 2    ].y;
-			avgslope += faceNormalsSynced[(idx0 + 1) * 2 + 1].y;
-			avgslope += faceNormalsSynced[(idx1    ) * 2    ].y;
-			avgslope += faceNormalsSynced[(idx1    ) * 2 + 1].y;
-			avgslope += faceNormalsSynced[(idx1 + 1) * 2    ].y;
-			avgslope += faceNormalsSynced[(idx1 + 1) * 2 + 1].y;
-			avgslope *= 0.125f;
-
-			float maxslope =              faceNormalsSynced[(idx0    ) * 2    ].y;
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx0    ) * 2 + 1].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx0 + 1) * 2    ].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx0 + 1) * 2 + 1].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx1    ) * 2    ].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx1    ) * 2 + 1].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx1 + 1) * 2    ].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx1 + 1) * 2 + 1].y);
-
-			// smooth it a bit, so small holes don't block huge tanks
-			const float lerp = maxslope / avgslope;
-			const float slope = mix(maxslope, avgslope, lerp);
-
-			slopeMap[y * mapDims.hmapx + x] = 1.0f - slope;
-		}
+	#ifdef USE_UNSYNCED_HEIGHTMAP
+	// later updates reach the unsynced normals via UpdateHeightMapUnsynced
+	if (initialize && !unsyncedSharesSynced) {
+		bufs.faceNormalsCopy = &faceNormalsUnsynced[0];
+		bufs.centerNormalsCopy = &centerNormalsUnsynced[0];
 	}
+	#endif
+
+	HeightMapUpdate::UpdateTiled(bufs, rect);
 }
 
 
@@ -11,6 +11,7 @@
 #include "Sim/Misc/GlobalConstants.h"
 #include "Sim/Misc/GlobalSynced.h"
 #include "System/float3.h"
+#include "System/myMath.h"
 #include "System/type2.h"
 #include "System/creg/creg_cond.h"
 #include "System/Misc/RectangleOptimizer.h"
@@ -142,6 +143,8 @@ public:
 	 * Some map types:
 	 *   "metal"  -  metalmap
 	 *   "grass"  -  grassmap
+	 * The returned data may point into the map file itself, so it must
+	 * not be modified and has to be released through FreeInfoMap.
 	 */
 	virtual unsigned char* GetInfoMap(const std::string& name, MapBitmapInfo* bm) = 0;
 	virtual void FreeInfoMap(const std::string& name, unsigned char* data) = 0;
@@ -167,7 +170,11 @@ public:
 	const float3* GetCenterNormals2DSynced()  const { return &centerNormals2D[0]; }
 
 	/// unsynced only
-	const float3* GetVisVertexNormalsUnsynced() const { return &visVertexNormals[0]; }
+	/// NOTE: null in compact mode, where the normals are stored packed
+	const float3* GetVisVertexNormalsUnsynced() const { return visVertexNormals.data(); }
+	float3 GetVisVertexNormalUnsynced(int idx) const {
+		return (compactHeightMaps? DecodeNormalOct(visVertexNormalsPacked[idx]): visVertexNormals[idx]);
+	}
 
 	/// synced versions
 	const float* GetCornerHeightMapSynced() const { return sharedCornerHeightMaps[true]; }
@@ -203,15 +210,28 @@ public:
 	bool HasVisibleWater() const;
 	bool HasOnlyVoidWater() const;
 
+	/// true if the unsynced heightmap and normals currently alias the synced ones
+	bool UnsyncedSharesSynced() const { return unsyncedSharesSynced; }
+
 	unsigned int GetMapChecksum() const { return mapChecksum; }
 	unsigned int CalcHeightmapChecksum();
 	unsigned int CalcTypemapChecksum();
 
+protected:
+	void SetVisVertexNormal(int idx, const float3& n) {
+		if (compactHeightMaps) {
+			visVertexNormalsPacked[idx] = EncodeNormalOct(n);
+		} else {
+			visVertexNormals[idx] = n;
+		}
+	}
+
 private:
-	void UpdateCenterHeightmap(const SRectangle& rect, bool initialize);
-	void UpdateMipHeightmaps(const SRectangle& rect, bool initialize);
-	void UpdateFaceNormals(const SRectangle& rect, bool initialize);
-	void UpdateSlopemap(const SRectangle& rect, bool initialize);
+	void UpdateDerivedHeightMaps(const SRectangle& rect, bool initialize);
+
+	bool WantUnsyncedSharing() const;
+	void SetUnsyncedSharing(bool share);
+	void UpdateSharedPointers();
 
 	inline void HeightMapUpdateLOSCheck(const SRectangle& hmRect);
 	inline bool HasHeightMapChanged(const int lmx, const int lmy);
@@ -244,6 +264,7 @@ protected:
 	std::array<float*, numHeightMipMaps> mipPointerHeightMaps;
 
 	static std::vector<float3> visVertexNormals;      //< size:  (mapx + 1) * (mapy + 1), contains one vertex normal per corner-heightmap pixel [UNSYNCED]
+	static std::vector<uint32_t> visVertexNormalsPacked; //< visVertexNormals in compact mode, octahedral-encoded [UNSYNCED]
 	static std::vector<float3> faceNormalsSynced;     //< size: 2*mapx      *  mapy     , contains 2 normals per quad -> triangle strip [SYNCED]
 	static std::vector<float3> faceNormalsUnsynced;   //< size: 2*mapx      *  mapy     , contains 2 normals per quad -> triangle strip [UNSYNCED]
 	static std::vector<float3> centerNormalsSynced;   //< size:   mapx      *  mapy     , contains 1 interpolated normal per quad, same as (facenormal0+facenormal1).Normalize()) [SYNCED]
@@ -257,6 +278,15 @@ protected:
 	CRectangleOptimizer unsyncedHeightMapUpdates;
 	CRectangleOptimizer unsyncedHeightMapUpdatesTemp;
 
+	/**
+	 * in compact mode the unsynced corner heightmap and normals share storage
+	 * with their synced counterparts for as long as the two can not diverge,
+	 * i.e. while the local player sees everything (or nobody looks at all),
+	 * and vertex normals are packed; synced data is never affected
+	 */
+	bool compactHeightMaps;
+	bool unsyncedSharesSynced;
+
 private:
 	// these combine the various synced and unsynced arrays
 	// for branch-less access: [0] = !synced, [1] = synced
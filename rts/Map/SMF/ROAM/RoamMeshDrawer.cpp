@@ -219,7 +219,10 @@ void CRoamMeshDrawer::DrawMesh(const DrawPass::e& drawPass)
 	//   Updating for all passes produces the optimal tessellation per
 	//   camera but consumes far too many cycles; force any non-shadow
 	//   pass to reuse MESH_NORMAL
-	SCOPED_TIMER(drawPass == DrawPass::Normal ? "Draw::World::Terrain::ROAM" : "Misc::ROAM");
+	constexpr ProfilerZone drawZone("Draw::World::Terrain::ROAM");
+	constexpr ProfilerZone miscZone("Misc::ROAM");
+
+	ScopedTimer timer((drawPass == DrawPass::Normal)? drawZone: miscZone);
 
 	switch (drawPass) {
 		case DrawPass::Normal: { Update(); } break;
@@ -60,7 +60,10 @@ CSMFGroundDrawer::CSMFGroundDrawer(CSMFReadMap* rm)
 	drawerMode = (configHandler->GetInt("ROAM") != 0)? SMF_MESHDRAWER_ROAM: SMF_MESHDRAWER_BASIC;
 	groundDetail = configHandler->GetInt("GroundDetail");
 
+	#ifndef HEADLESS
+	// headless builds never draw, do not waste memory on the tiles
 	groundTextures = new CSMFGroundTextures(smfMap);
+	#endif
 	meshDrawer = SwitchMeshDrawer(drawerMode);
 
 	smfRenderStates.resize(RENDER_STATE_CNT, nullptr);
@@ -535,7 +538,9 @@ void CSMFGroundDrawer::SetLuaShader(const LuaMapShaderData* luaMapShaderData)
 
 void CSMFGroundDrawer::SetupBigSquare(const int bigSquareX, const int bigSquareY)
 {
-	groundTextures->BindSquareTexture(bigSquareX, bigSquareY);
+	if (groundTextures != nullptr)
+		groundTextures->BindSquareTexture(bigSquareX, bigSquareY);
+
 	smfRenderStates[RENDER_STATE_SEL]->SetSquareTexGen(bigSquareX, bigSquareY);
 
 	if (!borderShader.IsBound())
@@ -551,7 +556,9 @@ void CSMFGroundDrawer::Update()
 	if (readMap->HasOnlyVoidWater())
 		return;
 
-	groundTextures->DrawUpdate();
+	if (groundTextures != nullptr)
+		groundTextures->DrawUpdate();
+
 	// done by DrawMesh; needs to know the actual draw-pass
 	// meshDrawer->Update();
 
@@ -40,7 +40,9 @@ LOG_REGISTER_SECTION_GLOBAL(LOG_SECTION_SMF_GROUND_TEXTURES)
 std::vector<CSMFGroundTextures::GroundSquare> CSMFGroundTextures::squares;
 
 std::vector<int> CSMFGroundTextures::tileMap;
-std::vector<char> CSMFGroundTextures::tiles;
+std::vector< std::vector<std::uint8_t> > CSMFGroundTextures::tileFiles;
+std::vector<const std::uint8_t*> CSMFGroundTextures::tiles;
+std::vector<std::uint8_t> CSMFGroundTextures::missingTile;
 
 std::vector<float> CSMFGroundTextures::heightMaxima;
 std::vector<float> CSMFGroundTextures::heightMinima;
@@ -61,7 +63,7 @@ CSMFGroundTextures::GroundSquare::~GroundSquare()
 CSMFGroundTextures::CSMFGroundTextures(CSMFReadMap* rm): smfMap(rm)
 {
 	LoadTiles(smfMap->GetFile());
-	LoadSquareTextures(3);
+	// square textures are created on demand, see DrawUpdate
 	ConvolveHeightMap(mapDims.mapx, 1);
 }
 
@@ -87,8 +89,12 @@ void CSMFGroundTextures::LoadTiles(CSMFMapFile& file)
 
 	tileMap.clear();
 	tileMap.resize(smfMap->tileCount);
+	tileFiles.clear();
+	tileFiles.reserve(tileHeader.numTileFiles);
 	tiles.clear();
-	tiles.resize(tileHeader.numTiles * SMALL_TILE_SIZE);
+	tiles.resize(tileHeader.numTiles, nullptr);
+	missingTile.clear();
+	missingTile.resize(SMALL_TILE_SIZE, 0xaa);
 	squares.clear();
 	squares.resize(smfMap->numBigTexX * smfMap->numBigTexY);
 
@@ -137,8 +143,9 @@ void CSMFGroundTextures::LoadTiles(CSMFMapFile& file)
 				"(ALL %d MISSING TILES WILL BE MADE RED)",
 				smtFilePath.c_str(), numSmallTiles);
 
-			memset(&tiles[curTile * SMALL_TILE_SIZE], 0xaa, numSmallTiles * SMALL_TILE_SIZE);
-			curTile += numSmallTiles;
+			for (int b = 0; b < numSmallTiles && curTile < tileHeader.numTiles; ++b) {
+				tiles[curTile++] = missingTile.data();
+			}
 			continue;
 		}
 
@@ -151,12 +158,34 @@ void CSMFGroundTextures::LoadTiles(CSMFMapFile& file)
 			throw content_error(t);
 		}
 
-		for (int b = 0; b < numSmallTiles; ++b) {
-			tileFile.Read(&tiles[curTile * SMALL_TILE_SIZE], SMALL_TILE_SIZE);
-			curTile++;
+		// take over the file's buffer rather than copying each tile out of it
+		const size_t numTileBytes = size_t(numSmallTiles) * SMALL_TILE_SIZE;
+		size_t tileDataOffset = 0;
+
+		tileFiles.emplace_back();
+
+		if (tileFile.IsBuffered()) {
+			tileDataOffset = tileFile.GetPos();
+			tileFiles.back() = std::move(tileFile.GetBuffer());
+		} else {
+			tileFiles.back().resize(numTileBytes);
+			tileFile.Read(tileFiles.back().data(), numTileBytes);
+		}
+
+		// truncated files used to yield zeroed tiles as well
+		if (tileFiles.back().size() < (tileDataOffset + numTileBytes))
+			tileFiles.back().resize(tileDataOffset + numTileBytes, 0);
+
+		for (int b = 0; b < numSmallTiles && curTile < tileHeader.numTiles; ++b) {
+			tiles[curTile++] = &tileFiles.back()[tileDataOffset + b * SMALL_TILE_SIZE];
 		}
 	}
 
+	// tiles not covered by any tile-file
+	for (; curTile < tileHeader.numTiles; ++curTile) {
+		tiles[curTile] = missingTile.data();
+	}
+
 	ifs->Read(&tileMap[0], smfMap->tileCount * sizeof(int));
 
 	for (int i = 0; i < smfMap->tileCount; i++) {
@@ -170,18 +199,6 @@ void CSMFGroundTextures::LoadTiles(CSMFMapFile& file)
 	tileTexFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
 }
 
-void CSMFGroundTextures::LoadSquareTextures(const int mipLevel)
-{
-	loadscreen->SetLoadMessage("Loading Square Textures");
-
-	for (int y = 0; y < smfMap->numBigTexY; ++y) {
-		for (int x = 0; x < smfMap->numBigTexX; ++x) {
-			// start at the lowest mip-level
-			LoadSquareTexture(x, y, mipLevel);
-		}
-	}
-}
-
 void CSMFGroundTextures::ConvolveHeightMap(const int mapWidth, const int mipLevel)
 {
 	ScopedOnceTimer timer("CSMFGroundTextures::ConvolveHeightMap");
@@ -291,6 +308,10 @@ void CSMFGroundTextures::DrawUpdate()
 			}
 
 			if (!TexSquareInView(x, y)) {
+				// never been needed; stays unloaded until it is
+				if (!square->HasRawTexture())
+					continue;
+
 				if ((square->GetMipLevel() < 3) && ((globalRendering->drawFrame - square->GetDrawFrame()) > 120)) {
 					// `unload` texture (load lowest mip-map) if
 					// the square wasn't visible for 120 vframes
@@ -349,7 +370,7 @@ void CSMFGroundTextures::DrawUpdate()
 			if (stretchFactors[y * smfMap->numBigTexX + x] > 16000 && wantedLevel > 0)
 				wantedLevel--;
 
-			if (square->GetMipLevel() != wantedLevel) {
+			if (square->GetMipLevel() != wantedLevel || !square->HasRawTexture()) {
 				LoadSquareTexture(x, y, wantedLevel);
 			}
 		}
@@ -426,7 +447,7 @@ void CSMFGroundTextures::ExtractSquareTiles(
 			const int tileX = tileOffsetX + x1;
 			const int tileY = tileOffsetY + y1;
 			const int tileIdx = tileMap[tileY * smfMap->tileMapSizeX + tileX];
-			const GLint* tile = (GLint*) &tiles[tileIdx * SMALL_TILE_SIZE + mipOffset];
+			const GLint* tile = (const GLint*) (tiles[tileIdx] + mipOffset);
 
 			const int doff = (x1 * numBlocks) + (y1 * numBlocks * numBlocks) * BLOCK_SIZE;
 
@@ -488,6 +509,12 @@ void CSMFGroundTextures::BindSquareTexture(int texSquareX, int texSquareY)
 	assert(texSquareY < smfMap->numBigTexY);
 
 	GroundSquare* square = &squares[texSquareY * smfMap->numBigTexX + texSquareX];
+
+	// squares outside the camera view (e.g. in a shadow or reflection pass)
+	// might not have been loaded by DrawUpdate yet
+	if (!square->HasLuaTexture() && !square->HasRawTexture())
+		LoadSquareTexture(texSquareX, texSquareY, 3);
+
 	glBindTexture(GL_TEXTURE_2D, square->GetTextureID());
 
 	if (game->GetDrawMode() == Game::NormalDraw) {
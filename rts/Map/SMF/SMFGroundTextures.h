@@ -3,6 +3,7 @@
 #ifndef _SMF_GROUND_TEXTURES_H_
 #define _SMF_GROUND_TEXTURES_H_
 
+#include <cstdint>
 #include <vector>
 
 #include "Map/BaseGroundTextures.h"
@@ -24,7 +25,6 @@ public:
 
 protected:
 	void LoadTiles(CSMFMapFile& file);
-	void LoadSquareTextures(const int mipLevel);
 	void ConvolveHeightMap(const int mapWidth, const int mipLevel);
 	void ExtractSquareTiles(const int texSquareX, const int texSquareY, const int mipLevel, GLint* tileBuf) const;
 	void LoadSquareTexture(int x, int y, int level);
@@ -44,6 +44,7 @@ private:
 		~GroundSquare();
 
 		bool HasLuaTexture() const { return (textureIDs[LUA_TEX_IDX] != 0); }
+		bool HasRawTexture() const { return (textureIDs[RAW_TEX_IDX] != 0); }
 
 		void SetRawTexture(unsigned int id) { textureIDs[RAW_TEX_IDX] = id; }
 		void SetLuaTexture(unsigned int id) { textureIDs[LUA_TEX_IDX] = id; }
@@ -65,7 +66,11 @@ private:
 	static std::vector<GroundSquare> squares;
 
 	static std::vector<int> tileMap;
-	static std::vector<char> tiles;
+	// contents of the .smt files, kept as loaded (no per-tile copies)
+	static std::vector< std::vector<std::uint8_t> > tileFiles;
+	// start of each tile's data, inside tileFiles or missingTile
+	static std::vector<const std::uint8_t*> tiles;
+	static std::vector<std::uint8_t> missingTile;
 
 	// FIXME? these are not updated at runtime
 	static std::vector<float> heightMaxima;
@@ -93,19 +93,27 @@ void CSMFMapFile::ReadHeightmap(float* sHeightMap, float* uHeightMap, float base
 {
 	const int hmx = header.mapx + 1;
 	const int hmy = header.mapy + 1;
-	unsigned short* temphm = new unsigned short[hmx * hmy];
 
-	ifs.Seek(header.heightmapPtr);
-	ifs.Read(temphm, hmx * hmy * 2);
+	std::vector<unsigned short> temphm;
+
+	// convert straight from the file image if possible
+	const unsigned short* hm = reinterpret_cast<const unsigned short*>(GetFileData(header.heightmapPtr, hmx * hmy * sizeof(short)));
+
+	if (hm == nullptr) {
+		temphm.resize(hmx * hmy);
+
+		ifs.Seek(header.heightmapPtr);
+		ifs.Read(temphm.data(), hmx * hmy * sizeof(short));
+
+		hm = temphm.data();
+	}
 
 	for (int y = 0; y < hmx * hmy; ++y) {
-		const float h = base + swabWord(temphm[y]) * mod;
+		const float h = base + swabWord(hm[y]) * mod;
 
 		if (sHeightMap != NULL) { sHeightMap[y] = h; }
 		if (uHeightMap != NULL) { uHeightMap[y] = h; }
 	}
-
-	delete[] temphm;
 }
 
 
@@ -170,8 +178,64 @@ void CSMFMapFile::GetInfoMapSize(const std::string& name, MapBitmapInfo* info) c
 }
 
 
+const std::uint8_t* CSMFMapFile::GetFileData(int offset, int size)
+{
+	if (!ifs.IsBuffered())
+		return nullptr;
+
+	const std::vector<std::uint8_t>& buffer = ifs.GetBuffer();
+
+	if (offset < 0 || size < 0 || (size_t(offset) + size) > buffer.size())
+		return nullptr;
+
+	return &buffer[offset];
+}
+
+const std::uint8_t* CSMFMapFile::GetInfoMapData(const std::string& name)
+{
+	MapBitmapInfo info;
+	GetInfoMapSize(name, &info);
+
+	if (name == "grass") {
+		const int offset = GetGrassMapOffset();
+
+		if (offset == 0)
+			return nullptr;
+
+		return (GetFileData(offset, info.width * info.height));
+	}
+	if (name == "metal")
+		return (GetFileData(header.metalmapPtr, info.width * info.height));
+	if (name == "type")
+		return (GetFileData(header.typeMapPtr, info.width * info.height));
+
+	return nullptr;
+}
+
+bool CSMFMapFile::IsFileData(const void* ptr)
+{
+	if (!ifs.IsBuffered())
+		return false;
+
+	const std::vector<std::uint8_t>& buffer = ifs.GetBuffer();
+	const std::uint8_t* p = reinterpret_cast<const std::uint8_t*>(ptr);
+
+	return (p >= buffer.data() && p < (buffer.data() + buffer.size()));
+}
+
+
 bool CSMFMapFile::ReadInfoMap(const std::string& name, void* data)
 {
+	// 8-bit maps can be copied straight out of the file image
+	const std::uint8_t* src = (name != "height")? GetInfoMapData(name): nullptr;
+
+	if (src != nullptr) {
+		MapBitmapInfo info;
+		GetInfoMapSize(name, &info);
+		memcpy(data, src, info.width * info.height);
+		return true;
+	}
+
 	if (name == "height") {
 		ReadHeightmap((unsigned short*)data);
 		return true;
@@ -194,6 +258,19 @@ bool CSMFMapFile::ReadInfoMap(const std::string& name, void* data)
 
 
 bool CSMFMapFile::ReadGrassMap(void *data)
+{
+	const int offset = GetGrassMapOffset();
+
+	if (offset == 0)
+		return false;
+
+	ifs.Seek(offset);
+	ifs.Read(data, header.mapx / 4 * header.mapy / 4);
+	/* char; no swabbing. */
+	return true;
+}
+
+int CSMFMapFile::GetGrassMapOffset()
 {
 	ifs.Seek(sizeof(SMFHeader));
 
@@ -204,22 +281,18 @@ bool CSMFMapFile::ReadGrassMap(void *data)
 		int type;
 		ifs.Read(&type, 4);
 		swabDWordInPlace(type);
+
 		if (type == MEH_Vegetation) {
 			int pos;
 			ifs.Read(&pos, 4);
 			swabDWordInPlace(pos);
-			ifs.Seek(pos);
-			ifs.Read(data, header.mapx / 4 * header.mapy / 4);
-			/* char; no swabbing. */
-			return true; //we arent interested in other extensions anyway
-		}
-		else {
-			// assumes we can use data as scratch memory
-			assert(size - 8 <= header.mapx / 4 * header.mapy / 4);
-			ifs.Read(data, size - 8);
+			return pos; //we arent interested in other extensions anyway
 		}
+
+		ifs.Seek(size - 8, std::ios_base::cur);
 	}
-	return false;
+
+	return 0;
 }
 
 /// read a float from file (endian aware)
@@ -35,6 +35,19 @@ public:
 
 	const SMFHeader& GetHeader() const { return header; }
 
+	/**
+	 * In-place views of the file's memory image (maps always come from the
+	 * VFS, which buffers the whole file) that avoid copying large sections.
+	 * @return nullptr if the file is not buffered or the requested section
+	 *   does not lie within it; the data must not be modified and remains
+	 *   valid for the lifetime of this object
+	 */
+	const std::uint8_t* GetFileData(int offset, int size);
+	/// only for the 8-bit maps ("grass", "metal", "type")
+	const std::uint8_t* GetInfoMapData(const std::string& name);
+	/// @return true if <ptr> points into the file's memory image
+	bool IsFileData(const void* ptr);
+
 	/**
 	 * @deprecated do not use, just here for backward compatibility
 	 *   with SMFGroundTextures.cpp
@@ -45,6 +58,7 @@ public:
 
 private:
 	bool ReadGrassMap(void* data);
+	int GetGrassMapOffset();
 	void ReadMapHeader(SMFHeader& head, CFileHandler& file);
 	void ReadMapFeatureHeader(MapFeatureHeader& head, CFileHandler& file);
 	void ReadMapFeatureStruct(MapFeatureStruct& head, CFileHandler& file);
@@ -68,17 +68,24 @@ CSMFReadMap::CSMFReadMap(std::string mapname)
 	LoadHeightMap();
 	CReadMap::Initialize();
 
-	LoadMinimap();
-
 	ConfigureTexAnisotropyLevels();
 	InitializeWaterHeightColors();
 
+	#ifndef HEADLESS
+	LoadMinimap();
+
 	CreateSpecularTex();
 	CreateSplatDetailTextures();
 	CreateGrassTex();
 	CreateDetailTex();
 	CreateShadingTex();
 	CreateNormalTex();
+	#else
+	// headless builds never draw; the texture images would be decoded (and
+	// the shading buffer allocated) only to go unused, so none are loaded
+	shadingTexUpdateNeeded   = false;
+	shadingTexUpdateProgress = -1;
+	#endif
 
 	file.ReadFeatureInfo();
 }
@@ -112,8 +119,13 @@ void CSMFReadMap::LoadHeightMap()
 	cornerHeightMapSynced.clear();
 	cornerHeightMapSynced.resize((mapDims.mapx + 1) * (mapDims.mapy + 1));
 	#ifdef USE_UNSYNCED_HEIGHTMAP
-	cornerHeightMapUnsynced.clear();
-	cornerHeightMapUnsynced.resize((mapDims.mapx + 1) * (mapDims.mapy + 1));
+	// compact mode, aliased by the synced heightmap
+	if (unsyncedSharesSynced) {
+		std::vector<float>().swap(cornerHeightMapUnsynced);
+	} else {
+		cornerHeightMapUnsynced.clear();
+		cornerHeightMapUnsynced.resize((mapDims.mapx + 1) * (mapDims.mapy + 1));
+	}
 	#endif
 
 	heightMapSyncedPtr   = &cornerHeightMapSynced;
@@ -356,8 +368,11 @@ void CSMFReadMap::UpdateHeightMapUnsynced(const SRectangle& update)
 {
 	UpdateVertexNormalsUnsynced(update);
 	UpdateFaceNormalsUnsynced(update);
+
+	#ifndef HEADLESS
 	UpdateNormalTexture(update);
 	UpdateShadingTexture(update);
+	#endif
 }
 
 
@@ -365,8 +380,7 @@ void CSMFReadMap::UpdateVertexNormalsUnsynced(const SRectangle& update)
 {
 	#ifdef USE_UNSYNCED_HEIGHTMAP
 	const float*  shm = &cornerHeightMapSynced[0];
-		  float*  uhm = &cornerHeightMapUnsynced[0];
-		  float3* vvn = &visVertexNormals[0];
+		  float*  uhm = (unsyncedSharesSynced)? nullptr: &cornerHeightMapUnsynced[0];
 
 	const int W = mapDims.mapxp1;
 	const int H = mapDims.mapyp1;
@@ -433,8 +447,10 @@ void CSMFReadMap::UpdateVertexNormalsUnsynced(const SRectangle& update)
 			vn += vml.cross(vbl) * (zOffB & xOffL); assert(vml.cross(vbl).y >= 0.0f);
 
 			// update the visible vertex/face height/normal
-			uhm[vIdxTL] = shm[vIdxTL];
-			vvn[vIdxTL] = vn.ANormalize();
+			if (uhm != nullptr)
+				uhm[vIdxTL] = shm[vIdxTL];
+
+			SetVisVertexNormal(vIdxTL, vn.ANormalize());
 		}
 	});
 	#endif
@@ -444,6 +460,10 @@ void CSMFReadMap::UpdateVertexNormalsUnsynced(const SRectangle& update)
 void CSMFReadMap::UpdateFaceNormalsUnsynced(const SRectangle& update)
 {
 	#ifdef USE_UNSYNCED_HEIGHTMAP
+	// nothing to copy
+	if (unsyncedSharesSynced)
+		return;
+
 	const float3* sfn = &faceNormalsSynced[0];
 	      float3* ufn = &faceNormalsUnsynced[0];
 	const float3* scn = &centerNormalsSynced[0];
@@ -473,8 +493,6 @@ void CSMFReadMap::UpdateFaceNormalsUnsynced(const SRectangle& update)
 void CSMFReadMap::UpdateNormalTexture(const SRectangle& update)
 {
 	// Update VertexNormalsTexture;  texture space is [0 .. mapDims.mapx] x [0 .. mapDims.mapy] (NPOT; vertex-aligned)
-	float3* vvn = &visVertexNormals[0];
-
 	// a heightmap update over (x1, y1) - (x2, y2) implies the
 	// normals change over (x1 - 1, y1 - 1) - (x2 + 1, y2 + 1)
 	const int minx = std::max(update.x1 - 1,           0);
@@ -499,7 +517,7 @@ void CSMFReadMap::UpdateNormalTexture(const SRectangle& update)
 
 	for (int z = minz; z <= maxz; z++) {
 		for (int x = minx; x <= maxx; x++) {
-			const float3& vertNormal = vvn[z * mapDims.mapxp1 + x];
+			const float3 vertNormal = GetVisVertexNormalUnsynced(z * mapDims.mapxp1 + x);
 
 		#if (SSMF_UNCOMPRESSED_NORMALS == 1)
 			pixels[((z - minz) * xsize + (x - minx)) * 4 + 0] = vertNormal.x;
@@ -627,7 +645,7 @@ void CSMFReadMap::UpdateShadingTexPart(int idx1, int idx2, unsigned char* dst) c
 
 float CSMFReadMap::DiffuseSunCoeff(const int x, const int y) const
 {
-	const float3& N = centerNormalsUnsynced[y * mapDims.mapx + x];
+	const float3& N = GetCenterNormalsUnsynced()[y * mapDims.mapx + x];
 	const float3& L = sky->GetLight()->GetLightDir();
 	return Clamp(L.dot(N), 0.0f, 1.0f);
 }
@@ -649,11 +667,13 @@ float3 CSMFReadMap::GetLightValue(const int x, const int y) const
 
 void CSMFReadMap::SunChanged()
 {
+	#ifndef HEADLESS
 	if (shadingTexUpdateProgress < 0) {
 		shadingTexUpdateProgress = 0;
 	} else {
 		shadingTexUpdateNeeded = true;
 	}
+	#endif
 
 	groundDrawer->SunChanged();
 }
@@ -842,8 +862,6 @@ unsigned char* CSMFReadMap::GetInfoMap(const std::string& name, MapBitmapInfo* b
 	if (bmInfo->width <= 0)
 		return nullptr;
 
-	unsigned char* data = new unsigned char[bmInfo->width * bmInfo->height];
-
 	CBitmap infomapBM;
 	std::string texName;
 	if (name == "metal" && !mapInfo->smf.metalmapTexName.empty()) {
@@ -859,6 +877,7 @@ unsigned char* CSMFReadMap::GetInfoMap(const std::string& name, MapBitmapInfo* b
 
 	if (!infomapBM.Empty()) {
 		if (infomapBM.xsize == bmInfo->width && infomapBM.ysize == bmInfo->height) {
+			unsigned char* data = new unsigned char[bmInfo->width * bmInfo->height];
 			memcpy(data, infomapBM.GetRawMem(), bmInfo->width * bmInfo->height);
 			return data;
 		}
@@ -868,6 +887,14 @@ unsigned char* CSMFReadMap::GetInfoMap(const std::string& name, MapBitmapInfo* b
 		throw content_error(failMsg);
 	}
 
+	// hand out the 8-bit maps in place, callers only read them
+	const unsigned char* fileData = file.GetInfoMapData(name);
+
+	if (fileData != nullptr)
+		return (const_cast<unsigned char*>(fileData));
+
+	unsigned char* data = new unsigned char[bmInfo->width * bmInfo->height * ((name == "height")? 2: 1)];
+
 	// get data
 	if (!file.ReadInfoMap(name, data)) {
 		delete[] data;
@@ -880,6 +907,9 @@ unsigned char* CSMFReadMap::GetInfoMap(const std::string& name, MapBitmapInfo* b
 
 void CSMFReadMap::FreeInfoMap(const std::string& name, unsigned char *data)
 {
+	if (file.IsFileData(data))
+		return;
+
 	delete[] data;
 }
 
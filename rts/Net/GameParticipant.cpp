@@ -15,6 +15,9 @@ GameParticipant::GameParticipant()
 , isLocal(false)
 , isReconn(false)
 , isMidgameJoin(false)
+#ifdef SYNCCHECK
+, syncLaneChecksum(0)
+#endif
 {
 	linkData[MAX_AIS] = PlayerLinkData(false);
 }
@@ -50,6 +53,7 @@ void GameParticipant::Kill(const std::string& reason, const bool flush)
 	linkData[MAX_AIS].link.reset();
 #ifdef SYNCCHECK
 	syncResponse.clear();
+	syncLanes.clear();
 #endif
 	myState = DISCONNECTED;
 }
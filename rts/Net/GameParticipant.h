@@ -4,6 +4,7 @@
 #define _GAME_PARTICIPANT_H
 
 #include <memory>
+#include <vector>
 
 #include "Game/Players/PlayerBase.h"
 #include "Game/Players/PlayerStatistics.h"
@@ -56,6 +57,10 @@ public:
 
 #ifdef SYNCCHECK
 	std::map<int, unsigned> syncResponse; // syncResponse[frameNum] = checksum
+
+	// checksum and per-subsystem checksums sent for CGameServer::syncLaneFrame
+	unsigned syncLaneChecksum;
+	std::vector<unsigned> syncLanes;
 #endif
 };
 
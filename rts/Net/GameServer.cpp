@@ -10,6 +10,7 @@
 #endif
 
 #include "GameServer.h"
+#include "GameServerHost.h"
 
 #include "GameParticipant.h"
 #include "GameSkirmishAI.h"
@@ -49,6 +50,7 @@
 #include "System/Net/Connection.h"
 #include "System/Net/LocalConnection.h"
 #include "System/Net/UnpackPacket.h"
+#include "System/Sync/SyncChecker.h"
 #include "System/LoadSave/DemoRecorder.h"
 #include "System/LoadSave/DemoReader.h"
 #include "System/Log/ILog.h"
@@ -131,7 +133,8 @@ CGameServer* gameServer = NULL;
 CGameServer::CGameServer(
 	const std::shared_ptr<const ClientSetup> newClientSetup,
 	const std::shared_ptr<const    GameData> newGameData,
-	const std::shared_ptr<const  CGameSetup> newGameSetup
+	const std::shared_ptr<const  CGameSetup> newGameSetup,
+	CGameServerHost* newServerHost
 )
 : quitServer(false)
 , serverFrameNum(-1)
@@ -163,9 +166,16 @@ CGameServer::CGameServer(
 
 , syncErrorFrame(0)
 , syncWarningFrame(0)
+#ifdef SYNCCHECK
+, syncLaneFrame(-1)
+, syncLaneChecksum(0)
+#endif
 
 , localClientNumber(-1u)
 
+, thread(nullptr)
+, serverHost(newServerHost)
+
 , gameHasStarted(false)
 , generatedGameID(false)
 , reloadingServer(false)
@@ -182,8 +192,13 @@ CGameServer::~CGameServer()
 	quitServer = true;
 
 	LOG_L(L_INFO, "[%s][1]", __FUNCTION__);
-	thread->join();
-	delete thread;
+	if (thread != nullptr) {
+		thread->join();
+		delete thread;
+	} else {
+		// hosted servers have no thread of their own to say goodbye from
+		SendQuitMessages();
+	}
 	LOG_L(L_INFO, "[%s][2]", __FUNCTION__);
 
 	// after this, demoRecorder goes out of scope and its dtor is called
@@ -203,10 +218,13 @@ void CGameServer::Initialize()
 	rng.Seed((myGameData->GetSetupText()).length());
 
 	// start network
-	if (!myGameSetup->onlyLocal)
+	if (serverHost != nullptr) {
+		UDPNet = serverHost->GetListener();
+	} else if (!myGameSetup->onlyLocal) {
 		UDPNet.reset(new netcode::UDPListener(myClientSetup->hostPort, myClientSetup->hostIP));
+	}
 
-	AddAutohostInterface(StringToLower(configHandler->GetString("AutohostIP")), configHandler->GetInt("AutohostPort"));
+	AddAutohostInterface(StringToLower(myClientSetup->autohostIP), myClientSetup->autohostPort);
 	Message(spring::format(ServerStart, myClientSetup->hostPort), false);
 
 	// start script
@@ -284,7 +302,8 @@ void CGameServer::Initialize()
 	linkMinPacketSize = globalConfig->linkIncomingMaxPacketRate > 0 ? (globalConfig->linkIncomingSustainedBandwidth / globalConfig->linkIncomingMaxPacketRate) : 1;
 	lastBandwidthUpdate = spring_gettime();
 
-	thread = new spring::thread(std::bind(&CGameServer::UpdateLoop, this));
+	if (serverHost == nullptr)
+		thread = new spring::thread(std::bind(&CGameServer::UpdateLoop, this));
 
 	// Something in CGameServer::CGameServer borks the FPU control word
 	// maybe the threading, or something in CNet::InitServer() ??
@@ -757,6 +776,20 @@ void CGameServer::CheckSync()
 				spring::exitCode = spring::EXIT_CODE_DESYNC;
 				#endif
 
+				// ask everybody for their per-subsystem checksums of this frame
+				// so the diverging subsystem can be named (see CheckSyncLanes)
+				syncLaneFrame = outstandingSyncFrame;
+				syncLaneChecksum = correctChecksum;
+
+				for (GameParticipant& p: players) {
+					const auto pChecksumIt = p.syncResponse.find(outstandingSyncFrame);
+
+					p.syncLanes.clear();
+					p.syncLaneChecksum = (pChecksumIt != p.syncResponse.end())? pChecksumIt->second: 0;
+				}
+
+				Broadcast(CBaseNetProtocol::Get().SendSyncLaneRequest(syncLaneFrame));
+
 				// For each group, output a message with list of player names in it.
 				// TODO this should be linked to the resync system so it can roundrobin
 				// the resync checksum request packets to multiple clients in the same group.
@@ -800,6 +833,55 @@ void CGameServer::CheckSync()
 }
 
 
+void CGameServer::CheckSyncLanes()
+{
+#ifdef SYNCCHECK
+	const GameParticipant* refPlayer = nullptr;
+
+	// any player that agreed on the correct checksum can serve as reference
+	for (const GameParticipant& p: players) {
+		if (p.syncLanes.size() != CSyncChecker::NUM_SYNC_LANES)
+			continue;
+		if (p.syncLaneChecksum != syncLaneChecksum)
+			continue;
+
+		refPlayer = &p;
+		break;
+	}
+
+	if (refPlayer == nullptr)
+		return;
+
+	for (GameParticipant& p: players) {
+		if (p.syncLanes.size() != CSyncChecker::NUM_SYNC_LANES)
+			continue;
+		if (p.syncLaneChecksum == syncLaneChecksum)
+			continue;
+
+		std::string laneNames;
+
+		for (unsigned i = 0; i < CSyncChecker::NUM_SYNC_LANES; ++i) {
+			if (p.syncLanes[i] == refPlayer->syncLanes[i])
+				continue;
+
+			if (!laneNames.empty())
+				laneNames += ", ";
+
+			laneNames += CSyncChecker::GetLaneName(i);
+		}
+
+		if (laneNames.empty())
+			laneNames = "<unknown>";
+
+		Message(spring::format(SyncLaneError, p.name.c_str(), syncLaneFrame, laneNames.c_str()));
+
+		// report each player only once per request
+		p.syncLanes.clear();
+	}
+#endif
+}
+
+
 float CGameServer::GetDemoTime() const {
 	if (!gameHasStarted) return gameTime;
 	return (startTime + serverFrameNum / float(GAME_SPEED));
@@ -1332,6 +1414,34 @@ void CGameServer::ProcessPacket(const unsigned playerNum, std::shared_ptr<const
 #endif
 		} break;
 
+		case NETMSG_SYNCLANE_RESPONSE: {
+#ifdef SYNCCHECK
+			try {
+				netcode::UnpackPacket pckt(packet, 1);
+
+				uint16_t packetSize; pckt >> packetSize;
+				uint8_t   playerNum; pckt >> playerNum;
+				int32_t    frameNum; pckt >> frameNum;
+
+				const uint32_t numLanes = (packetSize - 8) / sizeof(uint32_t);
+
+				if (playerNum != a)
+					throw netcode::UnpackPacketException("Invalid player number");
+				if (frameNum != syncLaneFrame || numLanes != CSyncChecker::NUM_SYNC_LANES)
+					break;
+
+				GameParticipant& p = players[a];
+
+				p.syncLanes.resize(numLanes);
+				pckt >> p.syncLanes;
+
+				CheckSyncLanes();
+			} catch (const netcode::UnpackPacketException& ex) {
+				Message(spring::format("[GameServer::%s][NETMSG_SYNCLANE_RESPONSE] exception \"%s\" from player \"%s\"", __func__, ex.what(), players[a].name.c_str()));
+			}
+#endif
+		} break;
+
 		case NETMSG_SHARE:
 			if (inbuf[1] != a) {
 				Message(spring::format(WrongPlayer, msgCode, a, (unsigned)inbuf[1]));
@@ -1810,75 +1920,122 @@ void CGameServer::ProcessPacket(const unsigned playerNum, std::shared_ptr<const
 
 void CGameServer::HandleConnectionAttempts()
 {
+	if (serverHost != nullptr) {
+		// the shared socket's queue belongs to serverHost, which
+		// already accepted these attempts before routing them to us
+		while (!routedConnections.empty()) {
+			HandleConnectionAttempt(routedConnections.front());
+			routedConnections.pop_front();
+		}
+
+		return;
+	}
+
 	while (UDPNet != nullptr && UDPNet->HasIncomingConnections()) {
-		std::shared_ptr<netcode::UDPConnection> prev = UDPNet->PreviewConnection().lock();
-		std::shared_ptr<const RawPacket> packet = prev->GetData();
+		HandleConnectionAttempt(UDPNet->PreviewConnection().lock());
+	}
+}
 
-		if (packet == nullptr) {
+void CGameServer::HandleConnectionAttempt(std::shared_ptr<netcode::UDPConnection> conn)
+{
+	std::shared_ptr<const RawPacket> packet = conn->GetData();
+
+	if (packet == nullptr) {
+		if (serverHost == nullptr)
 			UDPNet->RejectConnection();
-			continue;
-		}
 
-		try {
-			if (packet->length < 3) {
-				std::string pkts;
-				for (int i = 0; i < packet->length; ++i) {
-					pkts += spring::format(" 0x%x", (int)packet->data[i]);
-				}
-				throw netcode::UnpackPacketException("Packet too short (data: " + pkts + ")");
+		return;
+	}
+
+	try {
+		if (packet->length < 3) {
+			std::string pkts;
+			for (int i = 0; i < packet->length; ++i) {
+				pkts += spring::format(" 0x%x", (int)packet->data[i]);
 			}
+			throw netcode::UnpackPacketException("Packet too short (data: " + pkts + ")");
+		}
 
-			if (packet->data[0] != NETMSG_ATTEMPTCONNECT)
-				throw netcode::UnpackPacketException("Invalid message ID");
+		if (packet->data[0] != NETMSG_ATTEMPTCONNECT)
+			throw netcode::UnpackPacketException("Invalid message ID");
 
-			netcode::UnpackPacket msg(packet, 3);
-			std::string name, passwd, version;
-			unsigned char reconnect, netloss;
-			unsigned short netversion;
-			msg >> netversion;
-			msg >> name;
-			msg >> passwd;
-			msg >> version;
-			msg >> reconnect;
-			msg >> netloss;
+		netcode::UnpackPacket msg(packet, 3);
+		std::string name, passwd, version;
+		unsigned char reconnect, netloss;
+		unsigned short netversion;
+		msg >> netversion;
+		msg >> name;
+		msg >> passwd;
+		msg >> version;
+		msg >> reconnect;
+		msg >> netloss;
 
-			if (netversion != NETWORK_VERSION)
-				throw netcode::UnpackPacketException(spring::format("Wrong network version: received %d, required %d", (int)netversion, (int)NETWORK_VERSION));
+		if (netversion != NETWORK_VERSION)
+			throw netcode::UnpackPacketException(spring::format("Wrong network version: received %d, required %d", (int)netversion, (int)NETWORK_VERSION));
 
-			BindConnection(name, passwd, version, false, UDPNet->AcceptConnection(), reconnect, netloss);
-		} catch (const netcode::UnpackPacketException& ex) {
-			const asio::ip::udp::endpoint endp = prev->GetEndpoint();
-			const asio::ip::address addr = endp.address();
+		BindConnection(name, passwd, version, false, (serverHost == nullptr)? UDPNet->AcceptConnection(): conn, reconnect, netloss);
+	} catch (const netcode::UnpackPacketException& ex) {
+		const asio::ip::udp::endpoint endp = conn->GetEndpoint();
+		const asio::ip::address addr = endp.address();
 
-			const std::string str = addr.to_string();
-			const std::string msg = spring::format(ConnectionReject, str.c_str(), ex.what());
+		const std::string str = addr.to_string();
+		const std::string msg = spring::format(ConnectionReject, str.c_str(), ex.what());
 
-			auto  pair = std::make_pair(rejectedConnections.find(str), false);
-			auto& iter = pair.first;
+		auto  pair = std::make_pair(rejectedConnections.find(str), false);
+		auto& iter = pair.first;
 
-			if (iter == rejectedConnections.end()) {
-				pair = rejectedConnections.insert(std::make_pair(str, 0));
-				iter = pair.first;
-			}
+		if (iter == rejectedConnections.end()) {
+			pair = rejectedConnections.insert(std::make_pair(str, 0));
+			iter = pair.first;
+		}
 
-			if (iter->second < 5) {
-				rejectedConnections.insert(std::make_pair(str, iter->second + 1));
+		if (iter->second < 5) {
+			rejectedConnections.insert(std::make_pair(str, iter->second + 1));
 
-				prev->Unmute();
-				prev->SendData(CBaseNetProtocol::Get().SendRejectConnect(msg));
-				prev->Flush(true);
+			conn->Unmute();
+			conn->SendData(CBaseNetProtocol::Get().SendRejectConnect(msg));
+			conn->Flush(true);
 
-				Message(msg);
-			} else {
-				// silently drop
-				Message(msg, false, true);
-			}
+			Message(msg);
+		} else {
+			// silently drop
+			Message(msg, false, true);
+		}
 
+		if (serverHost == nullptr)
 			UDPNet->RejectConnection();
-		}
 	}
 }
 
+bool CGameServer::IsListedPlayer(const std::string& name) const
+{
+	std::lock_guard<spring::recursive_mutex> scoped_lock(gameServerMutex);
+
+	if (quitServer)
+		return false;
+
+	for (const GameParticipant& p: players) {
+		if (p.name == name)
+			return true;
+	}
+
+	return false;
+}
+
+bool CGameServer::AcceptsUnlistedSpectators() const
+{
+	std::lock_guard<spring::recursive_mutex> scoped_lock(gameServerMutex);
+
+	// unlisted names can only join as spectators (see BindConnection)
+	return (!quitServer && allowSpecJoin && (!gameHasStarted || canReconnect));
+}
+
+void CGameServer::AddRoutedConnection(std::shared_ptr<netcode::UDPConnection> conn)
+{
+	std::lock_guard<spring::recursive_mutex> scoped_lock(gameServerMutex);
+	routedConnections.push_back(conn);
+}
+
 
 void CGameServer::ServerReadNet()
 {
@@ -2068,8 +2225,9 @@ void CGameServer::StartGame(bool forced)
 	if (!canReconnect && !allowSpecJoin)
 		packetCache.clear(); // free memory
 
-	if (UDPNet && !canReconnect && !allowSpecJoin)
-		UDPNet->SetAcceptingConnections(false); // do not accept new connections
+	// do not accept new connections (a shared socket stays open for the other games)
+	if (UDPNet && !canReconnect && !allowSpecJoin && serverHost == nullptr)
+		UDPNet->SetAcceptingConnections(false);
 
 	// make sure initial game speed is within allowed range and send a new speed if not
 	UserSpeedChange(userSpeedFactor, SERVER_PLAYER);
@@ -2555,27 +2713,46 @@ void CGameServer::UpdateLoop()
 			Update();
 		}
 
-		if (hostif != nullptr)
-			hostif->SendQuit();
+		SendQuitMessages();
+	} CATCH_SPRING_ERRORS
+}
 
-		Broadcast(CBaseNetProtocol::Get().SendQuit("Server shutdown"));
+void CGameServer::UpdateHosted()
+{
+	// the shared socket is updated once per iteration by serverHost
+	std::lock_guard<spring::recursive_mutex> scoped_lock(gameServerMutex);
 
-		// this is to make sure the Flush has any effect at all (we don't want a forced flush)
-		// when reloading, we can assume there is only a local client and skip the sleep()'s
-		if (!reloadingServer && !myGameSetup->onlyLocal)
-			spring_sleep(spring_msecs(500));
+	if (quitServer)
+		return;
 
-		// flush the quit messages to reduce ugly network error messages on the client side
-		for (GameParticipant& p: players) {
-			if (p.link != nullptr)
-				p.link->Flush();
-		}
+	ServerReadNet();
+	Update();
+}
+
+void CGameServer::SendQuitMessages()
+{
+	if (hostif != nullptr)
+		hostif->SendQuit();
 
-		// now let clients close their connections
-		if (!reloadingServer && !myGameSetup->onlyLocal)
-			spring_sleep(spring_msecs(1500));
+	Broadcast(CBaseNetProtocol::Get().SendQuit("Server shutdown"));
 
-	} CATCH_SPRING_ERRORS
+	// this is to make sure the Flush has any effect at all (we don't want a forced flush)
+	// when reloading, we can assume there is only a local client and skip the sleep()'s
+	// hosted servers must not stall the other games sharing their thread, so skip them too
+	const bool waitForClients = (!reloadingServer && !myGameSetup->onlyLocal && serverHost == nullptr);
+
+	if (waitForClients)
+		spring_sleep(spring_msecs(500));
+
+	// flush the quit messages to reduce ugly network error messages on the client side
+	for (GameParticipant& p: players) {
+		if (p.link != nullptr)
+			p.link->Flush();
+	}
+
+	// now let clients close their connections
+	if (waitForClients)
+		spring_sleep(spring_msecs(1500));
 }
 
 
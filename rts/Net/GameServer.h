@@ -30,6 +30,7 @@ namespace netcode
 {
 	class RawPacket;
 	class CConnection;
+	class UDPConnection;
 	class UDPListener;
 }
 class CDemoReader;
@@ -38,6 +39,7 @@ class CDemoRecorder;
 class AutohostInterface;
 class ClientSetup;
 class CGameSetup;
+class CGameServerHost;
 class ChatMessage;
 class GameParticipant;
 class GameSkirmishAI;
@@ -65,10 +67,15 @@ class CGameServer
 {
 	friend class CCregLoadSaveHandler; // For initializing server state after load
 public:
+	/**
+	 * @param newServerHost if non-null, the server shares the host's UDP socket
+	 *   and is updated from the host's thread instead of spawning its own
+	 */
 	CGameServer(
 		const std::shared_ptr<const ClientSetup> newClientSetup,
 		const std::shared_ptr<const    GameData> newGameData,
-		const std::shared_ptr<const  CGameSetup> newGameSetup
+		const std::shared_ptr<const  CGameSetup> newGameSetup,
+		CGameServerHost* newServerHost = nullptr
 	);
 
 	CGameServer(const CGameServer&) = delete; // no-copy
@@ -98,6 +105,15 @@ public:
 	/// Is the server still running?
 	bool HasFinished() const;
 
+	/// one iteration of UpdateLoop, called by CGameServerHost for hosted servers
+	void UpdateHosted();
+	/// whether <name> is a player listed in this game's start script (see CGameServerHost)
+	bool IsListedPlayer(const std::string& name) const;
+	/// whether clients not listed in the start script may currently join as spectators
+	bool AcceptsUnlistedSpectators() const;
+	/// hands over a connection attempt that CGameServerHost routed to this game
+	void AddRoutedConnection(std::shared_ptr<netcode::UDPConnection> conn);
+
 	void UpdateSpeedControl(int speedCtrl);
 	static std::string SpeedControlToString(int speedCtrl);
 	static const std::set<std::string>& GetCommandBlackList() { return commandBlacklist; }
@@ -143,10 +159,13 @@ private:
 	void CheckForGameStart(bool forced = false);
 	void StartGame(bool forced);
 	void UpdateLoop();
+	void SendQuitMessages();
 	void Update();
 	void ProcessPacket(const unsigned playerNum, std::shared_ptr<const netcode::RawPacket> packet);
 	void CheckSync();
+	void CheckSyncLanes();
 	void HandleConnectionAttempts();
+	void HandleConnectionAttempt(std::shared_ptr<netcode::UDPConnection> conn);
 	void ServerReadNet();
 
 	void LagProtection();
@@ -244,6 +263,10 @@ private:
 	/////////////////// sync stuff ///////////////////
 #ifdef SYNCCHECK
 	std::set<int> outstandingSyncFrames;
+
+	/// frame for which per-subsystem checksums were last requested, and its correct checksum
+	int syncLaneFrame;
+	unsigned syncLaneChecksum;
 #endif
 	int syncErrorFrame;
 	int syncWarningFrame;
@@ -262,7 +285,7 @@ private:
 	/// If the server receives a command, it will forward it to clients if it is not in this set
 	static std::set<std::string> commandBlacklist;
 
-	std::unique_ptr<netcode::UDPListener> UDPNet;
+	std::shared_ptr<netcode::UDPListener> UDPNet;
 	std::unique_ptr<CDemoReader> demoReader;
 	std::unique_ptr<CDemoRecorder> demoRecorder;
 	std::unique_ptr<AutohostInterface> hostif;
@@ -270,6 +293,11 @@ private:
 	CGlobalUnsyncedRNG rng;
 	spring::thread* thread;
 
+	/// non-null if this server is one of several games hosted in one process
+	CGameServerHost* serverHost;
+	/// connection attempts routed to us by serverHost
+	std::deque< std::shared_ptr<netcode::UDPConnection> > routedConnections;
+
 	mutable spring::recursive_mutex gameServerMutex;
 
 	volatile bool gameHasStarted;
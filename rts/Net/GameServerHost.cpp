@@ -0,0 +1,193 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "GameServerHost.h"
+#include "GameServer.h"
+
+#include "Game/ClientSetup.h"
+#include "Net/Protocol/BaseNetProtocol.h"
+#include "System/Config/ConfigHandler.h"
+#include "System/Log/ILog.h"
+#include "System/Misc/SpringTime.h"
+#include "System/Net/RawPacket.h"
+#include "System/Net/UDPConnection.h"
+#include "System/Net/UDPListener.h"
+#include "System/Net/UnpackPacket.h"
+#include "System/Platform/errorhandler.h"
+#include "System/Platform/Threading.h"
+#include "System/SpringFormat.h"
+
+#include <functional>
+
+
+CGameServerHost::CGameServerHost(int hostPort, const std::string& hostIP)
+	: listener(new netcode::UDPListener(hostPort, hostIP))
+	, thread(nullptr)
+	, loopSleepTime(configHandler->GetInt("ServerSleepTime"))
+	, quitHost(false)
+{
+	thread = new spring::thread(std::bind(&CGameServerHost::UpdateLoop, this));
+}
+
+CGameServerHost::~CGameServerHost()
+{
+	quitHost = true;
+
+	thread->join();
+	delete thread;
+
+	// destroy the remaining games (sends quit messages and writes their demos)
+	games.clear();
+}
+
+
+unsigned CGameServerHost::AddGame(
+	const std::shared_ptr<const ClientSetup> clientSetup,
+	const std::shared_ptr<const    GameData> gameData,
+	const std::shared_ptr<const  CGameSetup> gameSetup
+) {
+	std::unique_ptr<CGameServer> game(new CGameServer(clientSetup, gameData, gameSetup, this));
+
+	std::lock_guard<spring::recursive_mutex> scoped_lock(gamesMutex);
+	games.push_back(std::move(game));
+
+	LOG("[GameServerHost::%s] hosting game %u (%u active)", __func__, unsigned(games.size() - 1), GetNumActiveGames());
+	return (games.size() - 1);
+}
+
+unsigned CGameServerHost::GetNumActiveGames() const
+{
+	std::lock_guard<spring::recursive_mutex> scoped_lock(gamesMutex);
+
+	unsigned numActiveGames = 0;
+
+	for (const auto& game: games) {
+		numActiveGames += (game != nullptr && !game->HasFinished());
+	}
+
+	return numActiveGames;
+}
+
+
+__FORCE_ALIGN_STACK__
+void CGameServerHost::UpdateLoop()
+{
+	try {
+		Threading::SetThreadName("netcode");
+		Threading::SetAffinity(~0);
+
+		while (!quitHost) {
+			spring_msecs(loopSleepTime).sleep(true);
+
+			listener->Update();
+
+			std::lock_guard<spring::recursive_mutex> scoped_lock(gamesMutex);
+
+			RouteConnectionAttempts();
+
+			for (const auto& game: games) {
+				if (game == nullptr)
+					continue;
+
+				game->UpdateHosted();
+			}
+
+			RemoveFinishedGames();
+		}
+	} CATCH_SPRING_ERRORS
+}
+
+
+void CGameServerHost::RouteConnectionAttempts()
+{
+	while (listener->HasIncomingConnections()) {
+		std::shared_ptr<netcode::UDPConnection> conn = listener->PreviewConnection().lock();
+		std::shared_ptr<const netcode::RawPacket> packet = conn->Peek(0);
+
+		if (packet == nullptr) {
+			listener->RejectConnection();
+			continue;
+		}
+
+		std::string name;
+
+		try {
+			if (packet->length < 3 || packet->data[0] != NETMSG_ATTEMPTCONNECT)
+				throw netcode::UnpackPacketException("Invalid message ID");
+
+			netcode::UnpackPacket msg(packet, 3);
+			unsigned short netversion;
+			msg >> netversion;
+			msg >> name;
+		} catch (const netcode::UnpackPacketException&) {
+			// let the first game reject it with the usual message
+		}
+
+		CGameServer* target = nullptr;
+		CGameServer* specTarget = nullptr;
+
+		unsigned numSpecTargets = 0;
+
+		for (const auto& game: games) {
+			if (game == nullptr)
+				continue;
+
+			// malformed attempts go to the first game, which rejects them
+			if (name.empty()) {
+				target = game.get();
+				break;
+			}
+
+			if (game->IsListedPlayer(name)) {
+				target = game.get();
+				break;
+			}
+
+			if (game->AcceptsUnlistedSpectators()) {
+				specTarget = game.get();
+				numSpecTargets += 1;
+			}
+		}
+
+		// the attempt does not say which game an unlisted spectator
+		// wants to watch, so only route it if there is one candidate
+		if (target == nullptr && numSpecTargets == 1)
+			target = specTarget;
+
+		if (target == nullptr) {
+			if (name.empty()) {
+				listener->RejectConnection();
+			} else if (numSpecTargets == 0) {
+				RejectConnection(spring::format("no hosted game accepts %s", name.c_str()));
+			} else {
+				RejectConnection(spring::format("%s is not listed in any hosted game and %u games accept spectators, cannot decide which to join", name.c_str(), numSpecTargets));
+			}
+
+			continue;
+		}
+
+		// the game parses (and possibly rejects) the attempt itself
+		target->AddRoutedConnection(listener->AcceptConnection());
+	}
+}
+
+void CGameServerHost::RejectConnection(const std::string& reason)
+{
+	std::shared_ptr<netcode::UDPConnection> conn = listener->AcceptConnection();
+
+	LOG_L(L_WARNING, "[GameServerHost::%s] rejected connection from %s: %s", __func__, conn->GetEndpoint().address().to_string().c_str(), reason.c_str());
+
+	conn->Unmute();
+	conn->SendData(CBaseNetProtocol::Get().SendRejectConnect(reason));
+	conn->Flush(true);
+}
+
+void CGameServerHost::RemoveFinishedGames()
+{
+	for (unsigned n = 0; n < games.size(); n++) {
+		if (games[n] == nullptr || !games[n]->HasFinished())
+			continue;
+
+		LOG("[GameServerHost::%s] game %u has finished", __func__, n);
+		games[n].reset();
+	}
+}
@@ -0,0 +1,75 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef _GAME_SERVER_HOST_H
+#define _GAME_SERVER_HOST_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "System/Threading/SpringThreading.h"
+
+namespace netcode
+{
+	class UDPListener;
+}
+class ClientSetup;
+class CGameServer;
+class CGameSetup;
+class GameData;
+
+/**
+ * @brief Hosts several CGameServer instances in one process
+ *
+ * All hosted games share a single UDP socket and are updated from a single
+ * thread. New connections are routed to the game whose start script lists
+ * the connecting player's name (see CGameServer::IsListedPlayer); unlisted
+ * clients are only let in as spectators if exactly one game accepts them,
+ * since the connection attempt does not name a game. The file system
+ * (archive scanner, VFS) is process-wide anyway, so it is scanned and loaded
+ * only once for all games.
+ */
+class CGameServerHost
+{
+public:
+	CGameServerHost(int hostPort, const std::string& hostIP);
+	CGameServerHost(const CGameServerHost&) = delete; // no-copy
+	~CGameServerHost();
+
+	/**
+	 * @brief start hosting another game
+	 * @return the game's index, used to address it in log output
+	 */
+	unsigned AddGame(
+		const std::shared_ptr<const ClientSetup> clientSetup,
+		const std::shared_ptr<const    GameData> gameData,
+		const std::shared_ptr<const  CGameSetup> gameSetup
+	);
+
+	/// number of games that have not finished yet
+	unsigned GetNumActiveGames() const;
+	/// true once every hosted game has finished
+	bool HasFinished() const { return (GetNumActiveGames() == 0); }
+
+	const std::shared_ptr<netcode::UDPListener>& GetListener() const { return listener; }
+
+private:
+	void UpdateLoop();
+	void RouteConnectionAttempts();
+	void RejectConnection(const std::string& reason);
+	void RemoveFinishedGames();
+
+private:
+	std::shared_ptr<netcode::UDPListener> listener;
+
+	/// indexed by game; finished games are destroyed and leave a null entry
+	std::vector< std::unique_ptr<CGameServer> > games;
+
+	spring::thread* thread;
+	mutable spring::recursive_mutex gamesMutex;
+
+	int loopSleepTime;
+	volatile bool quitHost;
+};
+
+#endif // _GAME_SERVER_HOST_H
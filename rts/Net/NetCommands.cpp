@@ -544,6 +544,7 @@ void CGame::ClientReadNet()
 
 #ifdef SYNCCHECK
 				// both NETMSG_SYNCRESPONSE and NETMSG_NEWFRAME are used for ping calculation by server
+				CSyncChecker::FinishFrame(gs->frameNum);
 				ASSERT_SYNCED(gs->frameNum);
 				ASSERT_SYNCED(CSyncChecker::GetChecksum());
 				clientNet->Send(CBaseNetProtocol::Get().SendSyncResponse(gu->myPlayerNum, gs->frameNum, CSyncChecker::GetChecksum()));
@@ -593,6 +594,22 @@ void CGame::ClientReadNet()
 #endif
 			} break;
 
+			case NETMSG_SYNCLANE_REQUEST: {
+#if (defined(SYNCCHECK))
+				// server detected a desync, report our per-subsystem checksums
+				// for the frame in question (empty if it already left history)
+				const int32_t frameNum = *(int32_t*)(inbuf + 1);
+
+				std::vector<uint32_t> laneChecksums(CSyncChecker::NUM_SYNC_LANES);
+
+				if (!CSyncChecker::GetFrameLanes(frameNum, &laneChecksums[0]))
+					laneChecksums.clear();
+
+				clientNet->Send(CBaseNetProtocol::Get().SendSyncLaneResponse(gu->myPlayerNum, frameNum, laneChecksums));
+#endif
+				AddTraffic(-1, packetCode, dataLength);
+			} break;
+
 
 			case NETMSG_COMMAND: {
 				try {
@@ -95,14 +95,15 @@ PacketType CBaseNetProtocol::SendPathCheckSum(uint8_t myPlayerNum, uint32_t chec
 }
 
 
-PacketType CBaseNetProtocol::SendCommand(uint8_t myPlayerNum, int32_t id, uint8_t options, const std::vector<float>& params)
+PacketType CBaseNetProtocol::SendCommand(uint8_t myPlayerNum, int32_t id, uint8_t options, const float* params, uint32_t numParams)
 {
-	const uint32_t payloadSize = sizeof(myPlayerNum) + sizeof(id) + sizeof(options) + (params.size() * sizeof(float));
+	const uint32_t payloadSize = sizeof(myPlayerNum) + sizeof(id) + sizeof(options) + (numParams * sizeof(float));
 	const uint32_t headerSize = sizeof(uint8_t) + sizeof(uint16_t);
 	const uint32_t packetSize = headerSize + payloadSize;
 
 	PackPacket* packet = new PackPacket(packetSize, NETMSG_COMMAND);
-	*packet << static_cast<uint16_t>(packetSize) << myPlayerNum << id << options << params;
+	*packet << static_cast<uint16_t>(packetSize) << myPlayerNum << id << options;
+	packet->WriteArray(params, numParams);
 	return PacketType(packet);
 }
 
@@ -134,13 +135,14 @@ PacketType CBaseNetProtocol::SendAICommand(
 	int32_t commandID,
 	int32_t aiCommandID,
 	uint8_t options,
-	const std::vector<float>& params
+	const float* params,
+	uint32_t numParams
 ) {
 	const int32_t commandTypeID = (aiCommandID != -1)? NETMSG_AICOMMAND_TRACKED: NETMSG_AICOMMAND;
 
 	const uint32_t payloadSize =
 		sizeof(myPlayerNum) + sizeof(aiID) + sizeof(unitID) + sizeof(commandID) + sizeof(options) +
-		(sizeof(commandTypeID) * (commandTypeID == NETMSG_AICOMMAND_TRACKED)) + (params.size() * sizeof(float));
+		(sizeof(commandTypeID) * (commandTypeID == NETMSG_AICOMMAND_TRACKED)) + (numParams * sizeof(float));
 	const uint32_t headerSize = sizeof(uint8_t) + sizeof(uint16_t);
 	const uint32_t packetSize = headerSize + payloadSize;
 
@@ -154,7 +156,7 @@ PacketType CBaseNetProtocol::SendAICommand(
 	if (commandTypeID == NETMSG_AICOMMAND_TRACKED)
 		*packet << aiCommandID;
 
-	*packet << params;
+	packet->WriteArray(params, numParams);
 	return PacketType(packet);
 }
 
@@ -337,6 +339,24 @@ PacketType CBaseNetProtocol::SendSyncResponse(uint8_t myPlayerNum, int32_t frame
 	return PacketType(packet);
 }
 
+PacketType CBaseNetProtocol::SendSyncLaneRequest(int32_t frameNum)
+{
+	PackPacket* packet = new PackPacket(sizeof(uint8_t) + sizeof(frameNum), NETMSG_SYNCLANE_REQUEST);
+	*packet << frameNum;
+	return PacketType(packet);
+}
+
+PacketType CBaseNetProtocol::SendSyncLaneResponse(uint8_t myPlayerNum, int32_t frameNum, const std::vector<uint32_t>& laneChecksums)
+{
+	const uint32_t payloadSize = sizeof(myPlayerNum) + sizeof(frameNum) + (laneChecksums.size() * sizeof(uint32_t));
+	const uint32_t headerSize = sizeof(uint8_t) + sizeof(uint16_t);
+	const uint32_t packetSize = headerSize + payloadSize;
+
+	PackPacket* packet = new PackPacket(packetSize, NETMSG_SYNCLANE_RESPONSE);
+	*packet << static_cast<uint16_t>(packetSize) << myPlayerNum << frameNum << laneChecksums;
+	return PacketType(packet);
+}
+
 PacketType CBaseNetProtocol::SendSystemMessage(uint8_t myPlayerNum, std::string message)
 {
 	if (message.size() > 65000) {
@@ -606,6 +626,8 @@ CBaseNetProtocol::CBaseNetProtocol()
 	proto->AddType(NETMSG_AI_CREATED, -1);
 	proto->AddType(NETMSG_AI_STATE_CHANGED, 4);
 	proto->AddType(NETMSG_GAME_FRAME_PROGRESS,5);
+	proto->AddType(NETMSG_SYNCLANE_REQUEST, 5);
+	proto->AddType(NETMSG_SYNCLANE_RESPONSE, -2);
 
 #ifdef SYNCDEBUG
 	proto->AddType(NETMSG_SD_CHKREQUEST, 5);
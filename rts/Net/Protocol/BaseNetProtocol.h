@@ -116,6 +116,9 @@ enum NETMSG {
 
 	NETMSG_GAME_FRAME_PROGRESS= 77, // int32_t frameNum # this special packet skips queue & cache entirely, indicates current game progress for clients fast-forwarding to current point the game #
 
+	NETMSG_SYNCLANE_REQUEST = 78, // int32_t frameNum # sent by server on desync, asks clients for their per-subsystem checksums of frameNum #
+	NETMSG_SYNCLANE_RESPONSE= 79, // uint16_t messageSize, uint8_t myPlayerNum, int32_t frameNum, std::vector<uint32_t> laneChecksums
+
 
 	NETMSG_LAST //max types of netmessages, internal only
 };
@@ -161,11 +164,11 @@ public:
 	PacketType SendRandSeed(uint32_t randSeed);
 	PacketType SendGameID(const uint8_t* buf);
 	PacketType SendPathCheckSum(uint8_t myPlayerNum, uint32_t checksum);
-	PacketType SendCommand(uint8_t myPlayerNum, int32_t id, uint8_t options, const std::vector<float>& params);
+	PacketType SendCommand(uint8_t myPlayerNum, int32_t id, uint8_t options, const float* params, uint32_t numParams);
 	PacketType SendSelect(uint8_t myPlayerNum, const std::vector<int16_t>& selectedUnitIDs);
 	PacketType SendPause(uint8_t myPlayerNum, uint8_t bPaused);
 
-	PacketType SendAICommand(uint8_t myPlayerNum, uint8_t aiID, int16_t unitID, int32_t commandID, int32_t aiCommandID, uint8_t options, const std::vector<float>& params);
+	PacketType SendAICommand(uint8_t myPlayerNum, uint8_t aiID, int16_t unitID, int32_t commandID, int32_t aiCommandID, uint8_t options, const float* params, uint32_t numParams);
 	PacketType SendAIShare(uint8_t myPlayerNum, uint8_t aiID, uint8_t sourceTeam, uint8_t destTeam, float metal, float energy, const std::vector<int16_t>& unitIDs);
 
 	PacketType SendUserSpeed(uint8_t myPlayerNum, float userSpeed);
@@ -184,6 +187,8 @@ public:
 	PacketType SendMapDrawLine(uint8_t myPlayerNum, int16_t x1, int16_t z1, int16_t x2, int16_t z2, bool);
 	PacketType SendMapDrawPoint(uint8_t myPlayerNum, int16_t x, int16_t z, const std::string& label, bool);
 	PacketType SendSyncResponse(uint8_t myPlayerNum, int32_t frameNum, uint32_t checksum);
+	PacketType SendSyncLaneRequest(int32_t frameNum);
+	PacketType SendSyncLaneResponse(uint8_t myPlayerNum, int32_t frameNum, const std::vector<uint32_t>& laneChecksums);
 	PacketType SendSystemMessage(uint8_t myPlayerNum, std::string message);
 	PacketType SendStartPos(uint8_t myPlayerNum, uint8_t teamNum, uint8_t readyState, float x, float y, float z);
 	PacketType SendPlayerInfo(uint8_t myPlayerNum, float cpuUsage, int32_t ping);
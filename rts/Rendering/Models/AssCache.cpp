@@ -0,0 +1,371 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "AssCache.h"
+#include "AssParser.h"
+#include "3DModel.h"
+#include "3DModelLog.h"
+
+#include "Sim/Misc/CollisionVolume.h"
+#include "System/CRC.h"
+#include "System/StringUtil.h"
+#include "System/Log/ILog.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileHandler.h"
+#include "System/FileSystem/FileQueryFlags.h"
+#include "System/FileSystem/FileSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+
+static constexpr char CACHE_MAGIC[8] = {'S', 'P', 'R', 'A', 'S', 'S', 'M', 'C'};
+
+struct StringRef {
+	std::uint32_t offset;
+	std::uint32_t length;
+};
+
+struct FileHeader {
+	char magic[8];
+
+	std::uint32_t version;
+	AssCache::CacheKey key;
+
+	// includes pieces that were never linked into the tree
+	std::uint32_t numPieces;
+	std::uint32_t numPieceRecords;
+	std::uint32_t numVertices;
+	std::uint32_t numIndices;
+	std::uint32_t numMaterialTextures;
+
+	std::uint32_t piecesOffset;
+	std::uint32_t materialsOffset;
+	std::uint32_t verticesOffset;
+	std::uint32_t indicesOffset;
+	std::uint32_t stringsOffset;
+	std::uint32_t stringsSize;
+
+	float3 mins;
+	float3 maxs;
+	float3 relMidPos;
+
+	float radius;
+	float height;
+};
+
+// one per S3DModel::pieceObjects entry, in flattened (depth-first) order
+struct PieceRecord {
+	StringRef name;
+
+	// index of another record, -1 for the root (always the first record)
+	std::int32_t parentIndex;
+
+	std::uint32_t firstVertex;
+	std::uint32_t numVertices;
+	std::uint32_t firstIndex;
+	std::uint32_t numIndices;
+	std::uint32_t numTexCoorChannels;
+
+	float3 offset;
+	float3 goffset;
+	float3 scales;
+	float3 mins;
+	float3 maxs;
+
+	float bakedMatrix[16];
+};
+
+static_assert(std::is_trivially_copyable<FileHeader>::value, "");
+static_assert(std::is_trivially_copyable<PieceRecord>::value, "");
+static_assert(std::is_trivially_copyable<SVertexData>::value, "");
+static_assert((sizeof(FileHeader) % 4) == 0 && (sizeof(PieceRecord) % 4) == 0 && (sizeof(SVertexData) % 4) == 0, "cache sections must stay 4-byte aligned");
+
+
+
+static std::uint32_t GetFileCheckSum(const std::string& filePath)
+{
+	CFileHandler f(filePath, SPRING_VFS_ZIP);
+
+	if (!f.FileExists())
+		return 0;
+
+	std::vector<std::uint8_t> buffer(f.FileSize());
+
+	if (!buffer.empty())
+		f.Read(buffer.data(), buffer.size());
+
+	return (CRC::GetCRC(buffer.data(), buffer.size()));
+}
+
+static bool IsValidRange(std::uint32_t offset, std::uint32_t count, size_t elemSize, size_t bufferSize)
+{
+	return ((std::uint64_t(offset) + std::uint64_t(count) * elemSize) <= bufferSize);
+}
+
+static StringRef AddString(std::string& strings, const std::string& s)
+{
+	const StringRef ref = {std::uint32_t(strings.size()), std::uint32_t(s.size())};
+	strings.append(s);
+	return ref;
+}
+
+
+
+AssCache::CacheKey AssCache::GetCacheKey(
+	const std::string& modelFilePath,
+	const std::string& metaFilePath,
+	unsigned int maxVertices,
+	unsigned int maxIndices
+) {
+	CacheKey key;
+	key.modelCheckSum = GetFileCheckSum(modelFilePath);
+	key.metaCheckSum = GetFileCheckSum(metaFilePath);
+	key.maxVertices = maxVertices;
+	key.maxIndices = maxIndices;
+	return key;
+}
+
+std::string AssCache::GetCacheFileName(const std::string& modelFilePath, const CacheKey& key)
+{
+	CRC crc;
+	crc.Update(modelFilePath.data(), modelFilePath.size());
+	crc << key.modelCheckSum << key.metaCheckSum << key.maxVertices << key.maxIndices;
+
+	return (FileSystem::GetCacheDir() + "/models/" + FileSystem::GetBasename(modelFilePath) + "-" + IntToString(crc.GetDigest(), "%08x") + ".smc");
+}
+
+
+
+bool AssCache::ReadModel(
+	const std::string& cacheFileName,
+	const CacheKey& key,
+	S3DModel* model,
+	std::vector<std::string>& materialTextures
+) {
+	CFileHandler f(cacheFileName, SPRING_VFS_RAW);
+
+	if (!f.FileExists())
+		return false;
+
+	std::vector<std::uint8_t> buffer(f.FileSize());
+
+	if (buffer.size() < sizeof(FileHeader) || f.Read(buffer.data(), buffer.size()) != int(buffer.size()))
+		return false;
+
+	FileHeader header;
+	std::memcpy(&header, buffer.data(), sizeof(header));
+
+	if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.version != CACHE_VERSION)
+		return false;
+	if (std::memcmp(&header.key, &key, sizeof(key)) != 0)
+		return false;
+
+	// validate everything up-front, a truncated or corrupt file means a cache-miss
+	if (header.numPieceRecords == 0 || header.numPieceRecords > header.numPieces)
+		return false;
+	if (!IsValidRange(header.piecesOffset, header.numPieceRecords, sizeof(PieceRecord), buffer.size()))
+		return false;
+	if (!IsValidRange(header.materialsOffset, header.numMaterialTextures, sizeof(StringRef), buffer.size()))
+		return false;
+	if (!IsValidRange(header.verticesOffset, header.numVertices, sizeof(SVertexData), buffer.size()))
+		return false;
+	if (!IsValidRange(header.indicesOffset, header.numIndices, sizeof(std::uint32_t), buffer.size()))
+		return false;
+	if (!IsValidRange(header.stringsOffset, header.stringsSize, 1, buffer.size()))
+		return false;
+
+	std::vector<PieceRecord> pieceRecords(header.numPieceRecords);
+	std::vector<StringRef> materialRefs(header.numMaterialTextures);
+
+	std::memcpy(pieceRecords.data(), &buffer[header.piecesOffset], pieceRecords.size() * sizeof(PieceRecord));
+	std::memcpy(materialRefs.data(), &buffer[header.materialsOffset], materialRefs.size() * sizeof(StringRef));
+
+	const auto IsValidString = [&](const StringRef& ref) { return ((std::uint64_t(ref.offset) + ref.length) <= header.stringsSize); };
+	const auto GetString = [&](const StringRef& ref) { return std::string(reinterpret_cast<const char*>(&buffer[header.stringsOffset + ref.offset]), ref.length); };
+
+	for (size_t i = 0; i < pieceRecords.size(); i++) {
+		const PieceRecord& rec = pieceRecords[i];
+
+		if (!IsValidString(rec.name))
+			return false;
+		if ((std::uint64_t(rec.firstVertex) + rec.numVertices) > header.numVertices)
+			return false;
+		if ((std::uint64_t(rec.firstIndex) + rec.numIndices) > header.numIndices)
+			return false;
+		// the first record is the root (S3DModel::GetRootPiece), only it has no parent
+		if ((i == 0) != (rec.parentIndex < 0) || rec.parentIndex >= std::int32_t(pieceRecords.size()))
+			return false;
+	}
+
+	// every chain of parents has to end at the root, otherwise the records form a cycle
+	for (size_t i = 0; i < pieceRecords.size(); i++) {
+		std::int32_t parentIndex = pieceRecords[i].parentIndex;
+
+		for (size_t n = 0; n < pieceRecords.size() && parentIndex > 0; n++) {
+			parentIndex = pieceRecords[parentIndex].parentIndex;
+		}
+
+		if (parentIndex > 0)
+			return false;
+	}
+
+	if (!std::all_of(materialRefs.begin(), materialRefs.end(), IsValidString))
+		return false;
+
+
+	const SVertexData* vertices = reinterpret_cast<const SVertexData*>(&buffer[header.verticesOffset]);
+	const std::uint32_t* indices = reinterpret_cast<const std::uint32_t*>(&buffer[header.indicesOffset]);
+
+	// records are already in flattened order
+	for (const PieceRecord& rec: pieceRecords) {
+		SAssPiece* piece = new SAssPiece();
+
+		piece->name = GetString(rec.name);
+		piece->offset = rec.offset;
+		piece->goffset = rec.goffset;
+		piece->scales = rec.scales;
+		piece->mins = rec.mins;
+		piece->maxs = rec.maxs;
+
+		CMatrix44f bakedMatrix;
+		std::memcpy(&bakedMatrix.m[0], rec.bakedMatrix, sizeof(rec.bakedMatrix));
+
+		piece->SetBakedMatrix(bakedMatrix);
+		piece->SetNumTexCoorChannels(rec.numTexCoorChannels);
+		piece->SetCollisionVolume(CollisionVolume('b', 'z', piece->maxs - piece->mins, (piece->maxs + piece->mins) * 0.5f));
+
+		piece->vertices.assign(vertices + rec.firstVertex, vertices + rec.firstVertex + rec.numVertices);
+		piece->indices.assign(indices + rec.firstIndex, indices + rec.firstIndex + rec.numIndices);
+
+		model->AddPiece(piece);
+	}
+
+	// link once all pieces exist, parents need not precede their children
+	for (size_t i = 1; i < pieceRecords.size(); i++) {
+		S3DModelPiece* piece = model->GetPiece(i);
+
+		piece->parent = model->GetPiece(pieceRecords[i].parentIndex);
+		piece->parent->children.push_back(piece);
+	}
+
+	materialTextures.clear();
+	materialTextures.reserve(materialRefs.size());
+
+	for (const StringRef& ref: materialRefs) {
+		materialTextures.emplace_back(GetString(ref));
+	}
+
+	model->numPieces = header.numPieces;
+	model->mins = header.mins;
+	model->maxs = header.maxs;
+	model->relMidPos = header.relMidPos;
+	model->radius = header.radius;
+	model->height = header.height;
+
+	LOG_SL(LOG_SECTION_MODEL, L_INFO, "Loaded model %s from cache-file %s", model->name.c_str(), cacheFileName.c_str());
+	return true;
+}
+
+bool AssCache::WriteModel(
+	const std::string& cacheFileName,
+	const CacheKey& key,
+	const S3DModel* model,
+	const std::vector<std::string>& materialTextures
+) {
+	std::vector<PieceRecord> pieceRecords(model->pieceObjects.size());
+	std::vector<StringRef> materialRefs;
+	std::vector<SVertexData> vertices;
+	std::vector<std::uint32_t> indices;
+	std::string strings;
+
+	for (size_t i = 0; i < model->pieceObjects.size(); i++) {
+		const SAssPiece* piece = static_cast<const SAssPiece*>(model->pieceObjects[i]);
+		const auto parentIt = std::find(model->pieceObjects.begin(), model->pieceObjects.end(), piece->parent);
+
+		PieceRecord& rec = pieceRecords[i];
+
+		rec.name = AddString(strings, piece->name);
+		rec.parentIndex = (piece->HasParent())? std::int32_t(parentIt - model->pieceObjects.begin()): -1;
+
+		rec.firstVertex = vertices.size();
+		rec.numVertices = piece->vertices.size();
+		rec.firstIndex = indices.size();
+		rec.numIndices = piece->indices.size();
+		rec.numTexCoorChannels = piece->GetNumTexCoorChannels();
+
+		rec.offset = piece->offset;
+		rec.goffset = piece->goffset;
+		rec.scales = piece->scales;
+		rec.mins = piece->mins;
+		rec.maxs = piece->maxs;
+		std::memcpy(rec.bakedMatrix, &piece->bakedMatrix.m[0], sizeof(rec.bakedMatrix));
+
+		vertices.insert(vertices.end(), piece->vertices.begin(), piece->vertices.end());
+		indices.insert(indices.end(), piece->indices.begin(), piece->indices.end());
+	}
+
+	for (const std::string& tex: materialTextures) {
+		materialRefs.push_back(AddString(strings, tex));
+	}
+
+	FileHeader header;
+	std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+
+	header.version = CACHE_VERSION;
+	header.key = key;
+
+	header.numPieces = model->numPieces;
+	header.numPieceRecords = pieceRecords.size();
+	header.numVertices = vertices.size();
+	header.numIndices = indices.size();
+	header.numMaterialTextures = materialRefs.size();
+
+	header.piecesOffset    = sizeof(FileHeader);
+	header.materialsOffset = header.piecesOffset    + pieceRecords.size() * sizeof(PieceRecord);
+	header.verticesOffset  = header.materialsOffset + materialRefs.size() * sizeof(StringRef);
+	header.indicesOffset   = header.verticesOffset  + vertices.size() * sizeof(SVertexData);
+	header.stringsOffset   = header.indicesOffset   + indices.size() * sizeof(std::uint32_t);
+	header.stringsSize     = strings.size();
+
+	header.mins = model->mins;
+	header.maxs = model->maxs;
+	header.relMidPos = model->relMidPos;
+	header.radius = model->radius;
+	header.height = model->height;
+
+	if (!FileSystem::CreateDirectory(FileSystem::GetDirectory(cacheFileName)))
+		return false;
+
+	const std::string filePath = dataDirsAccess.LocateFile(cacheFileName, FileQueryFlags::WRITE);
+	const std::string tempPath = filePath + ".tmp";
+
+	{
+		std::ofstream ofs(tempPath.c_str(), std::ios::out | std::ios::binary);
+
+		ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		ofs.write(reinterpret_cast<const char*>(pieceRecords.data()), pieceRecords.size() * sizeof(PieceRecord));
+		ofs.write(reinterpret_cast<const char*>(materialRefs.data()), materialRefs.size() * sizeof(StringRef));
+		ofs.write(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(SVertexData));
+		ofs.write(reinterpret_cast<const char*>(indices.data()), indices.size() * sizeof(std::uint32_t));
+		ofs.write(strings.data(), strings.size());
+
+		if (!ofs.good()) {
+			LOG_L(L_WARNING, "[AssCache::%s] could not write cache-file %s", __func__, filePath.c_str());
+			ofs.close();
+			std::remove(tempPath.c_str());
+			return false;
+		}
+	}
+
+	// readers never see a partially written file; a concurrent
+	// writer (another process) may have created it in between
+	if (std::rename(tempPath.c_str(), filePath.c_str()) != 0) {
+		std::remove(tempPath.c_str());
+		return false;
+	}
+
+	return true;
+}
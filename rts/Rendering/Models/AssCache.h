@@ -0,0 +1,39 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef ASS_CACHE_H
+#define ASS_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct S3DModel;
+
+// binary cache of fully processed Assimp models, so later loads do not
+// have to run the importer and its post-processing steps again
+//
+// files consist of a fixed header followed by the piece records, the
+// vertices and indices of all pieces and a string table, each section
+// stored contiguously at the (4-byte aligned) offsets in the header
+namespace AssCache {
+	// must be bumped whenever CAssParser's output or the layout changes
+	static constexpr std::uint32_t CACHE_VERSION = 1;
+
+	struct CacheKey {
+		std::uint32_t modelCheckSum;
+		std::uint32_t metaCheckSum;
+		// these affect aiProcess_SplitLargeMeshes
+		std::uint32_t maxVertices;
+		std::uint32_t maxIndices;
+	};
+
+	CacheKey GetCacheKey(const std::string& modelFilePath, const std::string& metaFilePath, unsigned int maxVertices, unsigned int maxIndices);
+	std::string GetCacheFileName(const std::string& modelFilePath, const CacheKey& key);
+
+	// <materialTextures> are the (unresolved) texture names of the first
+	// material, from which CAssParser::FindTextures picks the diffuse map
+	bool ReadModel(const std::string& cacheFileName, const CacheKey& key, S3DModel* model, std::vector<std::string>& materialTextures);
+	bool WriteModel(const std::string& cacheFileName, const CacheKey& key, const S3DModel* model, const std::vector<std::string>& materialTextures);
+};
+
+#endif // ASS_CACHE_H
@@ -3,6 +3,7 @@
 #include "AssParser.h"
 #include "3DModel.h"
 #include "3DModelLog.h"
+#include "AssCache.h"
 #include "AssIO.h"
 
 #include "Lua/LuaParser.h"
@@ -168,7 +169,46 @@ S3DModel CAssParser::Load(const std::string& modelFilePath)
 	if (!modelTable.IsValid())
 		LOG_SL(LOG_SECTION_MODEL, L_INFO, "No valid model metadata in '%s' or no meta-file", metaFileName.c_str());
 
+	// the cached model depends on everything that goes into LoadScene
+	const AssCache::CacheKey& cacheKey = AssCache::GetCacheKey(modelFilePath, metaFileName, maxVertices, maxIndices);
+	const std::string& cacheFileName = AssCache::GetCacheFileName(modelFilePath, cacheKey);
 
+	S3DModel model;
+	model.name = modelFilePath;
+	model.type = MODELTYPE_ASS;
+
+	std::vector<std::string> materialTextures;
+
+	if (!AssCache::ReadModel(cacheFileName, cacheKey, &model, materialTextures)) {
+		LoadScene(&model, materialTextures, modelTable, modelFilePath);
+
+		if (!AssCache::WriteModel(cacheFileName, cacheKey, &model, materialTextures))
+			LOG_SL(LOG_SECTION_MODEL, L_WARNING, "Could not cache model %s in %s", model.name.c_str(), cacheFileName.c_str());
+	}
+
+	// Load textures
+	FindTextures(&model, materialTextures, modelTable, modelPath, modelName);
+	LOG_SL(LOG_SECTION_MODEL, L_INFO, "Loading textures. Tex1: '%s' Tex2: '%s'", model.texs[0].c_str(), model.texs[1].c_str());
+
+	texturehandlerS3O->PreloadTexture(&model, modelTable.GetBool("fliptextures", true), modelTable.GetBool("invertteamcolor", true));
+
+	// Verbose logging of model properties
+	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->name: %s", model.name.c_str());
+	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->numobjects: %d", model.numPieces);
+	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->radius: %f", model.radius);
+	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->height: %f", model.height);
+	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->mins: (%f,%f,%f)", model.mins[0], model.mins[1], model.mins[2]);
+	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->maxs: (%f,%f,%f)", model.maxs[0], model.maxs[1], model.maxs[2]);
+	LOG_SL(LOG_SECTION_MODEL, L_INFO, "Model %s Imported.", model.name.c_str());
+	return model;
+}
+
+void CAssParser::LoadScene(
+	S3DModel* model,
+	std::vector<std::string>& materialTextures,
+	const LuaTable& modelTable,
+	const std::string& modelFilePath
+) {
 	// create a model importer instance
 	Assimp::Importer importer;
 
@@ -203,33 +243,15 @@ S3DModel CAssParser::Load(const std::string& modelFilePath)
 	ModelPieceMap pieceMap;
 	ParentNameMap parentMap;
 
-	S3DModel model;
-	model.name = modelFilePath;
-	model.type = MODELTYPE_ASS;
-
-	// Load textures
-	FindTextures(&model, scene, modelTable, modelPath, modelName);
-	LOG_SL(LOG_SECTION_MODEL, L_INFO, "Loading textures. Tex1: '%s' Tex2: '%s'", model.texs[0].c_str(), model.texs[1].c_str());
-
-	texturehandlerS3O->PreloadTexture(&model, modelTable.GetBool("fliptextures", true), modelTable.GetBool("invertteamcolor", true));
+	GetMaterialTextures(scene, materialTextures);
 
 	// Load all pieces in the model
 	LOG_SL(LOG_SECTION_MODEL, L_INFO, "Loading pieces from root node '%s'", scene->mRootNode->mName.data);
-	LoadPiece(&model, scene->mRootNode, scene, modelTable, pieceMap, parentMap);
+	LoadPiece(model, scene->mRootNode, scene, modelTable, pieceMap, parentMap);
 
 	// Update piece hierarchy based on metadata
-	BuildPieceHierarchy(&model, pieceMap, parentMap);
-	CalculateModelProperties(&model, modelTable);
-
-	// Verbose logging of model properties
-	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->name: %s", model.name.c_str());
-	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->numobjects: %d", model.numPieces);
-	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->radius: %f", model.radius);
-	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->height: %f", model.height);
-	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->mins: (%f,%f,%f)", model.mins[0], model.mins[1], model.mins[2]);
-	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->maxs: (%f,%f,%f)", model.maxs[0], model.maxs[1], model.maxs[2]);
-	LOG_SL(LOG_SECTION_MODEL, L_INFO, "Model %s Imported.", model.name.c_str());
-	return model;
+	BuildPieceHierarchy(model, pieceMap, parentMap);
+	CalculateModelProperties(model, modelTable);
 }
 
 
@@ -693,9 +715,40 @@ static std::string FindTextureByRegex(const std::string& regex_path, const std::
 }
 
 
+void CAssParser::GetMaterialTextures(const aiScene* scene, std::vector<std::string>& materialTextures)
+{
+	if (scene->mNumMaterials == 0)
+		return;
+
+	constexpr unsigned int texTypes[] = {
+		aiTextureType_SPECULAR,
+		aiTextureType_UNKNOWN,
+		aiTextureType_DIFFUSE,
+		/*
+		// TODO: support these too (we need to allow constructing tex1 & tex2 from several sources)
+		aiTextureType_EMISSIVE,
+		aiTextureType_HEIGHT,
+		aiTextureType_NORMALS,
+		aiTextureType_SHININESS,
+		aiTextureType_OPACITY,
+		*/
+	};
+
+	// only the first material is considered
+	for (unsigned int texType: texTypes) {
+		aiString textureFile;
+
+		if (scene->mMaterials[0]->Get(AI_MATKEY_TEXTURE(texType, 0), textureFile) != aiReturn_SUCCESS)
+			continue;
+
+		assert(textureFile.length > 0);
+		materialTextures.emplace_back(textureFile.data);
+	}
+}
+
 void CAssParser::FindTextures(
 	S3DModel* model,
-	const aiScene* scene,
+	const std::vector<std::string>& materialTextures,
 	const LuaTable& modelTable,
 	const std::string& modelPath,
 	const std::string& modelName
@@ -711,28 +764,8 @@ void CAssParser::FindTextures(
 	if (model->texs[1].empty()) model->texs[1] = FindTextureByRegex(modelPath, "glow"); // lowest-priority name
 
 	// 2. gather model-defined textures of first material (medium priority)
-	if (scene->mNumMaterials > 0) {
-		constexpr unsigned int texTypes[] = {
-			aiTextureType_SPECULAR,
-			aiTextureType_UNKNOWN,
-			aiTextureType_DIFFUSE,
-			/*
-			// TODO: support these too (we need to allow constructing tex1 & tex2 from several sources)
-			aiTextureType_EMISSIVE,
-			aiTextureType_HEIGHT,
-			aiTextureType_NORMALS,
-			aiTextureType_SHININESS,
-			aiTextureType_OPACITY,
-			*/
-		};
-		for (unsigned int texType: texTypes) {
-			aiString textureFile;
-			if (scene->mMaterials[0]->Get(AI_MATKEY_TEXTURE(texType, 0), textureFile) != aiReturn_SUCCESS)
-				continue;
-
-			assert(textureFile.length > 0);
-			model->texs[0] = FindTexture(textureFile.data, modelPath, model->texs[0]);
-		}
+	for (const std::string& textureFile: materialTextures) {
+		model->texs[0] = FindTexture(textureFile, modelPath, model->texs[0]);
 	}
 
 	// 3. try to load from metafile (highest priority)
@@ -55,6 +55,14 @@ public:
 	S3DModel Load(const std::string& modelFileName);
 	ModelType GetType() const { return MODELTYPE_ASS; }
 
+private:
+	void LoadScene(
+		S3DModel* model,
+		std::vector<std::string>& materialTextures,
+		const LuaTable& modelTable,
+		const std::string& modelFilePath
+	);
+
 private:
 	unsigned int maxIndices;
 	unsigned int maxVertices;
@@ -96,9 +104,10 @@ private:
 	static void BuildPieceHierarchy(S3DModel* model, ModelPieceMap& pieceMap, const ParentNameMap& parentMap);
 	static void CalculateModelDimensions(S3DModel* model, S3DModelPiece* piece);
 	static void CalculateModelProperties(S3DModel* model, const LuaTable& pieceTable);
+	static void GetMaterialTextures(const aiScene* scene, std::vector<std::string>& materialTextures);
 	static void FindTextures(
 		S3DModel* model,
-		const aiScene* scene,
+		const std::vector<std::string>& materialTextures,
 		const LuaTable& pieceTable,
 		const std::string& modelPath,
 		const std::string& modelName
@@ -15,9 +15,12 @@
 #include "System/Exceptions.h"
 #include "System/MainDefines.h" // SNPRINTF
 #include "System/SafeUtil.h"
+#include "System/Misc/SpringTime.h"
 #include "System/Threading/ThreadPool.h"
 #include "lib/assimp/include/assimp/Importer.hpp"
 
+#include <algorithm>
+
 
 static void RegisterAssimpModelFormats(CModelLoader::FormatMap& formats) {
 	spring::unordered_set<std::string> whitelist;
@@ -114,17 +117,36 @@ void CModelLoader::Init()
 
 	RegisterAssimpModelFormats(formats);
 
+	for (LoadStats& stats: loadStats) {
+		stats.numModels = 0;
+		stats.parseTime = 0;
+	}
+
 	// dummy first model, model IDs start at 1
 	models.emplace_back();
 }
 
 void CModelLoader::Kill()
 {
+	const char* typeNames[] = {"3DO", "S3O", "Assimp", "other"};
+
+	for (unsigned int n = 0; n < loadStats.size(); n++) {
+		if (loadStats[n].numModels == 0)
+			continue;
+
+		// parse-times of concurrently preloaded models overlap
+		LOG("[ModelLoader::%s] parsed %u %s models in %.1fms (summed over all threads)", __func__, loadStats[n].numModels.load(), typeNames[n], loadStats[n].parseTime * 0.001f);
+	}
+
 	KillModels();
 	KillParsers();
 
-	cache.clear();
+	for (CacheStripe& stripe: cache) {
+		stripe.entries.clear();
+	}
+
 	formats.clear();
+	pendingUploads.clear();
 }
 
 void CModelLoader::KillModels()
@@ -187,16 +209,38 @@ void CModelLoader::PreloadModel(const std::string& modelName)
 	if (!ThreadPool::HasThreads())
 		return;
 
-	// if already in cache, thread just returns early
-	// not spawning the thread at all would be better but still
-	// requires locking around cache.find(...) since some other
-	// preload worker might be down in CreateModel modifying it
-	// at the same time
+	// if already in cache, thread just returns early; workers
+	// preloading different models parse them concurrently and
+	// those preloading the same model wait for the first one
 	ThreadPool::Enqueue([modelName]() {
 		modelLoader.LoadModel(modelName, true);
 	});
 }
 
+void CModelLoader::UploadPendingModels()
+{
+	std::vector<unsigned int> modelIDs;
+
+	{
+		std::lock_guard<spring::mutex> lock(modelsMutex);
+
+		if (pendingUploads.empty())
+			return;
+
+		modelIDs.swap(pendingUploads);
+	}
+
+	// deque elements never move, pointers stay valid outside the lock
+	for (const unsigned int modelID: modelIDs) {
+		UploadRenderData(LoadCachedModel(modelID, true));
+	}
+}
+
+
+CModelLoader::CacheStripe& CModelLoader::GetCacheStripe(const std::string& name)
+{
+	return cache[std::hash<std::string>()(name) % NUM_CACHE_STRIPES];
+}
 
 S3DModel* CModelLoader::LoadModel(std::string name, bool preload)
 {
@@ -204,36 +248,99 @@ S3DModel* CModelLoader::LoadModel(std::string name, bool preload)
 	if (name.empty())
 		return nullptr;
 
-	std::lock_guard<spring::mutex> lock(mutex);
+	StringToLowerInPlace(name);
 
-	std::string  path;
-	std::string* refs[2] = {&name, &path};
+	// the first thread to look up a name claims it by inserting a
+	// future, everyone else waits on that until the model is parsed
+	// (if the claiming thread fails, its claims are erased and those
+	// waiting get the exception)
+	std::promise<unsigned int> modelPromise;
+	std::shared_future<unsigned int> ownFuture = modelPromise.get_future().share();
+	std::shared_future<unsigned int> cachedFuture;
 
-	StringToLowerInPlace(name);
+	{
+		CacheStripe& stripe = GetCacheStripe(name);
+		std::lock_guard<spring::mutex> lock(stripe.mutex);
 
-	// search in cache first
-	for (unsigned int n = 0; n < 2; n++) {
-		S3DModel* cachedModel = LoadCachedModel(*refs[n], preload);
+		const auto ci = stripe.entries.find(name);
 
-		if (cachedModel != nullptr)
-			return cachedModel;
+		if (ci == stripe.entries.end()) {
+			stripe.entries[name] = ownFuture;
+		} else {
+			cachedFuture = ci->second;
+		}
+	}
+
+	if (cachedFuture.valid())
+		return (LoadCachedModel(cachedFuture.get(), preload));
+
+	std::string path;
 
-		// expensive, delay until needed
+	S3DModel* model = nullptr;
+
+	unsigned int modelID = 0;
+	bool claimedPath = false;
+
+	try {
+		// expensive, not done under any lock
 		path = FindModelPath(name);
+
+		if (path != name) {
+			// differently named references can resolve to the same file
+			CacheStripe& stripe = GetCacheStripe(path);
+			std::lock_guard<spring::mutex> lock(stripe.mutex);
+
+			const auto ci = stripe.entries.find(path);
+
+			if ((claimedPath = (ci == stripe.entries.end()))) {
+				stripe.entries[path] = ownFuture;
+			} else {
+				cachedFuture = ci->second;
+			}
+		}
+
+		if (cachedFuture.valid()) {
+			modelID = cachedFuture.get();
+		} else {
+			// not found in cache, create the model and publish its ID
+			model = CreateModel(name, path, preload);
+			modelID = model->id;
+		}
+
+		modelPromise.set_value(modelID);
+	} catch (...) {
+		// let later lookups retry instead of waiting on a broken entry
+		EraseCacheEntry(name);
+
+		if (claimedPath)
+			EraseCacheEntry(path);
+
+		modelPromise.set_exception(std::current_exception());
+		throw;
 	}
 
-	// not found in cache, create the model and cache it
-	return (CreateModel(name, path, preload));
+	if (model != nullptr)
+		return model;
+
+	return (LoadCachedModel(modelID, preload));
 }
 
-S3DModel* CModelLoader::LoadCachedModel(const std::string& name, bool preload)
+void CModelLoader::EraseCacheEntry(const std::string& name)
 {
-	const auto ci = cache.find(name);
+	CacheStripe& stripe = GetCacheStripe(name);
+	std::lock_guard<spring::mutex> lock(stripe.mutex);
 
-	if (ci == cache.end())
-		return nullptr;
+	stripe.entries.erase(name);
+}
 
-	S3DModel* cachedModel = &models[ci->second];
+S3DModel* CModelLoader::LoadCachedModel(unsigned int modelID, bool preload)
+{
+	S3DModel* cachedModel = nullptr;
+
+	{
+		std::lock_guard<spring::mutex> lock(modelsMutex);
+		cachedModel = &models[modelID];
+	}
 
 	if (!preload)
 		UploadRenderData(cachedModel);
@@ -248,6 +355,8 @@ S3DModel* CModelLoader::CreateModel(
 	const std::string& path,
 	bool preload
 ) {
+	const spring_time parseStartTime = spring_gettime();
+
 	S3DModel model = std::move(ParseModel(name, path));
 
 	if (model.numPieces == 0)
@@ -256,18 +365,33 @@ S3DModel* CModelLoader::CreateModel(
 	assert(model.GetRootPiece() != nullptr);
 	model.SetPieceMatrices();
 
-	if (!preload)
-		UploadRenderData(&model);
+	LoadStats& stats = loadStats[std::min(unsigned(model.type), unsigned(MODELTYPE_OTHER))];
 
-	// add (parsed or dummy) model to cache
-	model.id = models.size();
+	stats.numModels += 1;
+	stats.parseTime += (spring_gettime() - parseStartTime).toMicroSecsi();
 
-	cache[name] = model.id;
-	cache[path] = model.id;
+	S3DModel* cachedModel = nullptr;
 
-	models.emplace_back();
-	models.back() = std::move(model);
-	return &(models.back());
+	{
+		// add (parsed or dummy) model to the list, the caller publishes its ID
+		std::lock_guard<spring::mutex> lock(modelsMutex);
+
+		model.id = models.size();
+
+		models.emplace_back();
+		models.back() = std::move(model);
+
+		cachedModel = &(models.back());
+
+		// GL calls are only valid on the main thread, defer
+		if (preload)
+			pendingUploads.push_back(cachedModel->id);
+	}
+
+	if (!preload)
+		UploadRenderData(cachedModel);
+
+	return cachedModel;
 }
 
 
@@ -279,7 +403,13 @@ IModelParser* CModelLoader::GetFormatParser(const std::string& pathExt)
 	if (fi == formats.end())
 		return nullptr;
 
-	return parsers[fi->second];
+	// called concurrently by preload workers, must not insert
+	const auto pi = parsers.find(fi->second);
+
+	if (pi == parsers.end())
+		return nullptr;
+
+	return pi->second;
 }
 
 S3DModel CModelLoader::ParseModel(const std::string& name, const std::string& path)
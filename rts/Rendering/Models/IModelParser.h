@@ -3,8 +3,13 @@
 #ifndef IMODELPARSER_H
 #define IMODELPARSER_H
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <deque>
+#include <future>
 #include <string>
+#include <vector>
 
 #include "3DModel.h"
 #include "System/UnorderedMap.hpp"
@@ -35,16 +40,35 @@ public:
 
 	bool IsValid() const { return (!formats.empty()); }
 	void PreloadModel(const std::string& name);
+	// uploads the render-data of all models preloaded since the last call (main thread)
+	void UploadPendingModels();
 
 public:
-	typedef spring::unordered_map<std::string, unsigned int> ModelMap; // "armflash.3do" --> id
+	typedef spring::unordered_map<std::string, std::shared_future<unsigned int>> ModelMap; // "armflash.3do" --> id
 	typedef spring::unordered_map<std::string, unsigned int> FormatMap; // "3do" --> MODELTYPE_3DO
 	typedef spring::unordered_map<unsigned int, IModelParser*> ParserMap; // MODELTYPE_3DO --> parser
 
 private:
+	// lookups hash into one of these, so preload workers only contend
+	// when their model names collide; parsing happens outside any lock
+	struct CacheStripe {
+		spring::mutex mutex;
+		ModelMap entries;
+	};
+
+	struct LoadStats {
+		std::atomic<unsigned int> numModels;
+		std::atomic<std::uint64_t> parseTime; // microseconds
+	};
+
+	static constexpr unsigned int NUM_CACHE_STRIPES = 16;
+
+	CacheStripe& GetCacheStripe(const std::string& name);
+	void EraseCacheEntry(const std::string& name);
+
 	S3DModel ParseModel(const std::string& name, const std::string& path);
 	S3DModel* CreateModel(const std::string& name, const std::string& path, bool preload);
-	S3DModel* LoadCachedModel(const std::string& name, bool preload);
+	S3DModel* LoadCachedModel(unsigned int modelID, bool preload);
 
 	IModelParser* GetFormatParser(const std::string& pathExt);
 
@@ -54,14 +78,20 @@ private:
 	void UploadRenderData(S3DModel* o);
 
 private:
-	ModelMap cache;
+	std::array<CacheStripe, NUM_CACHE_STRIPES> cache;
+
 	FormatMap formats;
 	ParserMap parsers;
 
-	spring::mutex mutex;
+	// protects models and pendingUploads
+	spring::mutex modelsMutex;
 
 	// all unique models loaded so far
 	std::deque<S3DModel> models;
+	// IDs of preloaded models whose render-data is not yet uploaded
+	std::vector<unsigned int> pendingUploads;
+
+	std::array<LoadStats, MODELTYPE_OTHER + 1> loadStats;
 };
 
 #define modelLoader (CModelLoader::GetInstance())
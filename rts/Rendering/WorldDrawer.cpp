@@ -158,6 +158,9 @@ void CWorldDrawer::Update(bool newSimFrame)
 	featureDrawer->Update();
 	IWater::ApplyPushedChanges(game);
 
+	// models parsed by preload workers since the last update
+	modelLoader.UploadPendingModels();
+
 	if (newSimFrame) {
 		projectileDrawer->UpdateTextures();
 		sky->Update();
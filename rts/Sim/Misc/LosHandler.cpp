@@ -89,6 +89,17 @@ ILosType::ILosType(const int mipLevel_, LosType type_)
 }
 
 
+void ILosType::TrackSquareChanges()
+{
+	changeFrames.clear();
+	changeFrames.resize(size.x * size.y, -1);
+
+	for (CLosMap& lm: losMaps) {
+		lm.SetChangeFrames(changeFrames.data());
+	}
+}
+
+
 float ILosType::GetRadius(const CUnit* unit) const
 {
 	switch (type) {
@@ -635,6 +646,14 @@ CLosHandler::CLosHandler()
 	losTypes.push_back(&jammer);
 	losTypes.push_back(&sonarJammer);
 
+	// the maps CUnit::CalcLosStatus reads from, see CUnitHandler::UpdateUnitLosStates
+	los.TrackSquareChanges();
+	airLos.TrackSquareChanges();
+	radar.TrackSquareChanges();
+	sonar.TrackSquareChanges();
+	jammer.TrackSquareChanges();
+	sonarJammer.TrackSquareChanges();
+
 	eventHandler.AddClient(this);
 }
 
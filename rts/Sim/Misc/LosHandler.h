@@ -111,6 +111,16 @@ public:
 		return (losMaps[allyTeam].At(PosToSquare(pos)) != 0);
 	}
 
+	/// index of the (clamped) square InSight samples for <pos>
+	int GetSquareIndex(const float3 pos) const {
+		const int2 p = PosToSquare(pos);
+		return (Clamp(p.y, 0, size.y - 1) * size.x + Clamp(p.x, 0, size.x - 1));
+	}
+	/// true if InSight(pos, a) may have changed for any allyteam <a> since <frame>
+	bool SquareChangedSince(int squareIdx, int frame) const {
+		return (!changeFrames.empty() && changeFrames[squareIdx] >= frame);
+	}
+
 public:
 	enum LosAlgoType { LOS_ALGO_RAYCAST, LOS_ALGO_CIRCLE };
 	enum LosType {
@@ -126,6 +136,8 @@ public:
 
 	ILosType(const int mipLevel, LosType type);
 
+	void TrackSquareChanges();
+
 public:
 	void Update();
 	void UpdateHeightMapSynced(SRectangle rect);
@@ -164,6 +176,9 @@ public:
 	const LosAlgoType algoType;
 	std::vector<CLosMap> losMaps;
 
+	/// last frame each square was switched on or off, in any of the losMaps
+	std::vector<int> changeFrames;
+
 	static size_t cacheFails;
 	static size_t cacheHits;
 	static size_t cacheReactivated;
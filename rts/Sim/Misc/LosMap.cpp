@@ -3,6 +3,7 @@
 #include "LosMap.h"
 #include "LosHandler.h"
 #include "Map/ReadMap.h"
+#include "Sim/Misc/GlobalSynced.h"
 #include "System/myMath.h"
 #include "System/float3.h"
 #include "System/Log/ILog.h"
@@ -386,6 +387,18 @@ void CLosTableHelper::Debug(const LosTable& losRays, const std::vector<int2>& po
 //////////////////////////////////////////////////////////////////////
 /// CLosMap implementation
 
+inline void CLosMap::AddToSquare(int idx, int amount)
+{
+	losmap[idx] += amount;
+
+	// only transitions between zero and non-zero can change what is in sight
+	if (changeFrames == nullptr || (losmap[idx] != 0 && losmap[idx] != amount))
+		return;
+
+	changeFrames[idx] = gs->frameNum;
+}
+
+
 void CLosMap::AddCircle(SLosInstance* instance, int amount)
 {
 #ifdef USE_UNSYNCED_HEIGHTMAP
@@ -399,7 +412,7 @@ void CLosMap::AddCircle(SLosInstance* instance, int amount)
 			const unsigned ex = Clamp(instance->basePos.x + width + 1, 0, size.x);
 
 			for (unsigned x_ = sx; x_ < ex; ++x_) {
-				losmap[(y_ * size.x) + x_] += amount;
+				AddToSquare((y_ * size.x) + x_, amount);
 			}
 		}
 	});
@@ -420,7 +433,7 @@ void CLosMap::AddRaycast(SLosInstance* instance, int amount)
 			int idx = rle.start;
 
 			for (int l = rle.length; l > 0; --l, ++idx) {
-				losmap[idx] += amount;
+				AddToSquare(idx, amount);
 
 				// skip if this los-square did not *enter* LOS
 				if (losmap[idx] != amount)
@@ -443,7 +456,7 @@ void CLosMap::AddRaycast(SLosInstance* instance, int amount)
 		int idx = rle.start;
 
 		for (int l = rle.length; l > 0; --l, ++idx) {
-			losmap[idx] += amount;
+			AddToSquare(idx, amount);
 		}
 	}
 }
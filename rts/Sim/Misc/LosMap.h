@@ -45,7 +45,12 @@ public:
 	// FIXME temp fix for CBaseGroundDrawer and AI interface, which need raw data
 	unsigned short& front() { return losmap.front(); }
 
+	/// squares whose coverage turns on or off get the current frame written to <frames>
+	void SetChangeFrames(int* frames) { changeFrames = frames; }
+
 private:
+	void AddToSquare(int idx, int amount);
+
 	void LosAdd(SLosInstance* instance) const;
 	void UnsafeLosAdd(SLosInstance* instance) const;
 	void SafeLosAdd(SLosInstance* instance) const;
@@ -58,6 +63,8 @@ protected:
 	std::vector<unsigned short> losmap;
 	bool sendReadmapEvents;
 	const float* const heightmap;
+
+	int* changeFrames = nullptr;
 };
 
 #endif // LOS_MAP_H
@@ -36,6 +36,8 @@ CR_BIND(CQuadField::Quad, )
 CR_REG_METADATA_SUB(CQuadField, Quad, (
 	CR_MEMBER(units),
 	CR_IGNORED(teamUnits),
+	CR_IGNORED(teamCategories),
+	CR_IGNORED(teamCategoryCounts),
 	CR_MEMBER(features),
 	CR_MEMBER(projectiles),
 	CR_MEMBER(repulsers),
@@ -100,6 +102,8 @@ CQuadField::Quad::Quad()
 {
 #ifndef UNIT_TEST
 	teamUnits.resize(teamHandler->ActiveAllyTeams());
+	teamCategories.resize(teamHandler->ActiveAllyTeams(), 0);
+	teamCategoryCounts.resize(teamHandler->ActiveAllyTeams());
 	assert(teamUnits.capacity() == teamHandler->ActiveAllyTeams());
 #endif
 }
@@ -109,10 +113,47 @@ void CQuadField::Quad::PostLoad()
 #ifndef UNIT_TEST
 	for (CUnit* unit: units) {
 		spring::VectorInsertUnique(teamUnits[unit->allyteam], unit, false);
+		AddTeamCategory(unit->allyteam, unit->category);
 	}
 #endif
 }
 
+void CQuadField::Quad::AddTeamCategory(int allyTeam, unsigned int category)
+{
+	auto& counts = teamCategoryCounts[allyTeam];
+	auto iter = std::find_if(counts.begin(), counts.end(), [&](const std::pair<unsigned int, unsigned int>& p) { return (p.first == category); });
+
+	if (iter != counts.end()) {
+		iter->second += 1;
+		return;
+	}
+
+	counts.emplace_back(category, 1);
+	teamCategories[allyTeam] |= category;
+}
+
+void CQuadField::Quad::RemoveTeamCategory(int allyTeam, unsigned int category)
+{
+	auto& counts = teamCategoryCounts[allyTeam];
+	auto iter = std::find_if(counts.begin(), counts.end(), [&](const std::pair<unsigned int, unsigned int>& p) { return (p.first == category); });
+
+	assert(iter != counts.end());
+
+	if ((iter->second -= 1) != 0)
+		return;
+
+	*iter = counts.back();
+	counts.pop_back();
+
+	// the last unit of this category is gone; other categories may share
+	// some of its bits, so rebuild from the (few) distinct ones still left
+	teamCategories[allyTeam] = 0;
+
+	for (const auto& p: counts) {
+		teamCategories[allyTeam] |= p.first;
+	}
+}
+
 CQuadField::CQuadField(int2 mapDims, int quad_size)
 {
 	quadSizeX = quad_size;
@@ -149,6 +190,28 @@ int CQuadField::WorldPosToQuadFieldIdx(const float3 p) const
 }
 
 
+int CQuadField::SelectAllyTeams(int allyTeam, int allyTeamMode, int* allyTeams) const
+{
+	int numAllyTeams = 0;
+
+#ifndef UNIT_TEST
+	for (int t = 0; t < teamHandler->ActiveAllyTeams(); t++) {
+		switch (allyTeamMode) {
+			case ALLYTEAM_ONLY   : { if (t != allyTeam) continue; } break;
+			case ALLYTEAM_EXCEPT : { if (t == allyTeam) continue; } break;
+			case ALLYTEAM_ALLIED : { if (!teamHandler->Ally(allyTeam, t)) continue; } break;
+			case ALLYTEAM_ENEMIES: { if ( teamHandler->Ally(allyTeam, t)) continue; } break;
+			default: { assert(false); } break;
+		}
+
+		allyTeams[numAllyTeams++] = t;
+	}
+#endif
+
+	return numAllyTeams;
+}
+
+
 #ifndef UNIT_TEST
 void CQuadField::GetQuads(QuadFieldQuery& qfq, float3 pos, float radius)
 {
@@ -297,11 +360,13 @@ void CQuadField::MovedUnit(CUnit* unit)
 	for (const int qi: unit->quads) {
 		spring::VectorErase(baseQuads[qi].units, unit);
 		spring::VectorErase(baseQuads[qi].teamUnits[unit->allyteam], unit);
+		baseQuads[qi].RemoveTeamCategory(unit->allyteam, unit->category);
 	}
 
 	for (const int qi: *qfQuery.quads) {
 		spring::VectorInsertUnique(baseQuads[qi].units, unit, false);
 		spring::VectorInsertUnique(baseQuads[qi].teamUnits[unit->allyteam], unit, false);
+		baseQuads[qi].AddTeamCategory(unit->allyteam, unit->category);
 	}
 
 	unit->quads = std::move(*qfQuery.quads);
@@ -312,6 +377,7 @@ void CQuadField::RemoveUnit(CUnit* unit)
 	for (const int qi: unit->quads) {
 		spring::VectorErase(baseQuads[qi].units, unit);
 		spring::VectorErase(baseQuads[qi].teamUnits[unit->allyteam], unit);
+		baseQuads[qi].RemoveTeamCategory(unit->allyteam, unit->category);
 	}
 
 	unit->quads.clear();
@@ -528,6 +594,106 @@ void CQuadField::GetUnitsExact(QuadFieldQuery& qfq, const float3& mins, const fl
 	return;
 }
 
+void CQuadField::GetUnitsExact(
+	QuadFieldQuery& qfq,
+	const float3& pos,
+	float radius,
+	bool spherical,
+	int allyTeam,
+	int allyTeamMode,
+	unsigned int categoryMask
+) {
+	std::array<int, MAX_TEAMS> allyTeams;
+
+	QuadFieldQuery qfQuery;
+	GetQuads(qfQuery, pos, radius);
+	const int tempNum = gs->GetTempNum();
+	const int numAllyTeams = SelectAllyTeams(allyTeam, allyTeamMode, allyTeams.data());
+	// the default mask also has to pass units without any category
+	const bool testCategories = (categoryMask != -1u);
+	qfq.units = tempUnits.GetVector();
+
+	for (const int qi: *qfQuery.quads) {
+		const Quad& quad = baseQuads[qi];
+
+		for (int n = 0; n < numAllyTeams; n++) {
+			const int t = allyTeams[n];
+
+			if (testCategories && (quad.teamCategories[t] & categoryMask) == 0)
+				continue;
+
+			for (CUnit* u: quad.teamUnits[t]) {
+				if (u->tempNum == tempNum)
+					continue;
+
+				u->tempNum = tempNum;
+
+				if (testCategories && (u->category & categoryMask) == 0)
+					continue;
+
+				const float totRad       = radius + u->radius;
+				const float totRadSq     = totRad * totRad;
+				const float posUnitDstSq = spherical?
+					pos.SqDistance(u->pos):
+					pos.SqDistance2D(u->pos);
+
+				if (posUnitDstSq >= totRadSq)
+					continue;
+
+				qfq.units->push_back(u);
+			}
+		}
+	}
+}
+
+void CQuadField::GetUnitsExact(
+	QuadFieldQuery& qfq,
+	const float3& mins,
+	const float3& maxs,
+	int allyTeam,
+	int allyTeamMode,
+	unsigned int categoryMask
+) {
+	std::array<int, MAX_TEAMS> allyTeams;
+
+	QuadFieldQuery qfQuery;
+	GetQuadsRectangle(qfQuery, mins, maxs);
+	const int tempNum = gs->GetTempNum();
+	const int numAllyTeams = SelectAllyTeams(allyTeam, allyTeamMode, allyTeams.data());
+	// the default mask also has to pass units without any category
+	const bool testCategories = (categoryMask != -1u);
+	qfq.units = tempUnits.GetVector();
+
+	for (const int qi: *qfQuery.quads) {
+		const Quad& quad = baseQuads[qi];
+
+		for (int n = 0; n < numAllyTeams; n++) {
+			const int t = allyTeams[n];
+
+			if (testCategories && (quad.teamCategories[t] & categoryMask) == 0)
+				continue;
+
+			for (CUnit* unit: quad.teamUnits[t]) {
+				if (unit->tempNum == tempNum)
+					continue;
+
+				unit->tempNum = tempNum;
+
+				if (testCategories && (unit->category & categoryMask) == 0)
+					continue;
+
+				const float3& pos = unit->pos;
+				if (pos.x < mins.x || pos.x > maxs.x)
+					continue;
+				if (pos.z < mins.z || pos.z > maxs.z)
+					continue;
+
+				qfq.units->push_back(unit);
+			}
+		}
+	}
+}
+
 
 void CQuadField::GetFeaturesExact(QuadFieldQuery& qfq, const float3& pos, float radius, bool spherical)
 {
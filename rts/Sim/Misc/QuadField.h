@@ -77,6 +77,14 @@ needed to support dynamic resizing (not used yet)
 */
 //	static void Resize(int quad_size);
 
+	// selects which per-allyteam unit lists a filtered unit query visits
+	enum {
+		ALLYTEAM_ONLY    = 0, // units of the given allyteam
+		ALLYTEAM_EXCEPT  = 1, // units of every other allyteam
+		ALLYTEAM_ALLIED  = 2, // units of allyteams the given one is allied with
+		ALLYTEAM_ENEMIES = 3, // units of allyteams the given one is not allied with
+	};
+
 	CQuadField(int2 mapDims, int quad_size);
 	~CQuadField();
 
@@ -108,6 +116,14 @@ needed to support dynamic resizing (not used yet)
 	 * mins and maxs, which extends infinitely along the y-axis
 	 */
 	void GetUnitsExact(QuadFieldQuery& qfq, const float3& mins, const float3& maxs);
+	/**
+	 * As the above, but only considers units of the allyteams selected
+	 * by @c allyTeam and @c allyTeamMode (ALLYTEAM_*) that have at least
+	 * one bit of @c categoryMask set (all units if every bit is set); the
+	 * per-allyteam lists without any such unit are skipped as a whole
+	 */
+	void GetUnitsExact(QuadFieldQuery& qfq, const float3& pos, float radius, bool spherical, int allyTeam, int allyTeamMode, unsigned int categoryMask = -1u);
+	void GetUnitsExact(QuadFieldQuery& qfq, const float3& mins, const float3& maxs, int allyTeam, int allyTeamMode, unsigned int categoryMask = -1u);
 	/**
 	 * Returns all features within @c radius of @c pos,
 	 * takes the 3D model radius of each feature into account,
@@ -162,11 +178,17 @@ needed to support dynamic resizing (not used yet)
 		Quad();
 		std::vector<CUnit*> units;
 		std::vector< std::vector<CUnit*> > teamUnits;
+		// OR of the categories of all units in teamUnits[allyTeam]
+		std::vector<unsigned int> teamCategories;
+		// distinct categories in teamUnits[allyTeam] and their unit counts
+		std::vector< std::vector< std::pair<unsigned int, unsigned int> > > teamCategoryCounts;
 		std::vector<CFeature*> features;
 		std::vector<CProjectile*> projectiles;
 		std::vector<CPlasmaRepulser*> repulsers;
 
 		void PostLoad();
+		void AddTeamCategory(int allyTeam, unsigned int category);
+		void RemoveTeamCategory(int allyTeam, unsigned int category);
 	};
 
 	const Quad& GetQuad(unsigned i) const {
@@ -199,6 +221,9 @@ private:
 	int2 WorldPosToQuadField(const float3 p) const;
 	int WorldPosToQuadFieldIdx(const float3 p) const;
 
+	// fills <allyTeams> with the indices selected by <allyTeamMode>, returns their count
+	int SelectAllyTeams(int allyTeam, int allyTeamMode, int* allyTeams) const;
+
 private:
 	std::vector<Quad> baseQuads;
 
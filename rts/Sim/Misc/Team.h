@@ -48,8 +48,8 @@ public:
 	unsigned int GetNumUnits() const { return numUnits; }
 	bool AtUnitLimit() const { return (numUnits >= maxUnits); }
 
-	TeamStatistics& GetCurrentStats() { return statHistory.back(); }
-	const TeamStatistics& GetCurrentStats() const { return statHistory.back(); }
+	TeamStatistics& GetCurrentStats() { return statHistory.GetCurrent(); }
+	const TeamStatistics& GetCurrentStats() const { return statHistory.GetCurrent(); }
 
 	CTeam& operator = (const TeamBase& base) {
 		TeamBase::operator = (base);
@@ -94,7 +94,7 @@ public:
 	SResourcePack resPrevExcess;
 
 	int nextHistoryEntry;
-	std::vector<TeamStatistics> statHistory;
+	TeamStatisticsHistory statHistory;
 
 	/// mod controlled parameters
 	LuaRulesParams::Params  modParams;
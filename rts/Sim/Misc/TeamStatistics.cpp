@@ -4,6 +4,8 @@
 
 #include "System/Platform/byteorder.h"
 
+#include <algorithm>
+
 
 CR_BIND(TeamStatistics, )
 CR_REG_METADATA(TeamStatistics, (
@@ -81,3 +83,217 @@ void TeamStatistics::swab()
 	swabDWordInPlace(unitsKilled);
 }
 
+
+
+
+CR_BIND(TeamStatisticsHistory, )
+CR_REG_METADATA(TeamStatisticsHistory, (
+	CR_MEMBER(encodedData),
+	CR_MEMBER(keyOffsets),
+	CR_MEMBER(numEncoded),
+	CR_MEMBER(current),
+	CR_MEMBER(previous)
+))
+
+
+static int TeamStatistics::* const intFields[] = {
+	&TeamStatistics::frame,
+	&TeamStatistics::unitsProduced,
+	&TeamStatistics::unitsDied,
+	&TeamStatistics::unitsReceived,
+	&TeamStatistics::unitsSent,
+	&TeamStatistics::unitsCaptured,
+	&TeamStatistics::unitsOutCaptured,
+	&TeamStatistics::unitsKilled,
+};
+
+static float TeamStatistics::* const floatFields[] = {
+	&TeamStatistics::metalUsed,
+	&TeamStatistics::energyUsed,
+	&TeamStatistics::metalProduced,
+	&TeamStatistics::energyProduced,
+	&TeamStatistics::metalExcess,
+	&TeamStatistics::energyExcess,
+	&TeamStatistics::metalReceived,
+	&TeamStatistics::energyReceived,
+	&TeamStatistics::metalSent,
+	&TeamStatistics::energySent,
+	&TeamStatistics::damageDealt,
+	&TeamStatistics::damageReceived,
+};
+
+
+static void WriteVarInt(std::uint32_t value, std::vector<std::uint8_t>& out)
+{
+	while (value >= 0x80) {
+		out.push_back((value & 0x7F) | 0x80);
+		value >>= 7;
+	}
+
+	out.push_back(value);
+}
+
+static const std::uint8_t* ReadVarInt(const std::uint8_t* data, const std::uint8_t* end, std::uint32_t& value)
+{
+	value = 0;
+
+	for (unsigned int shift = 0; data < end && shift < 35; shift += 7) {
+		const std::uint8_t byte = *(data++);
+
+		value |= (std::uint32_t(byte & 0x7F) << shift);
+
+		if ((byte & 0x80) == 0)
+			return data;
+	}
+
+	return nullptr;
+}
+
+static std::uint32_t FloatBits(float f) { std::uint32_t u; memcpy(&u, &f, sizeof(u)); return u; }
+static float BitsFloat(std::uint32_t u) { float f; memcpy(&f, &u, sizeof(f)); return f; }
+
+
+void TeamStatisticsHistory::EncodeEntry(const TeamStatistics& stats, const TeamStatistics& base, std::vector<std::uint8_t>& out)
+{
+	for (int TeamStatistics::* field: intFields) {
+		// zig-zag the (wrapping) difference so small negative deltas stay small
+		const std::uint32_t delta = std::uint32_t(stats.*field) - std::uint32_t(base.*field);
+		WriteVarInt((delta << 1) ^ (0 - (delta >> 31)), out);
+	}
+	for (float TeamStatistics::* field: floatFields) {
+		WriteVarInt(FloatBits(stats.*field) ^ FloatBits(base.*field), out);
+	}
+}
+
+const std::uint8_t* TeamStatisticsHistory::DecodeEntry(const std::uint8_t* data, const std::uint8_t* end, const TeamStatistics& base, TeamStatistics& stats)
+{
+	std::uint32_t value = 0;
+
+	for (int TeamStatistics::* field: intFields) {
+		if ((data = ReadVarInt(data, end, value)) == nullptr)
+			return nullptr;
+
+		stats.*field = std::uint32_t(base.*field) + ((value >> 1) ^ (0 - (value & 1)));
+	}
+	for (float TeamStatistics::* field: floatFields) {
+		if ((data = ReadVarInt(data, end, value)) == nullptr)
+			return nullptr;
+
+		stats.*field = BitsFloat(FloatBits(base.*field) ^ value);
+	}
+
+	return data;
+}
+
+
+void TeamStatisticsHistory::Clear()
+{
+	encodedData.clear();
+	encodedData.reserve(1024);
+	keyOffsets.clear();
+
+	numEncoded = 0;
+
+	current = TeamStatistics();
+	previous = TeamStatistics();
+}
+
+void TeamStatisticsHistory::Commit()
+{
+	if ((numEncoded % KEY_INTERVAL) == 0) {
+		keyOffsets.push_back(encodedData.size());
+		EncodeEntry(current, TeamStatistics(), encodedData);
+	} else {
+		EncodeEntry(current, previous, encodedData);
+	}
+
+	previous = current;
+	numEncoded += 1;
+}
+
+
+TeamStatistics TeamStatisticsHistory::Get(size_t index) const
+{
+	if (index >= numEncoded)
+		return current;
+
+	const std::uint8_t* data = &encodedData[keyOffsets[index / KEY_INTERVAL]];
+	const std::uint8_t* end = data + (encodedData.size() - keyOffsets[index / KEY_INTERVAL]);
+
+	TeamStatistics base;
+	TeamStatistics stats;
+
+	for (size_t i = index - (index % KEY_INTERVAL); i <= index; i++) {
+		data = DecodeEntry(data, end, base, stats);
+		base = stats;
+	}
+
+	return stats;
+}
+
+void TeamStatisticsHistory::GetRange(size_t begin, size_t end, std::vector<TeamStatistics>& out) const
+{
+	end = std::min(end, size());
+
+	if (begin >= end)
+		return;
+
+	out.reserve(out.size() + (end - begin));
+
+	if (begin < numEncoded) {
+		const size_t keyIndex = begin / KEY_INTERVAL;
+		const size_t decodeEnd = std::min(end, size_t(numEncoded));
+
+		const std::uint8_t* data = &encodedData[keyOffsets[keyIndex]];
+		const std::uint8_t* dataEnd = encodedData.data() + encodedData.size();
+
+		TeamStatistics base;
+		TeamStatistics stats;
+
+		for (size_t i = keyIndex * KEY_INTERVAL; i < decodeEnd; i++) {
+			if ((i % KEY_INTERVAL) == 0)
+				base = TeamStatistics();
+
+			data = DecodeEntry(data, dataEnd, base, stats);
+			base = stats;
+
+			if (i >= begin)
+				out.push_back(stats);
+		}
+	}
+
+	if (end == size())
+		out.push_back(current);
+}
+
+
+void TeamStatisticsHistory::GetEncoded(std::vector<std::uint8_t>& out) const
+{
+	out.clear();
+	out.reserve(encodedData.size() + sizeof(TeamStatistics));
+	out.insert(out.end(), encodedData.begin(), encodedData.end());
+
+	EncodeEntry(current, ((numEncoded % KEY_INTERVAL) == 0)? TeamStatistics(): previous, out);
+}
+
+bool TeamStatisticsHistory::Decode(const std::uint8_t* data, size_t size, size_t numEntries, std::vector<TeamStatistics>& out)
+{
+	const std::uint8_t* end = data + size;
+
+	TeamStatistics base;
+	TeamStatistics stats;
+
+	out.reserve(out.size() + numEntries);
+
+	for (size_t i = 0; i < numEntries; i++) {
+		if ((i % KEY_INTERVAL) == 0)
+			base = TeamStatistics();
+
+		if ((data = DecodeEntry(data, end, base, stats)) == nullptr)
+			return false;
+
+		out.push_back(base = stats);
+	}
+
+	return true;
+}
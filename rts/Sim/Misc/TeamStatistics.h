@@ -6,7 +6,9 @@
 #include "System/creg/creg_cond.h"
 #include "System/Platform/byteorder.h"
 
+#include <cstdint>
 #include <cstring>
+#include <vector>
 
 #pragma pack(push, 1)
 
@@ -46,4 +48,65 @@ struct TeamStatistics
 
 #pragma pack(pop)
 
+
+/**
+ * @brief Compact history of TeamStatistics snapshots
+ *
+ * Every committed snapshot is stored as per-field varints: integer fields as
+ * zig-zagged differences, float fields as the XOR of their bit-patterns with
+ * the preceding snapshot. Since all statistics are cumulative most fields do
+ * not change between two periods and take up a single byte. Each entry whose
+ * index is a multiple of KEY_INTERVAL is encoded against a zeroed snapshot,
+ * so decoding any entry needs to walk at most KEY_INTERVAL entries.
+ *
+ * The most recent entry is kept uncompressed since it is being accumulated.
+ */
+class TeamStatisticsHistory
+{
+	CR_DECLARE_STRUCT(TeamStatisticsHistory)
+
+public:
+	static constexpr unsigned int KEY_INTERVAL = 16;
+
+	TeamStatisticsHistory() { Clear(); }
+
+	void Clear();
+	/// appends the current snapshot to the history, accumulation continues from its values
+	void Commit();
+
+	/// number of snapshots, including the current one
+	size_t size() const { return (numEncoded + 1); }
+
+	TeamStatistics& GetCurrent() { return current; }
+	const TeamStatistics& GetCurrent() const { return current; }
+
+	TeamStatistics Get(size_t index) const;
+	/// decodes the snapshots [begin, end) and appends them to out
+	void GetRange(size_t begin, size_t end, std::vector<TeamStatistics>& out) const;
+
+	/// the complete history (including the current snapshot) in encoded form
+	void GetEncoded(std::vector<std::uint8_t>& out) const;
+
+	/**
+	 * Decodes numEntries snapshots from a buffer filled by GetEncoded.
+	 * @return false if the buffer is truncated or corrupt
+	 */
+	static bool Decode(const std::uint8_t* data, size_t size, size_t numEntries, std::vector<TeamStatistics>& out);
+
+private:
+	static void EncodeEntry(const TeamStatistics& stats, const TeamStatistics& base, std::vector<std::uint8_t>& out);
+	static const std::uint8_t* DecodeEntry(const std::uint8_t* data, const std::uint8_t* end, const TeamStatistics& base, TeamStatistics& stats);
+
+private:
+	std::vector<std::uint8_t> encodedData;
+	/// byte-offsets of the entries encoded against zero
+	std::vector<std::uint32_t> keyOffsets;
+
+	std::uint32_t numEncoded;
+
+	TeamStatistics current;
+	/// last committed snapshot, base for encoding the next one
+	TeamStatistics previous;
+};
+
 #endif
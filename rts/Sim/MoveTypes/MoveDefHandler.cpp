@@ -45,7 +45,9 @@ CR_REG_METADATA(MoveDef, (
 	CR_MEMBER(flowMapping),
 	CR_MEMBER(heatMod),
 	CR_MEMBER(flowMod),
-	CR_MEMBER(heatProduced)
+	CR_MEMBER(heatProduced),
+
+	CR_MEMBER(cacheBlockChecks)
 ))
 
 CR_REG_METADATA(MoveDefHandler, (
@@ -181,6 +183,8 @@ MoveDef::MoveDef()
 
 	, heatMapping(true)
 	, flowMapping(true)
+
+	, cacheBlockChecks(false)
 {
 	depthModParams[DEPTHMOD_MIN_HEIGHT] = 0.0f;
 	depthModParams[DEPTHMOD_MAX_HEIGHT] = std::numeric_limits<float>::max();
@@ -312,6 +316,10 @@ MoveDef::MoveDef(const LuaTable& moveDefTable, int moveDefID) {
 	zsizeh = zsize >> 1;
 	assert((xsize & 1) == 1);
 	assert((zsize & 1) == 1);
+
+	// a single footprint check covers ((xsizeh + 1) * (zsizeh + 1)) cells,
+	// memoizing them only pays off from a few cells per check onward
+	cacheBlockChecks = moveDefTable.GetBool("cacheBlockChecks", std::max(xsizeDef, zsizeDef) >= 3);
 }
 
 
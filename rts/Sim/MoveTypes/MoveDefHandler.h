@@ -134,6 +134,10 @@ struct MoveDef {
 	bool heatMapping;
 	bool flowMapping;
 #pragma pack(pop)
+
+	/// memoize footprint block-checks within each max-res search?
+	/// (does not change any path, so kept out of GetCheckSum)
+	bool cacheBlockChecks;
 };
 
 
@@ -11,14 +11,105 @@
 #include "Sim/Objects/SolidObject.h"
 #include "Sim/Units/Unit.h"
 #include "Sim/Units/CommandAI/CommandAI.h"
+#include "System/Log/ILog.h"
 #include "System/Platform/Threading.h"
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 bool CMoveMath::noHoverWaterMove = false;
 float CMoveMath::waterDamageCost = 0.0f;
 
 static constexpr int FOOTPRINT_XSTEP = 2;
 static constexpr int FOOTPRINT_ZSTEP = 2;
 
+// [rasterIdx][hmSquare]; empty until InitSpeedModRasters
+static std::vector< std::vector<float> > speedModRasters;
+// [pathType] --> rasterIdx
+static std::vector<unsigned int> speedModRasterIndices;
+
+
+static bool EqualSpeedModParams(const MoveDef& a, const MoveDef& b)
+{
+	if (a.speedModClass != b.speedModClass)
+		return false;
+	if (a.depth != b.depth || a.maxSlope != b.maxSlope || a.slopeMod != b.slopeMod)
+		return false;
+
+	return (std::equal(std::begin(a.depthModParams), std::end(a.depthModParams), std::begin(b.depthModParams)));
+}
+
+
+void CMoveMath::InitSpeedModRasters()
+{
+	std::vector<const MoveDef*> rasterMoveDefs;
+
+	FreeSpeedModRasters();
+
+	speedModRasterIndices.reserve(moveDefHandler->GetNumMoveDefs());
+	rasterMoveDefs.reserve(moveDefHandler->GetNumMoveDefs());
+
+	// footprint-size and pathing options do not enter GetPosSpeedMod,
+	// so MoveDefs that differ only in those can share their raster
+	for (unsigned int i = 0; i < moveDefHandler->GetNumMoveDefs(); i++) {
+		const MoveDef* md = moveDefHandler->GetMoveDefByPathType(i);
+		const auto pred = [&](const MoveDef* rmd) { return (EqualSpeedModParams(*md, *rmd)); };
+		const auto iter = std::find_if(rasterMoveDefs.begin(), rasterMoveDefs.end(), pred);
+
+		speedModRasterIndices.push_back(iter - rasterMoveDefs.begin());
+
+		if (iter == rasterMoveDefs.end())
+			rasterMoveDefs.push_back(md);
+	}
+
+	speedModRasters.resize(rasterMoveDefs.size());
+
+	for (unsigned int i = 0; i < rasterMoveDefs.size(); i++) {
+		std::vector<float>& raster = speedModRasters[i];
+
+		raster.resize(mapDims.hmapx * mapDims.hmapy);
+
+		for (unsigned int hmSquare = 0; hmSquare < raster.size(); hmSquare++) {
+			raster[hmSquare] = CalcPosSpeedMod(*rasterMoveDefs[i], hmSquare);
+		}
+	}
+
+	LOG("[MoveMath::%s] %u speed-mod rasters for %u MoveDefs", __func__, unsigned(speedModRasters.size()), unsigned(speedModRasterIndices.size()));
+}
+
+void CMoveMath::UpdateSpeedModRasters(const SRectangle& rect)
+{
+	if (speedModRasters.empty())
+		return;
+
+	// slopes of adjacent heightmap-squares depend on the changed corners too
+	const int hmx1 = std::max(0, (rect.x1 >> 1) - 1), hmx2 = std::min(mapDims.hmapx - 1, (rect.x2 >> 1) + 1);
+	const int hmz1 = std::max(0, (rect.z1 >> 1) - 1), hmz2 = std::min(mapDims.hmapy - 1, (rect.z2 >> 1) + 1);
+
+	for (unsigned int i = 0; i < speedModRasterIndices.size(); i++) {
+		const unsigned int rasterIdx = speedModRasterIndices[i];
+
+		// first MoveDef mapped to a raster computes it for all others
+		if (std::find(speedModRasterIndices.begin(), speedModRasterIndices.begin() + i, rasterIdx) != (speedModRasterIndices.begin() + i))
+			continue;
+
+		const MoveDef* md = moveDefHandler->GetMoveDefByPathType(i);
+
+		for (int hmz = hmz1; hmz <= hmz2; hmz++) {
+			for (int hmx = hmx1; hmx <= hmx2; hmx++) {
+				speedModRasters[rasterIdx][hmx + hmz * mapDims.hmapx] = CalcPosSpeedMod(*md, hmx + hmz * mapDims.hmapx);
+			}
+		}
+	}
+}
+
+void CMoveMath::FreeSpeedModRasters()
+{
+	speedModRasters.clear();
+	speedModRasterIndices.clear();
+}
+
 
 float CMoveMath::yLevel(const MoveDef& moveDef, int xSqr, int zSqr)
 {
@@ -53,6 +144,15 @@ float CMoveMath::GetPosSpeedMod(const MoveDef& moveDef, unsigned xSquare, unsign
 		return 0.0f;
 
 	const int square = (xSquare >> 1) + ((zSquare >> 1) * mapDims.hmapx);
+
+	if (!speedModRasters.empty())
+		return speedModRasters[ speedModRasterIndices[moveDef.pathType] ][square];
+
+	return (CalcPosSpeedMod(moveDef, square));
+}
+
+float CMoveMath::CalcPosSpeedMod(const MoveDef& moveDef, unsigned int square)
+{
 	const int squareTerrType = readMap->GetTypeMapSynced()[square];
 
 	const float height  = readMap->GetMIPHeightMapSynced(1)[square];
@@ -20,6 +20,18 @@ protected:
 	static float ShipSpeedMod(const MoveDef& moveDef, float height, float slope);
 	static float ShipSpeedMod(const MoveDef& moveDef, float height, float slope, float dirSlopeMod);
 
+	// uncached positional speed-modifier of a heightmap-square
+	static float CalcPosSpeedMod(const MoveDef& moveDef, unsigned int hmSquare);
+
+public:
+	// positional speed-modifiers are cached per heightmap-square in one raster
+	// for each set of MoveDefs with equal speed-mod parameters; rasters must be
+	// updated (rect in map-squares, inclusive) whenever heights or terrain-types
+	// change, since GetPosSpeedMod(moveDef, x, z) reads them once initialized
+	static void InitSpeedModRasters();
+	static void UpdateSpeedModRasters(const SRectangle& rect);
+	static void FreeSpeedModRasters();
+
 public:
 	// gives the y-coordinate the unit will "stand on"
 	static float yLevel(const MoveDef& moveDef, const float3& pos);
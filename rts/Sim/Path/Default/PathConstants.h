@@ -39,6 +39,11 @@ static constexpr unsigned int PATH_HEATMAP_ZSCALE =  1; // wrt. mapDims.hmapy
 static constexpr unsigned int PATH_FLOWMAP_XSCALE = 32; // wrt. mapDims.mapx
 static constexpr unsigned int PATH_FLOWMAP_ZSCALE = 32; // wrt. mapDims.mapy
 
+// same-frame synced requests toward one low-res goal-block before they share a goal-field
+static constexpr unsigned int GOALFIELD_MIN_REQUESTS = 4;
+// frames an unreferenced goal-field is kept around for late requests
+static constexpr int GOALFIELD_LIFETIME = GAME_SPEED;
+
 
 // PE-only flags (indices)
 static constexpr unsigned int PATHDIR_LEFT       = 0; // +x (LEFT *TO* RIGHT)
@@ -121,6 +121,7 @@ private:
 private:
 	friend class CPathManager;
 	friend class CDefaultPathDrawer;
+	friend class PathGoalField;
 
 	const unsigned int BLOCKS_TO_UPDATE;
 
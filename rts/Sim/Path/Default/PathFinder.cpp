@@ -26,6 +26,8 @@ using namespace Bitwise;
 PFMemPool pfMemPool;
 
 
+static constexpr std::uint8_t SQUARE_BLOCKSTATE_UNKNOWN = 0xFF;
+
 static const CMoveMath::BlockType squareMobileBlockBits = (CMoveMath::BLOCK_MOBILE | CMoveMath::BLOCK_MOVING | CMoveMath::BLOCK_MOBILE_BUSY);
 static const CPathFinder::BlockCheckFunc blockCheckFuncs[2] = {
 	CMoveMath::IsBlockedNoSpeedModCheckThreadUnsafe,
@@ -226,6 +228,8 @@ IPath::SearchResult CPathFinder::DoSearch(
 		TestNeighborSquares(moveDef, pfDef, openSquare, owner);
 	}
 
+	ResetBlockStateCache();
+
 	if (foundGoal)
 		return IPath::Ok;
 
@@ -270,7 +274,7 @@ void CPathFinder::TestNeighborSquares(
 		SquareState& sqState = ngbStates[dir];
 
 		// IsBlockedNoSpeedModCheck; very expensive call
-		if ((sqState.blockMask = blockCheckFunc(moveDef, ngbSquareCoors.x, ngbSquareCoors.y, owner)) & CMoveMath::BLOCK_STRUCTURE) {
+		if ((sqState.blockMask = GetSquareBlockState(moveDef, ngbSquareCoors, ngbSquareIdx, owner)) & CMoveMath::BLOCK_STRUCTURE) {
 			blockStates.nodeMask[ngbSquareIdx] |= PATHOPT_CLOSED;
 			dirtyBlocks.push_back(ngbSquareIdx);
 			continue; // early-out (20% chance)
@@ -347,6 +351,40 @@ void CPathFinder::TestNeighborSquares(
 	dirtyBlocks.push_back(square->nodeNum);
 }
 
+CMoveMath::BlockType CPathFinder::GetSquareBlockState(
+	const MoveDef& moveDef,
+	const int2 square,
+	const unsigned int squareIdx,
+	const CSolidObject* owner
+) {
+	if (!moveDef.cacheBlockChecks)
+		return (blockCheckFunc(moveDef, square.x, square.y, owner));
+
+	// every square not yet closed is re-tested from each of its (up to
+	// eight) expanded neighbors, but its footprint and the owner do not
+	// change during a search so one evaluation can serve all of them
+	if (squareBlockStates.empty())
+		squareBlockStates.resize(nbrOfBlocks.x * nbrOfBlocks.y, SQUARE_BLOCKSTATE_UNKNOWN);
+
+	std::uint8_t& blockState = squareBlockStates[squareIdx];
+
+	if (blockState == SQUARE_BLOCKSTATE_UNKNOWN) {
+		blockState = blockCheckFunc(moveDef, square.x, square.y, owner);
+		cachedSquares.push_back(squareIdx);
+	}
+
+	return (CMoveMath::BlockType(CMoveMath::BlockTypes(blockState)));
+}
+
+void CPathFinder::ResetBlockStateCache()
+{
+	for (const unsigned int squareIdx: cachedSquares) {
+		squareBlockStates[squareIdx] = SQUARE_BLOCKSTATE_UNKNOWN;
+	}
+
+	cachedSquares.clear();
+}
+
 bool CPathFinder::TestBlock(
 	const MoveDef& moveDef,
 	const CPathFinderDef& pfDef,
@@ -80,6 +80,19 @@ private:
 		const CSolidObject* owner
 	);
 
+	/**
+	 * Returns the footprint block-state of a square, memoized for the
+	 * duration of one search if the MoveDef enables cacheBlockChecks.
+	 */
+	CMoveMath::BlockType GetSquareBlockState(
+		const MoveDef& moveDef,
+		const int2 square,
+		const unsigned int squareIdx,
+		const CSolidObject* owner
+	);
+
+	void ResetBlockStateCache();
+
 	/**
 	 * Adjusts the found path to cut corners where possible.
 	 */
@@ -100,6 +113,11 @@ private:
 
 	BlockCheckFunc blockCheckFunc;
 	CPathCache::CacheItem dummyCacheItem;
+
+	// block-states evaluated during the current search (per square, 0xFF if
+	// not yet known) and the indices of squares that need to be reset after
+	std::vector<std::uint8_t> squareBlockStates;
+	std::vector<unsigned int> cachedSquares;
 };
 
 #endif // PATH_FINDER_H
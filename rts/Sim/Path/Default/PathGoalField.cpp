@@ -0,0 +1,234 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+#include "PathGoalField.hpp"
+#include "PathConstants.h"
+#include "PathEstimator.h"
+#include "PathFinderDef.h"
+#include "Map/ReadMap.h"
+#include "Sim/MoveTypes/MoveDefHandler.h"
+#include "Sim/MoveTypes/MoveMath/MoveMath.h"
+
+void PathGoalField::Calc(const CPathEstimator* pe, const MoveDef& moveDef)
+{
+	assert(moveDef.pathType == pathType);
+
+	const int2 numBlocks = pe->GetNumBlocks();
+
+	const unsigned int numBlockIdcs = numBlocks.x * numBlocks.y;
+	const unsigned int goalBlockIdx = pe->BlockPosToIdx(goalBlock);
+	const unsigned int vertexBaseIdx = pathType * numBlockIdcs * PATH_DIRECTION_VERTICES;
+
+	typedef std::pair<float, unsigned int> QueueItem;
+	std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem> > openBlocks;
+
+	costs.clear();
+	costs.resize(numBlockIdcs, PATHCOST_INFINITY);
+	nextDirs.clear();
+	nextDirs.resize(numBlockIdcs, PATH_DIRECTIONS);
+
+	costs[goalBlockIdx] = 0.0f;
+	openBlocks.emplace(0.0f, goalBlockIdx);
+
+	// expand outward from the goal; vertex-costs are symmetric, so the
+	// cost of stepping from a neighbor into the current block is read
+	// from the current block's vertex in the direction of the neighbor
+	while (!openBlocks.empty()) {
+		const QueueItem item = openBlocks.top();
+		openBlocks.pop();
+
+		const unsigned int blockIdx = item.second;
+
+		// stale entry, block was reached more cheaply after it was queued
+		if (item.first > costs[blockIdx])
+			continue;
+
+		const int2 blockPos = pe->BlockIdxToPos(blockIdx);
+		const int2 blockSquare = pe->blockStates.peNodeOffsets[pathType][blockIdx];
+
+		// charged for entering this block, as in CPathEstimator::TestBlock
+		const float extraCost = pe->blockStates.GetNodeExtraCost(blockSquare.x, blockSquare.y, true);
+
+		for (unsigned int pathDir = 0; pathDir < PATH_DIRECTIONS; pathDir++) {
+			const int2 nbrBlockPos = blockPos + PE_DIRECTION_VECTORS[pathDir];
+
+			if (static_cast<unsigned int>(nbrBlockPos.x) >= numBlocks.x)
+				continue;
+			if (static_cast<unsigned int>(nbrBlockPos.y) >= numBlocks.y)
+				continue;
+
+			const unsigned int nbrBlockIdx = pe->BlockPosToIdx(nbrBlockPos);
+			const unsigned int vertexCostIdx =
+				vertexBaseIdx +
+				blockIdx * PATH_DIRECTION_VERTICES +
+				GetBlockVertexOffset(pathDir, numBlocks.x);
+
+			const float vertexCost = pe->vertexCosts[vertexCostIdx];
+
+			if (vertexCost >= PATHCOST_INFINITY)
+				continue;
+
+			const float nbrCost = costs[blockIdx] + vertexCost + extraCost;
+
+			if (nbrCost >= costs[nbrBlockIdx])
+				continue;
+
+			// the neighbor continues toward the goal in the opposite direction
+			costs[nbrBlockIdx] = nbrCost;
+			nextDirs[nbrBlockIdx] = (pathDir + PATH_DIRECTION_VERTICES) % PATH_DIRECTIONS;
+
+			openBlocks.emplace(nbrCost, nbrBlockIdx);
+		}
+	}
+
+	valid = true;
+}
+
+
+/*
+Mirrors the checks CPathEstimator::DoSearch and TestBlock apply per request on
+top of the (request-independent) vertex costs; returns Error whenever the field
+can not tell what the estimator would have found, so the caller falls back to a
+regular search.
+*/
+IPath::SearchResult PathGoalField::GetPath(
+	CPathEstimator* pe,
+	const MoveDef& moveDef,
+	const CPathFinderDef& peDef,
+	const CSolidObject* owner,
+	IPath::Path& path
+) const {
+	assert(valid);
+
+	const int2 numBlocks = pe->GetNumBlocks();
+	const int2 startBlock = {
+		Clamp(int(peDef.wsStartPos.x / SQUARE_SIZE) / int(pe->GetBlockSize()), 0, numBlocks.x - 1),
+		Clamp(int(peDef.wsStartPos.z / SQUARE_SIZE) / int(pe->GetBlockSize()), 0, numBlocks.y - 1),
+	};
+
+	const unsigned int blockSize = pe->GetBlockSize();
+	const unsigned int startBlockIdx = pe->BlockPosToIdx(startBlock);
+	const unsigned int goalBlockIdx = pe->BlockPosToIdx(goalBlock);
+	const unsigned int vertexBaseIdx = pathType * numBlocks.x * numBlocks.y * PATH_DIRECTION_VERTICES;
+
+	const int2 startSquare = pe->blockStates.peNodeOffsets[pathType][startBlockIdx];
+	const int2 goalSqrOffset = peDef.GoalSquareOffset(blockSize);
+
+	path.path.clear();
+	path.squares.clear();
+	path.pathCost = PATHCOST_INFINITY;
+
+	// see IPathFinder::InitSearch; PE's never allow raw searches
+	if (peDef.IsGoal(startSquare.x, startSquare.y) && peDef.startInGoalRadius)
+		return IPath::CantGetCloser;
+
+	unsigned int entryBlockIdx = startBlockIdx;
+	float entryCost = costs[startBlockIdx];
+
+	// neighbors that can not be reached via a vertex might still be reachable
+	// from wsStartPos directly, as in the base-set sub-search of TestBlock
+	if (!peDef.skipSubSearches) {
+		typedef std::pair<float, unsigned int> EntryItem;
+		std::vector<EntryItem> entryItems;
+
+		for (unsigned int pathDir = 0; pathDir < PATH_DIRECTIONS; pathDir++) {
+			const int2 nbrBlockPos = startBlock + PE_DIRECTION_VECTORS[pathDir];
+
+			if (static_cast<unsigned int>(nbrBlockPos.x) >= numBlocks.x)
+				continue;
+			if (static_cast<unsigned int>(nbrBlockPos.y) >= numBlocks.y)
+				continue;
+
+			const unsigned int nbrBlockIdx = pe->BlockPosToIdx(nbrBlockPos);
+			const unsigned int vertexCostIdx =
+				vertexBaseIdx +
+				startBlockIdx * PATH_DIRECTION_VERTICES +
+				GetBlockVertexOffset(pathDir, numBlocks.x);
+
+			if (pe->vertexCosts[vertexCostIdx] < PATHCOST_INFINITY)
+				continue;
+			if (costs[nbrBlockIdx] >= PATHCOST_INFINITY)
+				continue;
+
+			const int2 nbrSquare = pe->blockStates.peNodeOffsets[pathType][nbrBlockIdx];
+
+			const float nodeCost =
+				peDef.Heuristic(nbrSquare.x, nbrSquare.y, peDef.startSquareX, peDef.startSquareZ, blockSize) +
+				pe->blockStates.GetNodeExtraCost(nbrSquare.x, nbrSquare.y, peDef.synced);
+
+			entryItems.emplace_back(nodeCost + costs[nbrBlockIdx], nbrBlockIdx);
+		}
+
+		std::sort(entryItems.begin(), entryItems.end());
+
+		for (const EntryItem& item: entryItems) {
+			if (item.first >= entryCost)
+				break;
+
+			const int2 nbrSquare = pe->blockStates.peNodeOffsets[pathType][item.second];
+
+			if (!peDef.WithinConstraints(nbrSquare))
+				continue;
+			if (pe->DoBlockSearch(owner, moveDef, peDef.wsStartPos, SquareToFloat3(nbrSquare.x, nbrSquare.y)) != IPath::Ok)
+				continue;
+
+			entryBlockIdx = item.second;
+			entryCost = item.first;
+			break;
+		}
+	}
+
+	// the estimator would explore whatever region the start is locked into
+	if (entryCost >= PATHCOST_INFINITY)
+		return IPath::Error;
+
+	// walk the field from start to goal, then flip into the
+	// goal-first order CPathEstimator::FinishSearch produces
+	if (entryBlockIdx != startBlockIdx)
+		path.path.emplace_back(startSquare.x * SQUARE_SIZE, CMoveMath::yLevel(moveDef, startSquare.x, startSquare.y), startSquare.y * SQUARE_SIZE);
+
+	unsigned int blockIdx = entryBlockIdx;
+
+	while (true) {
+		const int2 blockPos = pe->BlockIdxToPos(blockIdx);
+		const int2 bSquare = pe->blockStates.peNodeOffsets[pathType][blockIdx];
+		const int2 gSquare = blockPos * blockSize + goalSqrOffset;
+
+		if (blockIdx != startBlockIdx && !peDef.WithinConstraints(bSquare))
+			return IPath::Error;
+
+		path.path.emplace_back(bSquare.x * SQUARE_SIZE, CMoveMath::yLevel(moveDef, bSquare.x, bSquare.y), bSquare.y * SQUARE_SIZE);
+
+		if (blockIdx == goalBlockIdx) {
+			// TestBlock only lets the goal-block be entered if the goal is
+			// reachable from its offset; otherwise the estimator would take
+			// a detour the field does not know about
+			const float3 sWorldPos = SquareToFloat3(bSquare.x, bSquare.y);
+
+			if (!peDef.skipSubSearches && sWorldPos.SqDistance2D(peDef.wsGoalPos) > peDef.sqGoalRadius) {
+				if (pe->DoBlockSearch(owner, moveDef, sWorldPos, peDef.wsGoalPos) != IPath::Ok)
+					return IPath::Error;
+			}
+
+			break;
+		}
+
+		// goal-test of DoSearch, which can end the search before the goal-block
+		if (peDef.IsGoal(bSquare.x, bSquare.y))
+			break;
+		if (!peDef.skipSubSearches && peDef.IsGoal(gSquare.x, gSquare.y) && pe->DoBlockSearch(owner, moveDef, bSquare, gSquare) == IPath::Ok)
+			break;
+
+		assert(nextDirs[blockIdx] < PATH_DIRECTIONS);
+		blockIdx = pe->BlockPosToIdx(blockPos + PE_DIRECTION_VECTORS[ nextDirs[blockIdx] ]);
+	}
+
+	std::reverse(path.path.begin(), path.path.end());
+
+	path.pathGoal = peDef.wsGoalPos;
+	path.pathCost = entryCost - costs[blockIdx];
+	return IPath::Ok;
+}
@@ -0,0 +1,85 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef PATH_GOALFIELD_HDR
+#define PATH_GOALFIELD_HDR
+
+#include <cinttypes>
+#include <vector>
+
+#include "IPath.h"
+#include "System/type2.h"
+#include "System/float3.h"
+
+struct MoveDef;
+class CPathEstimator;
+class CPathFinderDef;
+class CSolidObject;
+
+// distance-field over all blocks of an estimator toward a single goal-block
+// (one Dijkstra expansion serves any number of units ordered to that block)
+class PathGoalField {
+public:
+	PathGoalField()
+		: goalBlock(-1, -1)
+		, pathType(-1u)
+		, numUsers(0)
+		, numRequests(0)
+		, lastRequestFrame(-1)
+		, valid(false)
+	{}
+
+	static std::uint64_t GetKey(const int2 goalBlock, unsigned int pathType) {
+		return ((std::uint64_t(pathType) << 32) | (std::uint32_t(goalBlock.y) << 16) | std::uint32_t(goalBlock.x));
+	}
+
+	void Init(const int2 goalBlock, unsigned int pathType) {
+		this->goalBlock = goalBlock;
+		this->pathType = pathType;
+	}
+
+	void Calc(const CPathEstimator* pe, const MoveDef& moveDef);
+	// extracts the estimator-path from peDef's start-block toward the goal, goal first;
+	// Error means the field can not serve this request and a full search is required
+	IPath::SearchResult GetPath(
+		CPathEstimator* pe,
+		const MoveDef& moveDef,
+		const CPathFinderDef& peDef,
+		const CSolidObject* owner,
+		IPath::Path& path
+	) const;
+
+	// counts requests toward this field within a single sim-frame
+	unsigned int AddRequest(int frameNum) {
+		numRequests *= (lastRequestFrame == frameNum);
+		lastRequestFrame = frameNum;
+		return (++numRequests);
+	}
+
+	void AddUser() { numUsers += 1; }
+	void DelUser() { numUsers -= 1; }
+	void Invalidate() { valid = false; }
+
+	bool IsValid() const { return valid; }
+	bool IsUnused(int frameNum, int lifeTime) const { return (numUsers == 0 && (lastRequestFrame + lifeTime) < frameNum); }
+
+	unsigned int GetNumUsers() const { return numUsers; }
+
+private:
+	// accumulated cost of reaching the goal-block from each block
+	std::vector<float> costs;
+	// PATHDIR_* of the next block on the way to the goal
+	std::vector<std::uint8_t> nextDirs;
+
+	int2 goalBlock;
+
+	unsigned int pathType;
+	unsigned int numUsers;
+	unsigned int numRequests;
+
+	int lastRequestFrame;
+
+	bool valid;
+};
+
+#endif
+
@@ -9,6 +9,7 @@
 #include "PathLog.h"
 #include "PathMemPool.h"
 #include "Map/MapInfo.h"
+#include "Sim/Misc/GlobalSynced.h"
 #include "Sim/Misc/ModInfo.h"
 #include "Sim/Objects/SolidObject.h"
 #include "Sim/MoveTypes/MoveDefHandler.h"
@@ -24,6 +25,8 @@ CPathManager::CPathManager()
 , pathFlowMap(nullptr)
 , pathHeatMap(nullptr)
 , nextPathID(0)
+, numGoalFieldsBuilt(0)
+, numGoalFieldPaths(0)
 {
 	IPathFinder::InitStatic();
 	CPathFinder::InitStatic();
@@ -32,6 +35,7 @@ CPathManager::CPathManager()
 	pathHeatMap = PathHeatMap::GetInstance();
 
 	pathMap.reserve(1024);
+	goalFields.reserve(64);
 	pcMemPool.clear();
 	peMemPool.clear();
 	pfMemPool.clear();
@@ -43,6 +47,9 @@ CPathManager::CPathManager()
 
 CPathManager::~CPathManager()
 {
+	if (numGoalFieldsBuilt > 0)
+		LOG("[%s] %u goal-fields served %u path-requests", __func__, numGoalFieldsBuilt, numGoalFieldPaths);
+
 	peMemPool.free(lowResPE);
 	peMemPool.free(medResPE);
 	pfMemPool.free(maxResPF);
@@ -329,6 +336,88 @@ IPath::SearchResult CPathManager::ArrangePath(
 }
 
 
+/*
+Serve a long-distance synced request from a goal-field shared by all requests
+toward the same low-res block, if enough of them arrive within a single frame
+(typically a group order); the returned low-res path is refined as usual.
+Returns Error if the request was not served and must go through ArrangePath.
+*/
+IPath::SearchResult CPathManager::ArrangeGoalFieldPath(
+	MultiPath* newPath,
+	const MoveDef* moveDef,
+	const float3& startPos,
+	const float3& goalPos,
+	CSolidObject* caller
+) {
+	CPathFinderDef* pfDef = &newPath->peDef;
+
+	// same distance-metric as ArrangePath; shorter requests never reach the low-res PE
+	const float heurGoalDist2D = pfDef->Heuristic(startPos.x / SQUARE_SIZE, startPos.z / SQUARE_SIZE, 1) + math::fabs(goalPos.y - startPos.y) / SQUARE_SIZE;
+
+	if (heurGoalDist2D <= MEDRES_SEARCH_DISTANCE)
+		return IPath::Error;
+
+	const int2 goalBlock = {
+		int(goalPos.x / SQUARE_SIZE) / int(lowResPE->GetBlockSize()),
+		int(goalPos.z / SQUARE_SIZE) / int(lowResPE->GetBlockSize()),
+	};
+
+	const std::uint64_t fieldKey = PathGoalField::GetKey(goalBlock, moveDef->pathType);
+
+	PathGoalField& goalField = goalFields[fieldKey];
+
+	const unsigned int numRequests = goalField.AddRequest(gs->frameNum);
+
+	if (!goalField.IsValid()) {
+		// a lone request is cheaper to search directly
+		if (goalField.GetNumUsers() == 0 && numRequests < GOALFIELD_MIN_REQUESTS)
+			return IPath::Error;
+
+		SCOPED_TIMER("Misc::Path::GoalField");
+
+		goalField.Init(goalBlock, moveDef->pathType);
+		goalField.Calc(lowResPE, *moveDef);
+
+		numGoalFieldsBuilt += 1;
+	}
+
+	// same settings as the low-res search in ArrangePath
+	pfDef->DisableConstraint(true);
+	pfDef->AllowRawPathSearch(false);
+
+	const IPath::SearchResult result = goalField.GetPath(lowResPE, *moveDef, *pfDef, caller, newPath->lowResPath);
+
+	if (result != IPath::Ok)
+		return result;
+
+	goalField.AddUser();
+
+	newPath->goalFieldKey = fieldKey;
+	numGoalFieldPaths += 1;
+	return result;
+}
+
+void CPathManager::ReleaseGoalField(const MultiPath& path)
+{
+	if (path.goalFieldKey == -1ull)
+		return;
+
+	const auto fi = goalFields.find(path.goalFieldKey);
+
+	if (fi == goalFields.end())
+		return;
+
+	fi->second.DelUser();
+}
+
+void CPathManager::InvalidateGoalFields()
+{
+	for (auto& p: goalFields) {
+		p.second.Invalidate();
+	}
+}
+
+
 /*
 Request a new multipath, store the result and return a handle-id to it.
 */
@@ -360,7 +449,12 @@ unsigned int CPathManager::RequestPath(
 	if (caller != nullptr)
 		caller->UnBlock();
 
-	const IPath::SearchResult result = ArrangePath(&newPath, moveDef, startPos, goalPos, caller);
+	IPath::SearchResult result = IPath::Error;
+
+	if (synced)
+		result = ArrangeGoalFieldPath(&newPath, moveDef, startPos, goalPos, caller);
+	if (result == IPath::Error)
+		result = ArrangePath(&newPath, moveDef, startPos, goalPos, caller);
 
 	unsigned int pathID = 0;
 
@@ -585,6 +679,7 @@ void CPathManager::TerrainChange(unsigned int x1, unsigned int z1, unsigned int
 		return;
 
 	medResPE->MapChanged(x1, z1, x2, z2);
+	InvalidateGoalFields();
 
 	// low-res PE will be informed via (medRes)PE::Update
 	if (true && medResPE->nextPathEstimator != nullptr)
@@ -605,6 +700,18 @@ void CPathManager::Update()
 
 	medResPE->Update();
 	lowResPE->Update();
+
+	// vertex-costs are recalculated over several frames after a map change
+	if (!medResPE->updatedBlocks.empty() || !lowResPE->updatedBlocks.empty())
+		InvalidateGoalFields();
+
+	for (auto it = goalFields.begin(); it != goalFields.end(); ) {
+		if (it->second.IsUnused(gs->frameNum, GOALFIELD_LIFETIME)) {
+			it = goalFields.erase(it);
+		} else {
+			++it;
+		}
+	}
 }
 
 // used to deposit heat on the heat-map as a unit moves along its path
@@ -722,6 +829,10 @@ bool CPathManager::SetNodeExtraCost(unsigned int x, unsigned int z, float cost,
 	maxResBuf.SetNodeExtraCost(x, z, cost, synced);
 	medResBuf.SetNodeExtraCost(x, z, cost, synced);
 	lowResBuf.SetNodeExtraCost(x, z, cost, synced);
+
+	if (synced)
+		InvalidateGoalFields();
+
 	return true;
 }
 
@@ -740,6 +851,10 @@ bool CPathManager::SetNodeExtraCosts(const float* costs, unsigned int sizex, uns
 	maxResBuf.SetNodeExtraCosts(costs, sizex, sizez, synced);
 	medResBuf.SetNodeExtraCosts(costs, sizex, sizez, synced);
 	lowResBuf.SetNodeExtraCosts(costs, sizex, sizez, synced);
+
+	if (synced)
+		InvalidateGoalFields();
+
 	return true;
 }
 
@@ -8,6 +8,7 @@
 #include "Sim/Path/IPathManager.h"
 #include "IPath.h"
 #include "PathFinderDef.h"
+#include "PathGoalField.hpp"
 #include "System/UnorderedMap.hpp"
 
 class CSolidObject;
@@ -39,6 +40,7 @@ public:
 		if (pi == pathMap.end())
 			return;
 
+		ReleaseGoalField(pi->second);
 		pathMap.erase(pi);
 	}
 
@@ -93,13 +95,14 @@ public:
 
 private:
 	struct MultiPath {
-		MultiPath(): moveDef(nullptr), caller(nullptr) {}
+		MultiPath(): moveDef(nullptr), caller(nullptr), goalFieldKey(-1ull) {}
 		MultiPath(const MoveDef* moveDef, const float3& startPos, const float3& goalPos, float goalRadius)
 			: searchResult(IPath::Error)
 			, start(startPos)
 			, peDef(startPos, goalPos, goalRadius, 3.0f, 2000)
 			, moveDef(moveDef)
 			, caller(nullptr)
+			, goalFieldKey(-1ull)
 		{}
 
 		MultiPath(const MultiPath& mp) = delete;
@@ -120,8 +123,11 @@ private:
 			moveDef = mp.moveDef;
 			caller  = mp.caller;
 
+			goalFieldKey = mp.goalFieldKey;
+
 			mp.moveDef = nullptr;
 			mp.caller  = nullptr;
+			mp.goalFieldKey = -1ull;
 			return *this;
 		}
 
@@ -142,6 +148,9 @@ private:
 
 		// additional information
 		CSolidObject* caller;
+
+		// shared goal-field the low-res path was taken from, if any
+		std::uint64_t goalFieldKey;
 	};
 
 private:
@@ -153,6 +162,17 @@ private:
 		CSolidObject* caller
 	) const;
 
+	IPath::SearchResult ArrangeGoalFieldPath(
+		MultiPath* newPath,
+		const MoveDef* moveDef,
+		const float3& startPos,
+		const float3& goalPos,
+		CSolidObject* caller
+	);
+
+	void ReleaseGoalField(const MultiPath& path);
+	void InvalidateGoalFields();
+
 	MultiPath* GetMultiPath(int pathID) { return (const_cast<MultiPath*>(GetMultiPathConst(pathID))); }
 
 	const MultiPath* GetMultiPathConst(int pathID) const {
@@ -184,8 +204,12 @@ private:
 	PathHeatMap* pathHeatMap;
 
 	spring::unordered_map<unsigned int, MultiPath> pathMap;
+	spring::unordered_map<std::uint64_t, PathGoalField> goalFields;
 
 	unsigned int nextPathID;
+
+	unsigned int numGoalFieldsBuilt;
+	unsigned int numGoalFieldPaths;
 };
 
 #endif
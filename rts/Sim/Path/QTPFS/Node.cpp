@@ -20,43 +20,6 @@ unsigned int QTPFS::QTNode::MAX_DEPTH;
 
 
 
-void QTPFS::INode::SetPathCost(unsigned int type, float cost) {
-	#ifndef QTPFS_ENABLE_MICRO_OPTIMIZATION_HACKS
-	switch (type) {
-		case NODE_PATH_COST_F: { fCost = cost; return; } break;
-		case NODE_PATH_COST_G: { gCost = cost; return; } break;
-		case NODE_PATH_COST_H: { hCost = cost; return; } break;
-	}
-
-	assert(false);
-	#else
-	assert(&gCost == &fCost + 1);
-	assert(&hCost == &gCost + 1);
-	assert(type <= NODE_PATH_COST_H);
-
-	*(&fCost + type) = cost;
-	#endif
-}
-
-float QTPFS::INode::GetPathCost(unsigned int type) const {
-	#ifndef QTPFS_ENABLE_MICRO_OPTIMIZATION_HACKS
-	switch (type) {
-		case NODE_PATH_COST_F: { return fCost; } break;
-		case NODE_PATH_COST_G: { return gCost; } break;
-		case NODE_PATH_COST_H: { return hCost; } break;
-	}
-
-	assert(false);
-	return 0.0f;
-	#else
-	assert(&gCost == &fCost + 1);
-	assert(&hCost == &gCost + 1);
-	assert(type <= NODE_PATH_COST_H);
-
-	return *(&fCost + type);
-	#endif
-}
-
 float QTPFS::INode::GetDistance(const INode* n, unsigned int type) const {
 	const float dx = float(xmid() * SQUARE_SIZE) - float(n->xmid() * SQUARE_SIZE);
 	const float dz = float(zmid() * SQUARE_SIZE) - float(n->zmid() * SQUARE_SIZE);
@@ -198,9 +161,8 @@ QTPFS::QTNode::QTNode(
 	assert(MIN_SIZE_Z > 0);
 
 	nodeNumber = nn;
-	heapIndex = -1u;
+	searchIndex = -1u;
 
-	searchState  =   0;
 	currMagicNum =   0;
 	prevMagicNum = -1u;
 
@@ -213,25 +175,21 @@ QTPFS::QTNode::QTNode(
 	assert(xsize() != 0);
 	assert(zsize() != 0);
 
-	fCost = 0.0f;
-	gCost = 0.0f;
-	hCost = 0.0f;
-
 	speedModSum =  0.0f;
 	speedModAvg =  0.0f;
 	moveCostAvg = -1.0f;
 
-	prevNode = NULL;
-
 	// for leafs, all children remain NULL
 	children.fill(NULL);
 }
 
-void QTPFS::QTNode::Delete() {
+void QTPFS::QTNode::Delete(NodeLayer& nl) {
 	if (!IsLeaf()) {
 		for (unsigned int i = 0; i < children.size(); i++) {
-			children[i]->Delete(); children[i] = NULL;
+			children[i]->Delete(nl); children[i] = NULL;
 		}
+	} else {
+		nl.UnregisterNode(this);
 	}
 
 	delete this;
@@ -261,7 +219,9 @@ std::uint64_t QTPFS::QTNode::GetCheckSum() const {
 
 	{
 		const unsigned char* minByte = reinterpret_cast<const unsigned char*>(&nodeNumber);
-		const unsigned char* maxByte = reinterpret_cast<const unsigned char*>(&hCost) + sizeof(hCost);
+		// searchIndex depends on the order in which nodes were (re-)created
+		// and differs between tesselated and de-serialized trees, skip it
+		const unsigned char* maxByte = reinterpret_cast<const unsigned char*>(&nodeNumber) + sizeof(nodeNumber);
 
 		assert(minByte < maxByte);
 
@@ -333,6 +293,9 @@ bool QTPFS::QTNode::Split(NodeLayer& nl, bool forced) {
 	neighbors.clear();
 	netpoints.clear();
 
+	// no longer a leaf after this
+	nl.UnregisterNode(this);
+
 	// can only split leaf-nodes (ie. nodes with NULL-children)
 	assert(children[NODE_IDX_TL] == NULL);
 	assert(children[NODE_IDX_TR] == NULL);
@@ -358,7 +321,7 @@ bool QTPFS::QTNode::Merge(NodeLayer& nl) {
 
 	// get rid of our children completely, but not of <this>!
 	for (unsigned int i = 0; i < children.size(); i++) {
-		children[i]->Delete(); children[i] = NULL;
+		children[i]->Delete(nl); children[i] = NULL;
 	}
 
 	nl.SetNumLeafNodes(nl.GetNumLeafNodes() - (4 - 1));
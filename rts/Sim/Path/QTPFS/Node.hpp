@@ -25,16 +25,9 @@ namespace QTPFS {
 	struct INode {
 	public:
 		void SetNodeNumber(unsigned int n) { nodeNumber = n; }
-		void SetHeapIndex(unsigned int n) { heapIndex = n; }
+		void SetSearchIndex(unsigned int n) { searchIndex = n; }
 		unsigned int GetNodeNumber() const { return nodeNumber; }
-		unsigned int GetHeapIndex() const { return heapIndex; }
-		float GetHeapPriority() const { return GetPathCost(NODE_PATH_COST_F); }
-
-		bool operator <  (const INode* n) const { return (fCost <  n->fCost); }
-		bool operator >  (const INode* n) const { return (fCost >  n->fCost); }
-		bool operator == (const INode* n) const { return (fCost == n->fCost); }
-		bool operator <= (const INode* n) const { return (fCost <= n->fCost); }
-		bool operator >= (const INode* n) const { return (fCost >= n->fCost); }
+		unsigned int GetSearchIndex() const { return searchIndex; }
 
 		#ifdef QTPFS_VIRTUAL_NODE_FUNCTIONS
 		virtual void Serialize(std::fstream&, NodeLayer&, unsigned int*, bool) = 0;
@@ -69,34 +62,17 @@ namespace QTPFS {
 		virtual void SetMoveCost(float cost) = 0;
 		virtual float GetMoveCost() const = 0;
 
-		virtual void SetSearchState(unsigned int) = 0;
-		virtual unsigned int GetSearchState() const = 0;
-
 		virtual void SetMagicNumber(unsigned int) = 0;
 		virtual unsigned int GetMagicNumber() const = 0;
 		#endif
 
-		void SetPathCosts(float g, float h) { fCost = g + h; gCost = g; hCost = h; }
-		void SetPathCost(unsigned int type, float cost);
-		const float* GetPathCosts() const { return &fCost; }
-		float GetPathCost(unsigned int type) const;
-
-		void SetPrevNode(INode* n) { prevNode = n; }
-		INode* GetPrevNode() { return prevNode; }
-
 	protected:
-		// NOTE:
-		//     storing the heap-index is an *UGLY* break of abstraction,
-		//     but the only way to keep the cost of resorting acceptable
 		unsigned int nodeNumber;
-		unsigned int heapIndex;
-
-		float fCost;
-		float gCost;
-		float hCost;
 
-		// points back to previous node in path
-		INode* prevNode;
+		// dense per-layer index of this (leaf) node into the scratch
+		// state of a search, see SearchThreadData; all per-search data
+		// lives there so that searches never write to the shared tree
+		unsigned int searchIndex;
 
 	#ifdef QTPFS_VIRTUAL_NODE_FUNCTIONS
 	};
@@ -126,7 +102,7 @@ namespace QTPFS {
 		std::uint64_t GetMemFootPrint() const;
 		std::uint64_t GetCheckSum() const;
 
-		void Delete();
+		void Delete(NodeLayer& nl);
 		void PreTesselate(NodeLayer& nl, const SRectangle& r, SRectangle& ur);
 		void Tesselate(NodeLayer& nl, const SRectangle& r);
 		void Serialize(std::fstream& fStream, NodeLayer& nodeLayer, unsigned int* streamSize, bool readMode);
@@ -163,9 +139,6 @@ namespace QTPFS {
 		void SetMoveCost(float cost) { moveCostAvg = cost; }
 		float GetMoveCost() const { return moveCostAvg; }
 
-		void SetSearchState(unsigned int state) { searchState = state; }
-		unsigned int GetSearchState() const { return searchState; }
-
 		void SetMagicNumber(unsigned int number) { currMagicNum = number; }
 		unsigned int GetMagicNumber() const { return currMagicNum; }
 
@@ -195,7 +168,6 @@ namespace QTPFS {
 		float speedModAvg;
 		float moveCostAvg;
 
-		unsigned int searchState;
 		unsigned int currMagicNum;
 		unsigned int prevMagicNum;
 
@@ -21,6 +21,7 @@ float        QTPFS::NodeLayer::MAX_SPEEDMOD_VALUE;
 QTPFS::NodeLayer::NodeLayer()
 	: layerNumber(0)
 	, numLeafNodes(0)
+	, numSearchIndices(0)
 	, updateCounter(0)
 	, xsize(0)
 	, zsize(0)
@@ -36,6 +37,16 @@ void QTPFS::NodeLayer::InitStatic() {
 }
 
 void QTPFS::NodeLayer::RegisterNode(INode* n) {
+	if (n->GetSearchIndex() == -1u) {
+		// recycle indices of former leafs to keep the range dense
+		if (freeSearchIndices.empty()) {
+			n->SetSearchIndex(numSearchIndices++);
+		} else {
+			n->SetSearchIndex(freeSearchIndices.back());
+			freeSearchIndices.pop_back();
+		}
+	}
+
 	for (unsigned int hmz = n->zmin(); hmz < n->zmax(); hmz++) {
 		for (unsigned int hmx = n->xmin(); hmx < n->xmax(); hmx++) {
 			nodeGrid[hmz * xsize + hmx] = n;
@@ -43,6 +54,14 @@ void QTPFS::NodeLayer::RegisterNode(INode* n) {
 	}
 }
 
+void QTPFS::NodeLayer::UnregisterNode(INode* n) {
+	if (n->GetSearchIndex() == -1u)
+		return;
+
+	freeSearchIndices.push_back(n->GetSearchIndex());
+	n->SetSearchIndex(-1u);
+}
+
 void QTPFS::NodeLayer::Init(unsigned int layerNum) {
 	assert((QTPFS::NodeLayer::NUM_SPEEDMOD_BINS + 1) <= MaxSpeedBinTypeValue());
 
@@ -63,6 +82,9 @@ void QTPFS::NodeLayer::Init(unsigned int layerNum) {
 
 void QTPFS::NodeLayer::Clear() {
 	nodeGrid.clear();
+	freeSearchIndices.clear();
+
+	numSearchIndices = 0;
 
 	curSpeedMods.clear();
 	oldSpeedMods.clear();
@@ -73,6 +73,10 @@ namespace QTPFS {
 
 		std::vector<INode*>& GetNodes() { return nodeGrid; }
 		void RegisterNode(INode* n);
+		void UnregisterNode(INode* n);
+
+		// upper bound (exclusive) of the search-indices of all leaf-nodes
+		unsigned int GetNumSearchIndices() const { return numSearchIndices; }
 
 		void SetNumLeafNodes(unsigned int n) { numLeafNodes = n; }
 		unsigned int GetNumLeafNodes() const { return numLeafNodes; }
@@ -89,11 +93,13 @@ namespace QTPFS {
 			memFootPrint += (curSpeedBins.size() * sizeof(SpeedBinType));
 			memFootPrint += (oldSpeedBins.size() * sizeof(SpeedBinType));
 			memFootPrint += (nodeGrid.size() * sizeof(INode*));
+			memFootPrint += (freeSearchIndices.size() * sizeof(unsigned int));
 			return memFootPrint;
 		}
 
 	private:
 		std::vector<INode*> nodeGrid;
+		std::vector<unsigned int> freeSearchIndices;
 
 		std::vector<SpeedModType> curSpeedMods;
 		std::vector<SpeedModType> oldSpeedMods;
@@ -114,6 +120,7 @@ namespace QTPFS {
 
 		unsigned int layerNumber;
 		unsigned int numLeafNodes;
+		unsigned int numSearchIndices;
 		unsigned int updateCounter;
 
 		unsigned int xsize;
@@ -1,5 +1,6 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
+#include <algorithm>
 #include <chrono>
 #include <cinttypes>
 #include <functional>
@@ -102,7 +103,7 @@ QTPFS::PathManager::PathManager() {
 
 QTPFS::PathManager::~PathManager() {
 	for (unsigned int layerNum = 0; layerNum < nodeLayers.size(); layerNum++) {
-		nodeTrees[layerNum]->Delete();
+		nodeTrees[layerNum]->Delete(nodeLayers[layerNum]);
 		nodeLayers[layerNum].Clear();
 
 		for (auto searchesIt = pathSearches[layerNum].begin(); searchesIt != pathSearches[layerNum].end(); ++searchesIt) {
@@ -125,7 +126,8 @@ QTPFS::PathManager::~PathManager() {
 	numCurrExecutedSearches.clear();
 	numPrevExecutedSearches.clear();
 
-	PathSearch::FreeGlobalQueue();
+	searchThreadData.clear();
+	searchBatch.clear();
 
 	#ifdef QTPFS_ENABLE_THREADED_UPDATE
 	// at this point the thread is waiting, so notify it
@@ -171,8 +173,6 @@ void QTPFS::PathManager::InitStatic() {
 void QTPFS::PathManager::Load() {
 	pmLoadScreen.SetLoading(true);
 
-	// NOTE: offset *must* start at a non-zero value
-	searchStateOffset = NODE_STATE_OFFSET;
 	numTerrainChanges = 0;
 	numPathRequests   = 0;
 	maxNumLeafNodes   = 0;
@@ -181,6 +181,7 @@ void QTPFS::PathManager::Load() {
 	nodeLayers.resize(moveDefHandler->GetNumMoveDefs());
 	pathCaches.resize(moveDefHandler->GetNumMoveDefs());
 	pathSearches.resize(moveDefHandler->GetNumMoveDefs());
+	searchThreadData.resize(ThreadPool::MAX_THREADS);
 
 	// add one extra element for object-less requests
 	numCurrExecutedSearches.resize(teamHandler->ActiveTeams() + 1, 0);
@@ -224,8 +225,6 @@ void QTPFS::PathManager::Load() {
 		}
 
 		{ SyncedUint tmp(pfsCheckSum); }
-
-		PathSearch::InitGlobalQueue(maxNumLeafNodes);
 	}
 
 	{
@@ -729,62 +728,68 @@ void QTPFS::PathManager::ExecuteQueuedSearches(unsigned int pathType) {
 	PathCache& pathCache = pathCaches[pathType];
 
 	std::vector<IPathSearch*>& searches = pathSearches[pathType];
-	std::vector<IPathSearch*>::iterator searchesIt = searches.begin();
-
-	if (!searches.empty()) {
-		// execute pending searches collected via
-		// RequestPath and QueueDeadPathSearches
-		while (searchesIt != searches.end()) {
-			if (ExecuteSearch(searches, searchesIt, nodeLayer, pathCache, pathType)) {
-				searchStateOffset += NODE_STATE_OFFSET;
-			}
-		}
+
+	// execute pending searches collected via RequestPath and
+	// QueueDeadPathSearches; searches that could share the result
+	// of one in the current batch are deferred to the next round
+	while (!searches.empty()) {
+		if (!PrepareSearchBatch(searches, nodeLayer, pathCache, pathType))
+			break;
+
+		ExecuteSearchBatch();
+		CommitSearchBatch(pathCache);
 	}
 }
 
-bool QTPFS::PathManager::ExecuteSearch(
+bool QTPFS::PathManager::PrepareSearchBatch(
 	PathSearchVect& searches,
-	PathSearchVectIt& searchesIt,
 	NodeLayer& nodeLayer,
 	PathCache& pathCache,
 	unsigned int pathType
 ) {
-	IPathSearch* search = *searchesIt;
-	IPath* path = pathCache.GetTempPath(search->GetID());
+	// searches are taken in queue order and their results committed
+	// in the same order, which keeps the outcome independent of how
+	// the batch gets distributed over threads
+	PathSearchVectIt dstIt = searches.begin();
 
-	assert(search != nullptr);
-	assert(path != nullptr);
+	searchBatch.clear();
 
-	const auto DeleteSearch = [](IPathSearch* s, PathSearchVect& v, PathSearchVectIt& it) {
-		// ordering of still-queued searches is not relevant
-		*it = v.back();
-		v.pop_back();
-		delete s;
-	};
+	for (PathSearchVectIt srcIt = searches.begin(); srcIt != searches.end(); ++srcIt) {
+		IPathSearch* search = *srcIt;
+		IPath* path = pathCache.GetTempPath(search->GetID());
 
-	// temp-path might have been removed already via
-	// DeletePath before we got a chance to process it
-	if (path->GetID() == 0) {
-		DeleteSearch(search, searches, searchesIt);
-		return false;
-	}
+		assert(search != nullptr);
+		assert(path != nullptr);
 
-	assert(search->GetID() != 0);
-	assert(path->GetID() == search->GetID());
+		// temp-path might have been removed already via
+		// DeletePath before we got a chance to process it
+		if (path->GetID() == 0) {
+			delete search;
+			continue;
+		}
 
-	search->Initialize(&nodeLayer, &pathCache, path->GetSourcePoint(), path->GetTargetPoint(), MAP_RECTANGLE);
-	path->SetHash(search->GetHash(mapDims.mapx * mapDims.mapy, pathType));
+		assert(search->GetID() != 0);
+		assert(path->GetID() == search->GetID());
+
+		search->Initialize(&nodeLayer, &pathCache, path->GetSourcePoint(), path->GetTargetPoint(), MAP_RECTANGLE);
+		path->SetHash(search->GetHash(mapDims.mapx * mapDims.mapy, pathType));
 
-	{
 		#ifdef QTPFS_SEARCH_SHARED_PATHS
 		SharedPathMap::const_iterator sharedPathsIt = sharedPaths.find(path->GetHash());
 
 		if (sharedPathsIt != sharedPaths.end()) {
 			if (search->SharedFinalize(sharedPathsIt->second, path)) {
-				DeleteSearch(search, searches, searchesIt);
-				return false;
+				delete search;
+				continue;
 			}
 		}
+
+		const auto IsSharedBatchPath = [&](const SearchBatchItem& item) { return (item.path->GetHash() == path->GetHash()); };
+
+		if (std::find_if(searchBatch.begin(), searchBatch.end(), IsSharedBatchPath) != searchBatch.end()) {
+			*(dstIt++) = search;
+			continue;
+		}
 		#endif
 
 		#ifdef QTPFS_LIMIT_TEAM_SEARCHES
@@ -792,30 +797,64 @@ bool QTPFS::PathManager::ExecuteSearch(
 		const unsigned int numPrevSearches = numPrevExecutedSearches[search->GetTeam()];
 
 		if ((numCurrSearches - numPrevSearches) >= MAX_TEAM_SEARCHES) {
-			++searchesIt; return false;
+			*(dstIt++) = search;
+			continue;
 		}
 
 		numCurrExecutedSearches[search->GetTeam()] += 1;
 		#endif
+
+		searchBatch.emplace_back(search, path);
 	}
 
-	// removes path from temp-paths, adds it to live-paths
-	if (search->Execute(searchStateOffset, numTerrainChanges)) {
-		search->Finalize(path);
+	searches.erase(dstIt, searches.end());
+	return (!searchBatch.empty());
+}
 
-		#ifdef QTPFS_SEARCH_SHARED_PATHS
-		sharedPaths[path->GetHash()] = path;
-		#endif
+void QTPFS::PathManager::ExecuteSearchBatch() {
+	const auto ExecuteSearch = [&](const int i) {
+		SearchBatchItem& item = searchBatch[i];
+		SearchThreadData& threadData = searchThreadData[ThreadPool::GetThreadNum()];
 
-		#ifdef QTPFS_TRACE_PATH_SEARCHES
-		pathTraces[path->GetID()] = search->GetExecutionTrace();
-		#endif
-	} else {
-		DeletePath(path->GetID());
+		if ((item.found = item.search->Execute(&threadData, numTerrainChanges)))
+			item.search->Finalize(item.path);
+	};
+
+	#ifdef QTPFS_CONSERVATIVE_NEIGHBOR_CACHE_UPDATES
+	// searches update the neighbor-caches of the nodes they visit
+	for (unsigned int i = 0; i < searchBatch.size(); i++) {
+		ExecuteSearch(i);
 	}
+	#else
+	for_mt(0, searchBatch.size(), ExecuteSearch);
+	#endif
+}
 
-	DeleteSearch(search, searches, searchesIt);
-	return true;
+void QTPFS::PathManager::CommitSearchBatch(PathCache& pathCache) {
+	for (SearchBatchItem& item: searchBatch) {
+		IPathSearch* search = item.search;
+		IPath* path = item.path;
+
+		if (item.found) {
+			// removes path from temp-paths, adds it to live-paths
+			// path remains in live-cache until DeletePath is called
+			pathCache.AddLivePath(path);
+
+			#ifdef QTPFS_SEARCH_SHARED_PATHS
+			sharedPaths[path->GetHash()] = path;
+			#endif
+
+			#ifdef QTPFS_TRACE_PATH_SEARCHES
+			pathTraces[path->GetID()] = search->GetExecutionTrace();
+			#endif
+		} else {
+			DeletePath(path->GetID());
+		}
+
+		delete search;
+	}
+
+	searchBatch.clear();
 }
 
 void QTPFS::PathManager::QueueDeadPathSearches(unsigned int pathType) {
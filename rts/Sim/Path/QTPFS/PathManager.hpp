@@ -126,13 +126,14 @@ namespace QTPFS {
 			const bool synced
 		);
 
-		bool ExecuteSearch(
+		bool PrepareSearchBatch(
 			PathSearchVect& searches,
-			PathSearchVectIt& searchesIt,
 			NodeLayer& nodeLayer,
 			PathCache& pathCache,
 			unsigned int pathType
 		);
+		void ExecuteSearchBatch();
+		void CommitSearchBatch(PathCache& pathCache);
 
 		bool IsFinalized() const { return (!nodeTrees.empty()); }
 
@@ -145,6 +146,20 @@ namespace QTPFS {
 		std::vector<PathCache> pathCaches;
 		std::vector< std::vector<IPathSearch*> > pathSearches;
 
+		struct SearchBatchItem {
+			SearchBatchItem(IPathSearch* s, IPath* p): search(s), path(p), found(false) {}
+
+			IPathSearch* search;
+			IPath* path;
+
+			bool found;
+		};
+
+		// searches of one layer that execute concurrently
+		std::vector<SearchBatchItem> searchBatch;
+		// per-thread scratch state, indexed by ThreadPool::GetThreadNum
+		std::vector<SearchThreadData> searchThreadData;
+
 		spring::unordered_map<unsigned int, unsigned int> pathTypes;
 		spring::unordered_map<unsigned int, PathSearchTrace::Execution*> pathTraces;
 
@@ -157,7 +172,6 @@ namespace QTPFS {
 		static unsigned int LAYERS_PER_UPDATE;
 		static unsigned int MAX_TEAM_SEARCHES;
 
-		unsigned int searchStateOffset;
 		unsigned int numTerrainChanges;
 		unsigned int numPathRequests;
 		unsigned int maxNumLeafNodes;
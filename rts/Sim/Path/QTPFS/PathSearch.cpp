@@ -15,8 +15,6 @@
 
 #include "System/float3.h"
 
-QTPFS::binary_heap<QTPFS::INode*> QTPFS::PathSearch::openNodes;
-
 
 
 void QTPFS::PathSearch::Initialize(
@@ -43,10 +41,14 @@ void QTPFS::PathSearch::Initialize(
 }
 
 bool QTPFS::PathSearch::Execute(
-	unsigned int searchStateOffset,
+	SearchThreadData* threadData,
 	unsigned int searchMagicNumber
 ) {
-	searchState = searchStateOffset; // starts at NODE_STATE_OFFSET
+	searchData = threadData;
+	searchData->Init(nodeLayer->GetNumSearchIndices(), nodeLayer->GetNumLeafNodes());
+	searchData->searchState += NODE_STATE_OFFSET;
+
+	searchState = searchData->searchState; // starts at NODE_STATE_OFFSET
 	searchMagic = searchMagicNumber; // starts at numTerrainChanges
 
 	haveFullPath = (srcNode == tgtNode);
@@ -75,12 +77,17 @@ bool QTPFS::PathSearch::Execute(
 	// nodes can represent many terrain squares, some of which can still
 	// be passable and allow a unit to move within a node)
 	// NOTE: we need to make sure such paths do not have infinite cost!
-	if (srcNode->GetMoveCost() == QTPFS_POSITIVE_INFINITY) {
-		srcNode->SetMoveCost(0.0f);
+	// (the node itself is shared with concurrent searches, so only our
+	// view of its cost changes)
+	srcMoveCost = srcNode->GetMoveCost();
+
+	if (srcMoveCost == QTPFS_POSITIVE_INFINITY) {
+		srcMoveCost = 0.0f;
 	}
 
+	binary_heap<SearchNode*>& openNodes = searchData->openNodes;
+
 	ResetState(srcNode);
-	UpdateNode(srcNode, NULL, 0);
 
 	while (!openNodes.empty()) {
 		IterateNodes(nodeLayer->GetNodes());
@@ -98,11 +105,6 @@ bool QTPFS::PathSearch::Execute(
 		}
 	}
 
-	if (srcNode->GetMoveCost() == 0.0f) {
-		srcNode->SetMoveCost(QTPFS_POSITIVE_INFINITY);
-	}
-
-
 	#ifdef QTPFS_SUPPORT_PARTIAL_SEARCHES
 	// adjust the target-point if we only got a partial result
 	// NOTE:
@@ -139,8 +141,10 @@ void QTPFS::PathSearch::ResetState(INode* node) {
 		hCosts[i] = 0.0f;
 	}
 
-	openNodes.reset();
-	openNodes.push(node);
+	UpdateNode(node, NULL, 0);
+
+	searchData->openNodes.reset();
+	searchData->openNodes.push(&GetSearchNode(node));
 }
 
 void QTPFS::PathSearch::UpdateNode(INode* nextNode, INode* prevNode, unsigned int netPointIdx) {
@@ -149,15 +153,21 @@ void QTPFS::PathSearch::UpdateNode(INode* nextNode, INode* prevNode, unsigned in
 	//   but this is *impossible* to achieve on a non-regular
 	//   grid on which any node only has an average move-cost
 	//   associated with it --> paths will be "nearly optimal"
-	nextNode->SetPrevNode(prevNode);
-	nextNode->SetPathCosts(gCosts[netPointIdx], hCosts[netPointIdx]);
-	nextNode->SetSearchState(searchState | NODE_STATE_OPEN);
-	nextNode->SetNeighborEdgeTransitionPoint(0, netPoints[netPointIdx]);
+	SearchNode& searchNode = GetSearchNode(nextNode);
+
+	searchNode.SetNode(nextNode);
+	searchNode.SetPrevNode(prevNode);
+	searchNode.SetPathCosts(gCosts[netPointIdx], hCosts[netPointIdx]);
+	searchNode.SetSearchState(searchState | NODE_STATE_OPEN);
+	searchNode.SetEntryPoint(netPoints[netPointIdx]);
 }
 
 void QTPFS::PathSearch::IterateNodes(const std::vector<INode*>& allNodes) {
-	curNode = openNodes.top();
-	curNode->SetSearchState(searchState | NODE_STATE_CLOSED);
+	binary_heap<SearchNode*>& openNodes = searchData->openNodes;
+	SearchNode* curSearchNode = openNodes.top();
+
+	curNode = curSearchNode->GetNode();
+	curSearchNode->SetSearchState(searchState | NODE_STATE_CLOSED);
 	#ifdef QTPFS_CONSERVATIVE_NEIGHBOR_CACHE_UPDATES
 	// in the non-conservative case, this is done from
 	// NodeLayer::ExecNodeNeighborCacheUpdates instead
@@ -173,7 +183,7 @@ void QTPFS::PathSearch::IterateNodes(const std::vector<INode*>& allNodes) {
 
 	if (curNode == tgtNode)
 		return;
-	if (curNode->AllSquaresImpassable())
+	if (GetMoveCost(curNode) == QTPFS_POSITIVE_INFINITY)
 		return;
 
 	if (curNode->xmid() < searchRect.x1) return;
@@ -183,7 +193,7 @@ void QTPFS::PathSearch::IterateNodes(const std::vector<INode*>& allNodes) {
 
 	#ifdef QTPFS_SUPPORT_PARTIAL_SEARCHES
 	// remember the node with lowest h-cost in case the search fails to reach tgtNode
-	if (curNode->GetPathCost(NODE_PATH_COST_H) < minNode->GetPathCost(NODE_PATH_COST_H))
+	if (curSearchNode->GetPathCost(NODE_PATH_COST_H) < GetSearchNode(minNode).GetPathCost(NODE_PATH_COST_H))
 		minNode = curNode;
 	#endif
 
@@ -191,8 +201,12 @@ void QTPFS::PathSearch::IterateNodes(const std::vector<INode*>& allNodes) {
 }
 
 void QTPFS::PathSearch::IterateNodeNeighbors(const std::vector<INode*>& nxtNodes) {
+	binary_heap<SearchNode*>& openNodes = searchData->openNodes;
+	const SearchNode& curSearchNode = GetSearchNode(curNode);
+
 	// if curNode equals srcNode, this is just the original srcPoint
-	const float3 curPoint = curNode->GetNeighborEdgeTransitionPoint(0);
+	const float3 curPoint = curSearchNode.GetEntryPoint();
+	const float curMoveCost = GetMoveCost(curNode);
 
 	for (unsigned int i = 0; i < nxtNodes.size(); i++) {
 		// NOTE:
@@ -214,11 +228,15 @@ void QTPFS::PathSearch::IterateNodeNeighbors(const std::vector<INode*>& nxtNodes
 		//   nightmare)
 		nxtNode = nxtNodes[i];
 
-		if (nxtNode->AllSquaresImpassable())
+		const float nxtMoveCost = GetMoveCost(nxtNode);
+
+		if (nxtMoveCost == QTPFS_POSITIVE_INFINITY)
 			continue;
 
-		const bool isCurrent = (nxtNode->GetSearchState() >= searchState);
-		const bool isClosed = ((nxtNode->GetSearchState() & 1) == NODE_STATE_CLOSED);
+		SearchNode& nxtSearchNode = GetSearchNode(nxtNode);
+
+		const bool isCurrent = (nxtSearchNode.GetSearchState() >= searchState);
+		const bool isClosed = ((nxtSearchNode.GetSearchState() & 1) == NODE_STATE_CLOSED);
 		const bool isTarget = (nxtNode == tgtNode);
 
 		unsigned int netPointIdx = 0;
@@ -237,9 +255,9 @@ void QTPFS::PathSearch::IterateNodeNeighbors(const std::vector<INode*>& nxtNodes
 			gDists[0] = curPoint.distance(netPoints[0]);
 			hDists[0] = tgtPoint.distance(netPoints[0]);
 			gCosts[0] =
-				curNode->GetPathCost(NODE_PATH_COST_G) +
-				curNode->GetMoveCost() * gDists[0] +
-				nxtNode->GetMoveCost() * hDists[0] * int(isTarget);
+				curSearchNode.GetPathCost(NODE_PATH_COST_G) +
+				curMoveCost * gDists[0] +
+				nxtMoveCost * hDists[0] * int(isTarget);
 			hCosts[0] = hDists[0] * hCostMult * int(!isTarget);
 		}
 		#else
@@ -255,9 +273,9 @@ void QTPFS::PathSearch::IterateNodeNeighbors(const std::vector<INode*>& nxtNodes
 			gDists[j] = curPoint.distance(netPoints[j]);
 			hDists[j] = tgtPoint.distance(netPoints[j]);
 			gCosts[j] =
-				curNode->GetPathCost(NODE_PATH_COST_G) +
-				curNode->GetMoveCost() * gDists[j] +
-				nxtNode->GetMoveCost() * hDists[j] * int(isTarget);
+				curSearchNode.GetPathCost(NODE_PATH_COST_G) +
+				curMoveCost * gDists[j] +
+				nxtMoveCost * hDists[j] * int(isTarget);
 			hCosts[j] = hDists[j] * hCostMult * int(!isTarget);
 
 			if ((gCosts[j] + hCosts[j]) < (gCosts[netPointIdx] + hCosts[netPointIdx])) {
@@ -269,7 +287,7 @@ void QTPFS::PathSearch::IterateNodeNeighbors(const std::vector<INode*>& nxtNodes
 		if (!isCurrent) {
 			UpdateNode(nxtNode, curNode, netPointIdx);
 
-			openNodes.push(nxtNode);
+			openNodes.push(&nxtSearchNode);
 			openNodes.check_heap_property(0);
 
 			#ifdef QTPFS_TRACE_PATH_SEARCHES
@@ -278,10 +296,10 @@ void QTPFS::PathSearch::IterateNodeNeighbors(const std::vector<INode*>& nxtNodes
 
 			continue;
 		}
-		if (gCosts[netPointIdx] >= nxtNode->GetPathCost(NODE_PATH_COST_G))
+		if (gCosts[netPointIdx] >= nxtSearchNode.GetPathCost(NODE_PATH_COST_G))
 			continue;
 		if (isClosed)
-			openNodes.push(nxtNode);
+			openNodes.push(&nxtSearchNode);
 
 		UpdateNode(nxtNode, curNode, netPointIdx);
 
@@ -289,7 +307,7 @@ void QTPFS::PathSearch::IterateNodeNeighbors(const std::vector<INode*>& nxtNodes
 		// (changing the f-cost of an OPEN node messes up the
 		// queue's internal consistency; a pushed node remains
 		// OPEN until it gets popped)
-		openNodes.resort(nxtNode);
+		openNodes.resort(&nxtSearchNode);
 		openNodes.check_heap_property(0);
 	}
 }
@@ -302,9 +320,6 @@ void QTPFS::PathSearch::Finalize(IPath* path) {
 	#endif
 
 	path->SetBoundingBox();
-
-	// path remains in live-cache until DeletePath is called
-	pathCache->AddLivePath(path);
 }
 
 void QTPFS::PathSearch::TracePath(IPath* path) {
@@ -313,12 +328,12 @@ void QTPFS::PathSearch::TracePath(IPath* path) {
 
 	if (srcNode != tgtNode) {
 		INode* tmpNode = tgtNode;
-		INode* prvNode = tmpNode->GetPrevNode();
+		INode* prvNode = GetSearchNode(tmpNode).GetPrevNode();
 
 		float3 prvPoint = tgtPoint;
 
 		while ((prvNode != nullptr) && (tmpNode != srcNode)) {
-			const float3& tmpPoint = tmpNode->GetNeighborEdgeTransitionPoint(0);
+			const float3& tmpPoint = GetSearchNode(tmpNode).GetEntryPoint();
 
 			assert(!math::isinf(tmpPoint.x) && !math::isinf(tmpPoint.z));
 			assert(!math::isnan(tmpPoint.x) && !math::isnan(tmpPoint.z));
@@ -333,16 +348,9 @@ void QTPFS::PathSearch::TracePath(IPath* path) {
 				points.push_front(tmpPoint);
 			}
 
-			#ifndef QTPFS_SMOOTH_PATHS
-			// make sure the back-pointers can never become dangling
-			// (if smoothing IS enabled, we delay this until we reach
-			// SmoothPath() because we still need them there)
-			tmpNode->SetPrevNode(NULL);
-			#endif
-
 			prvPoint = tmpPoint;
 			tmpNode = prvNode;
-			prvNode = tmpNode->GetPrevNode();
+			prvNode = GetSearchNode(tmpNode).GetPrevNode();
 		}
 	}
 
@@ -368,25 +376,16 @@ void QTPFS::PathSearch::SmoothPath(IPath* path) const {
 	if (path->NumPoints() == 2)
 		return;
 
-	assert(srcNode->GetPrevNode() == NULL);
+	assert(GetSearchNode(srcNode).GetPrevNode() == NULL);
 
+	// back-pointers live in our thread's scratch state and
+	// are invalidated by the next search, no need to reset
 	for (unsigned int k = 0; k < QTPFS_MAX_SMOOTHING_ITERATIONS; k++) {
 		if (!SmoothPathIter(path)) {
 			// all waypoints stopped moving
 			break;
 		}
 	}
-
-	INode* n0 = tgtNode;
-	INode* n1 = tgtNode;
-
-	while (n1 != srcNode) {
-		n0 = n1;
-		n1 = n0->GetPrevNode();
-
-		// reset back-pointers
-		n0->SetPrevNode(NULL);
-	}
 }
 
 bool QTPFS::PathSearch::SmoothPathIter(IPath* path) const {
@@ -402,7 +401,7 @@ bool QTPFS::PathSearch::SmoothPathIter(IPath* path) const {
 
 	while (n1 != srcNode) {
 		n0 = n1;
-		n1 = n0->GetPrevNode();
+		n1 = GetSearchNode(n0).GetPrevNode();
 		ni -= 1;
 
 		assert(n1->GetNeighborRelation(n0) != 0);
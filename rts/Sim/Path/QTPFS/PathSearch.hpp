@@ -3,6 +3,7 @@
 #ifndef QTPFS_PATHSEARCH_HDR
 #define QTPFS_PATHSEARCH_HDR
 
+#include <algorithm>
 #include <vector>
 
 #include "PathDefines.hpp"
@@ -65,12 +66,91 @@ namespace QTPFS {
 	}
 
 
+	// per-search state of a single leaf-node, indexed by INode::GetSearchIndex
+	struct SearchNode {
+	public:
+		SearchNode()
+			: node(nullptr)
+			, prevNode(nullptr)
+			, heapIndex(-1u)
+			, searchState(0)
+			, fCost(0.0f)
+			, gCost(0.0f)
+			, hCost(0.0f)
+			{}
+
+		void SetHeapIndex(unsigned int n) { heapIndex = n; }
+		unsigned int GetHeapIndex() const { return heapIndex; }
+		float GetHeapPriority() const { return fCost; }
+
+		bool operator <  (const SearchNode* n) const { return (fCost <  n->fCost); }
+		bool operator >  (const SearchNode* n) const { return (fCost >  n->fCost); }
+		bool operator == (const SearchNode* n) const { return (fCost == n->fCost); }
+		bool operator <= (const SearchNode* n) const { return (fCost <= n->fCost); }
+		bool operator >= (const SearchNode* n) const { return (fCost >= n->fCost); }
+
+		void SetPathCosts(float g, float h) { fCost = g + h; gCost = g; hCost = h; }
+		float GetPathCost(unsigned int type) const { return (&fCost)[type]; }
+
+		void SetSearchState(unsigned int state) { searchState = state; }
+		unsigned int GetSearchState() const { return searchState; }
+
+		void SetNode(INode* n) { node = n; }
+		void SetPrevNode(INode* n) { prevNode = n; }
+		INode* GetNode() const { return node; }
+		INode* GetPrevNode() const { return prevNode; }
+
+		// transition-point on the edge through which the search entered this node
+		void SetEntryPoint(const float3& p) { entryPoint = p; }
+		const float3& GetEntryPoint() const { return entryPoint; }
+
+	private:
+		INode* node;
+		// points back to previous node in path
+		INode* prevNode;
+
+		unsigned int heapIndex;
+		unsigned int searchState;
+
+		float fCost;
+		float gCost;
+		float hCost;
+
+		float3 entryPoint;
+	};
+
+	// scratch memory of all searches executed by one thread; node
+	// entries are never cleared but invalidated by bumping searchState
+	struct SearchThreadData {
+	public:
+		SearchThreadData(): searchState(0) {}
+
+		void Init(unsigned int numNodes, unsigned int numLeafNodes) {
+			if (allNodes.size() < numNodes)
+				allNodes.resize(numNodes);
+			if (openNodes.capacity() < std::max(numLeafNodes, 1u))
+				openNodes.reserve(std::max(numLeafNodes, 1u));
+		}
+
+		std::vector<SearchNode> allNodes;
+
+		// allocated once, re-used by all searches without clear()'s
+		// this relies on SearchNode::operator< to sort by increasing f-cost
+		binary_heap<SearchNode*> openNodes;
+
+		// offset that identifies nodes as part of current search
+		unsigned int searchState;
+	};
+
+
+	// NOTE:
+	//     searches keep their per-node state in a SearchThreadData and
+	//     only read the node-tree, so any number of them can execute
+	//     concurrently as long as the tree is not re-tesselated
 	// NOTE:
-	//     we could support "time-sliced" execution, but we would have
-	//     to isolate each query from modifying another's INode members
-	//     (*Cost, nodeState, etc.) --> memory-intensive
-	//     also, terrain changes could invalidate partial paths without
-	//     buffering the *entire* heightmap each frame --> not efficient
+	//     we could support "time-sliced" execution, but terrain changes
+	//     could invalidate partial paths without buffering the *entire*
+	//     heightmap each frame --> not efficient
 	// NOTE:
 	//     with time-sliced execution, {src,tgt,cur,nxt}Node can become
 	//     dangling
@@ -92,9 +172,11 @@ namespace QTPFS {
 			const SRectangle& searchArea
 		) = 0;
 		virtual bool Execute(
-			unsigned int searchStateOffset = 0,
+			SearchThreadData* threadData,
 			unsigned int searchMagicNumber = 0
 		) = 0;
+		// must be called on the same thread as Execute, the path
+		// still has to be added to the live-cache by the caller
 		virtual void Finalize(IPath* path) = 0;
 		virtual bool SharedFinalize(const IPath* srcPath, IPath* dstPath) { return false; }
 		virtual PathSearchTrace::Execution* GetExecutionTrace() { return NULL; }
@@ -111,7 +193,7 @@ namespace QTPFS {
 		unsigned int searchTeam;   // which team queued this search
 
 		unsigned int searchType;   // indicates if Dijkstra (h==0) or A* (h!=0) search is employed
-		unsigned int searchState;  // offset that identifies nodes as part of current search
+		unsigned int searchState;  // offset that identifies nodes as part of current search (copied from SearchThreadData)
 		unsigned int searchMagic;  // used to signal nodes they should update their neighbor-set
 	};
 
@@ -122,6 +204,7 @@ namespace QTPFS {
 			: IPathSearch(pathSearchType)
 			, nodeLayer(NULL)
 			, pathCache(NULL)
+			, searchData(NULL)
 			, searchExec(NULL)
 			, srcNode(NULL)
 			, tgtNode(NULL)
@@ -129,10 +212,10 @@ namespace QTPFS {
 			, nxtNode(NULL)
 			, minNode(NULL)
 			, hCostMult(0.0f)
+			, srcMoveCost(0.0f)
 			, haveFullPath(false)
 			, havePartPath(false)
 			{}
-		~PathSearch() { openNodes.reset(); }
 
 		void Initialize(
 			NodeLayer* layer,
@@ -142,7 +225,7 @@ namespace QTPFS {
 			const SRectangle& searchArea
 		);
 		bool Execute(
-			unsigned int searchStateOffset = 0,
+			SearchThreadData* threadData,
 			unsigned int searchMagicNumber = 0
 		);
 		void Finalize(IPath* path);
@@ -151,10 +234,12 @@ namespace QTPFS {
 
 		const std::uint64_t GetHash(std::uint64_t N, std::uint32_t k) const;
 
-		static void InitGlobalQueue(unsigned int n) { openNodes.reserve(n); }
-		static void FreeGlobalQueue() { openNodes.clear(); }
-
 	private:
+		SearchNode& GetSearchNode(const INode* n) const { return searchData->allNodes[n->GetSearchIndex()]; }
+
+		// the source-node is treated as passable even if it is not
+		float GetMoveCost(const INode* n) const { return ((n == srcNode)? srcMoveCost: n->GetMoveCost()); }
+
 		void ResetState(INode* node);
 		void UpdateNode(INode* nextNode, INode* prevNode, unsigned int netPointIdx);
 
@@ -165,13 +250,12 @@ namespace QTPFS {
 		void SmoothPath(IPath* path) const;
 		bool SmoothPathIter(IPath* path) const;
 
-		// global queue: allocated once, re-used by all searches without clear()'s
-		// this relies on INode::operator< to sort the INode*'s by increasing f-cost
-		static binary_heap<INode*> openNodes;
-
 		NodeLayer* nodeLayer;
 		PathCache* pathCache;
 
+		// scratch state of the thread that executed us
+		SearchThreadData* searchData;
+
 		// not used unless QTPFS_TRACE_PATH_SEARCHES is defined
 		PathSearchTrace::Execution* searchExec;
 		PathSearchTrace::Iteration searchIter;
@@ -193,6 +277,7 @@ namespace QTPFS {
 		float hCosts[QTPFS_MAX_NETPOINTS_PER_NODE_EDGE];
 
 		float hCostMult;
+		float srcMoveCost;
 
 		bool haveFullPath;
 		bool havePartPath;
@@ -1,5 +1,6 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
+#include <algorithm>
 #include <cassert>
 
 #include "BuilderCAI.h"
@@ -53,9 +54,9 @@ CR_REG_METADATA(CBuilderCAI , (
 ))
 
 // not adding to members, should repopulate itself
-spring::unordered_set<int> CBuilderCAI::reclaimers;
-spring::unordered_set<int> CBuilderCAI::featureReclaimers;
-spring::unordered_set<int> CBuilderCAI::resurrecters;
+CBuilderCAI::TargetRegistry CBuilderCAI::reclaimers;
+CBuilderCAI::TargetRegistry CBuilderCAI::featureReclaimers;
+CBuilderCAI::TargetRegistry CBuilderCAI::resurrecters;
 
 
 static std::string GetUnitDefBuildOptionToolTip(const UnitDef* ud, bool disabled) {
@@ -227,9 +228,9 @@ CBuilderCAI::~CBuilderCAI()
 
 void CBuilderCAI::InitStatic()
 {
-	spring::clear_unordered_set(reclaimers);
-	spring::clear_unordered_set(featureReclaimers);
-	spring::clear_unordered_set(resurrecters);
+	reclaimers.Clear();
+	featureReclaimers.Clear();
+	resurrecters.Clear();
 }
 
 void CBuilderCAI::PostLoad()
@@ -1002,7 +1003,7 @@ void CBuilderCAI::ExecuteReclaim(Command& c)
 					StopMoveAndFinishCommand();
 					RemoveUnitFromFeatureReclaimers(owner);
 				} else {
-					AddUnitToFeatureReclaimers(owner);
+					AddUnitToFeatureReclaimers(owner, feature->id);
 				}
 			} else {
 				StopMoveAndFinishCommand();
@@ -1037,7 +1038,7 @@ void CBuilderCAI::ExecuteReclaim(Command& c)
 				if (!ReclaimObject(unit)) {
 					StopMoveAndFinishCommand();
 				} else {
-					AddUnitToReclaimers(owner);
+					AddUnitToReclaimers(owner, unit->id);
 				}
 			} else {
 				RemoveUnitFromReclaimers(owner);
@@ -1112,7 +1113,7 @@ void CBuilderCAI::ExecuteResurrect(Command& c)
 					StopMoveAndFinishCommand();
 				}
 				else {
-					AddUnitToResurrecters(owner);
+					AddUnitToResurrecters(owner, feature->id);
 				}
 			} else {
 				RemoveUnitFromResurrecters(owner);
@@ -1327,126 +1328,128 @@ int CBuilderCAI::GetDefaultCmd(const CUnit* pointed, const CFeature* feature)
 }
 
 
-void CBuilderCAI::AddUnitToReclaimers(CUnit* unit) { reclaimers.insert(unit->id); }
-void CBuilderCAI::RemoveUnitFromReclaimers(CUnit* unit) { reclaimers.erase(unit->id); }
+void CBuilderCAI::TargetRegistry::Add(int builderID, int targetID)
+{
+	const auto it = builderTargets.find(builderID);
 
-void CBuilderCAI::AddUnitToFeatureReclaimers(CUnit* unit) { featureReclaimers.insert(unit->id); }
-void CBuilderCAI::RemoveUnitFromFeatureReclaimers(CUnit* unit) { featureReclaimers.erase(unit->id); }
+	if (it != builderTargets.end()) {
+		if (it->second == targetID)
+			return;
 
-void CBuilderCAI::AddUnitToResurrecters(CUnit* unit) { resurrecters.insert(unit->id); }
-void CBuilderCAI::RemoveUnitFromResurrecters(CUnit* unit) { resurrecters.erase(unit->id); }
+		Remove(builderID);
+	}
 
+	builderTargets[builderID] = targetID;
+	targetBuilders[targetID].push_back(builderID);
+}
 
-/**
- * Checks if a unit is being reclaimed by a friendly con.
- *
- * We assume that there will not be a lot of reclaimers, because performance
- * would suck if there were. Ideally, reclaimers should be assigned on a
- * per-unit basis, but this requires tracking of deaths, which albeit
- * already done, is not exactly simple to follow.
- *
- * TODO easy: store reclaiming units per allyteam
- * TODO harder: update reclaimers as they start/finish reclaims and/or die
- */
-bool CBuilderCAI::IsUnitBeingReclaimed(const CUnit* unit, CUnit *friendUnit)
+void CBuilderCAI::TargetRegistry::Remove(int builderID)
 {
-	bool retval = false;
+	const auto it = builderTargets.find(builderID);
 
-	std::vector<int> rm;
+	if (it == builderTargets.end())
+		return;
 
-	for (auto it = reclaimers.begin(); it != reclaimers.end(); ++it) {
-		const CUnit* u = unitHandler->GetUnit(*it);
-		const CCommandAI* cai = u->commandAI;
-		const CCommandQueue& cq = cai->commandQue;
+	const auto jt = targetBuilders.find(it->second);
 
-		if (cq.empty()) {
-			rm.push_back(u->id);
-			continue;
-		}
-		const Command& c = cq.front();
-		if (c.GetID() != CMD_RECLAIM || (c.params.size() != 1 && c.params.size() != 5)) {
-			rm.push_back(u->id);
-			continue;
-		}
-		const int cmdUnitId = (int)c.params[0];
-		if (cmdUnitId == unit->id && (!friendUnit || teamHandler->Ally(friendUnit->allyteam, u->allyteam))) {
-			retval = true;
-			break;
-		}
+	if (jt != targetBuilders.end()) {
+		std::vector<int>& builders = jt->second;
+
+		builders.erase(std::find(builders.begin(), builders.end(), builderID));
+
+		if (builders.empty())
+			targetBuilders.erase(jt);
 	}
 
-	for (auto it = rm.begin(); it != rm.end(); ++it)
-		RemoveUnitFromReclaimers(unitHandler->GetUnit(*it));
+	builderTargets.erase(it);
+}
 
-	return retval;
+void CBuilderCAI::TargetRegistry::Clear()
+{
+	spring::clear_unordered_map(builderTargets);
+	spring::clear_unordered_map(targetBuilders);
 }
 
 
-bool CBuilderCAI::IsFeatureBeingReclaimed(int featureId, CUnit *friendUnit)
+void CBuilderCAI::AddUnitToReclaimers(CUnit* unit, int unitID) { reclaimers.Add(unit->id, unitID); }
+void CBuilderCAI::RemoveUnitFromReclaimers(CUnit* unit) { reclaimers.Remove(unit->id); }
+
+void CBuilderCAI::AddUnitToFeatureReclaimers(CUnit* unit, int featureID) { featureReclaimers.Add(unit->id, featureID); }
+void CBuilderCAI::RemoveUnitFromFeatureReclaimers(CUnit* unit) { featureReclaimers.Remove(unit->id); }
+
+void CBuilderCAI::AddUnitToResurrecters(CUnit* unit, int featureID) { resurrecters.Add(unit->id, featureID); }
+void CBuilderCAI::RemoveUnitFromResurrecters(CUnit* unit) { resurrecters.Remove(unit->id); }
+
+
+/**
+ * Checks if any (friendly, if friendUnit is given) builder registered for
+ * targetID is still executing <cmdID> on it, i.e. has it at the front of
+ * its queue with <cmdParam> as first parameter. Builders whose queue has
+ * moved on without unregistering are pruned here.
+ */
+bool CBuilderCAI::IsTargetClaimed(TargetRegistry& registry, int targetID, int cmdID, int cmdParam, const CUnit* friendUnit)
 {
+	const std::vector<int>* builders = registry.GetBuilders(targetID);
+
+	if (builders == nullptr)
+		return false;
+
 	bool retval = false;
 
 	std::vector<int> rm;
 
-	for (auto it = featureReclaimers.begin(); it != featureReclaimers.end(); ++it) {
-		const CUnit* u = unitHandler->GetUnit(*it);
+	for (const int builderID: *builders) {
+		const CUnit* u = unitHandler->GetUnit(builderID);
 		const CCommandAI* cai = u->commandAI;
 		const CCommandQueue& cq = cai->commandQue;
 
 		if (cq.empty()) {
-			rm.push_back(u->id);
+			rm.push_back(builderID);
 			continue;
 		}
+
 		const Command& c = cq.front();
-		if (c.GetID() != CMD_RECLAIM || (c.params.size() != 1 && c.params.size() != 5)) {
-			rm.push_back(u->id);
+		const size_t numParams = c.params.size();
+
+		if (c.GetID() != cmdID || (numParams != 1 && (cmdID != CMD_RECLAIM || numParams != 5)) || int(c.params[0]) != cmdParam) {
+			rm.push_back(builderID);
 			continue;
 		}
-		const int cmdFeatureId = (int)c.params[0];
-		if (cmdFeatureId-unitHandler->MaxUnits() == featureId && (!friendUnit || teamHandler->Ally(friendUnit->allyteam, u->allyteam))) {
+
+		if (friendUnit == nullptr || teamHandler->Ally(friendUnit->allyteam, u->allyteam)) {
 			retval = true;
 			break;
 		}
 	}
 
-	for (auto it = rm.begin(); it != rm.end(); ++it)
-		RemoveUnitFromFeatureReclaimers(unitHandler->GetUnit(*it));
+	for (const int builderID: rm)
+		registry.Remove(builderID);
 
 	return retval;
 }
 
 
-bool CBuilderCAI::IsFeatureBeingResurrected(int featureId, CUnit *friendUnit)
+/**
+ * Checks if a unit is being reclaimed by a friendly con.
+ *
+ * Reclaimers are indexed by their target, so only the builders working
+ * on <unit> need to be inspected.
+ */
+bool CBuilderCAI::IsUnitBeingReclaimed(const CUnit* unit, CUnit *friendUnit)
 {
-	bool retval = false;
+	return (IsTargetClaimed(reclaimers, unit->id, CMD_RECLAIM, unit->id, friendUnit));
+}
 
-	std::vector<int> rm;
 
-	for (auto it = resurrecters.begin(); it != resurrecters.end(); ++it) {
-		const CUnit* u = unitHandler->GetUnit(*it);
-		const CCommandAI* cai = u->commandAI;
-		const CCommandQueue& cq = cai->commandQue;
-
-		if (cq.empty()) {
-			rm.push_back(u->id);
-			continue;
-		}
-		const Command& c = cq.front();
-		if (c.GetID() != CMD_RESURRECT || c.params.size() != 1) {
-			rm.push_back(u->id);
-			continue;
-		}
-		const int cmdFeatureId = (int)c.params[0];
-		if (cmdFeatureId-unitHandler->MaxUnits() == featureId && (!friendUnit || teamHandler->Ally(friendUnit->allyteam, u->allyteam))) {
-			retval = true;
-			break;
-		}
-	}
+bool CBuilderCAI::IsFeatureBeingReclaimed(int featureId, CUnit *friendUnit)
+{
+	return (IsTargetClaimed(featureReclaimers, featureId, CMD_RECLAIM, featureId + unitHandler->MaxUnits(), friendUnit));
+}
 
-	for (auto it = rm.begin(); it != rm.end(); ++it)
-		RemoveUnitFromResurrecters(unitHandler->GetUnit(*it));
 
-	return retval;
+bool CBuilderCAI::IsFeatureBeingResurrected(int featureId, CUnit *friendUnit)
+{
+	return (IsTargetClaimed(resurrecters, featureId, CMD_RESURRECT, featureId + unitHandler->MaxUnits(), friendUnit));
 }
 
 
@@ -6,9 +6,11 @@
 #include "MobileCAI.h"
 #include "Sim/Units/BuildInfo.h"
 #include "System/Misc/BitwiseEnum.h"
+#include "System/UnorderedMap.hpp"
 #include "System/UnorderedSet.hpp"
 
 #include <string>
+#include <vector>
 
 class CUnit;
 class CBuilder;
@@ -63,11 +65,35 @@ public:
 	bool IsInBuildRange(const float3& pos, const float radius) const;
 
 public:
+	/// reverse index from a target (unit- or feature-ID) to the builders working on it
+	struct TargetRegistry {
+	public:
+		void Add(int builderID, int targetID);
+		void Remove(int builderID);
+		void Clear();
+
+		const std::vector<int>* GetBuilders(int targetID) const {
+			const auto it = targetBuilders.find(targetID);
+
+			if (it == targetBuilders.end())
+				return nullptr;
+
+			return &it->second;
+		}
+
+		/// every registered builder, keyed by ID, with its current target
+		const spring::unordered_map<int, int>& GetBuilderTargets() const { return builderTargets; }
+
+	private:
+		spring::unordered_map<int, int> builderTargets;
+		spring::unordered_map<int, std::vector<int> > targetBuilders;
+	};
+
 	spring::unordered_set<int> buildOptions;
 
-	static spring::unordered_set<int> reclaimers;
-	static spring::unordered_set<int> featureReclaimers;
-	static spring::unordered_set<int> resurrecters;
+	static TargetRegistry reclaimers;
+	static TargetRegistry featureReclaimers;
+	static TargetRegistry resurrecters;
 
 private:
 	enum ReclaimOptions {
@@ -123,17 +149,19 @@ private:
 	void ReclaimFeature(CFeature* f);
 
 	/// fix for patrolling cons repairing/resurrecting stuff that's being reclaimed
-	static void AddUnitToReclaimers(CUnit*);
+	static void AddUnitToReclaimers(CUnit*, int unitID);
 	static void RemoveUnitFromReclaimers(CUnit*);
 
 	/// fix for cons wandering away from their target circle
-	static void AddUnitToFeatureReclaimers(CUnit*);
+	static void AddUnitToFeatureReclaimers(CUnit*, int featureID);
 	static void RemoveUnitFromFeatureReclaimers(CUnit*);
 
 	/// fix for patrolling cons reclaiming stuff that is being resurrected
-	static void AddUnitToResurrecters(CUnit*);
+	static void AddUnitToResurrecters(CUnit*, int featureID);
 	static void RemoveUnitFromResurrecters(CUnit*);
 
+	static bool IsTargetClaimed(TargetRegistry& registry, int targetID, int cmdID, int cmdParam, const CUnit* friendUnit);
+
 	inline float f3Dist(const float3& a, const float3& b) const {
 		return range3D ? a.distance(b) : a.distance2D(b);
 	}
@@ -10,6 +10,7 @@
 #include <vector>
 #else
 #include "System/SafeVector.h"
+#include "System/SmallVector.h"
 #endif
 
 #include "System/creg/creg_cond.h"
@@ -253,7 +254,7 @@ public:
 		rc.numParams   = params.size();
 		rc.tag         = tag;
 		rc.options     = options;
-		rc.params      = &params[0];
+		rc.params      = params.data();
 		return rc;
 	}
 
@@ -444,7 +445,9 @@ public:
 	#ifdef BUILDING_AI
 	std::vector<float> params;
 	#else
-	safe_vector<float> params;
+	/// nearly all commands carry at most 8 parameters (CMD_INSERT with an
+	/// area-argument being the largest common case), keep those inline
+	safe_vector<float, spring::small_vector<float, 8> > params;
 	#endif
 };
 
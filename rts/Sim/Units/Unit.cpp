@@ -327,6 +327,8 @@ void CUnit::PreInit(const UnitLoadParams& params)
 
 	heading  = GetHeadingFromFacing(buildFacing);
 	upright  = unitDef->upright;
+	// needed before the quadfield insertion below (per-allyteam category masks)
+	category = unitDef->category;
 
 	SetVelocity(params.speed);
 	Move((params.pos).cClampInMap(), false);
@@ -361,7 +363,6 @@ void CUnit::PreInit(const UnitLoadParams& params)
 	buildTime = unitDef->buildTime;
 	armoredMultiple = std::max(0.0001f, unitDef->armoredMultiple); // armored multiple of 0 will crash spring
 	armorType = unitDef->armorType;
-	category = unitDef->category;
 	leaveTracks = unitDef->decalDef.leaveTrackDecals;
 
 	tooltip = unitDef->humanName + " - " + unitDef->tooltip;
@@ -12,6 +12,7 @@
 
 #include "CommandAI/BuilderCAI.h"
 #include "Sim/Misc/GlobalSynced.h"
+#include "Sim/Misc/LosHandler.h"
 #include "Sim/Misc/TeamHandler.h"
 #include "Sim/MoveTypes/MoveType.h"
 #include "Sim/Weapons/Weapon.h"
@@ -36,6 +37,11 @@ CR_REG_METADATA(CUnitHandler, (
 
 	CR_MEMBER(builderCAIs),
 
+	CR_IGNORED(unitLosKeys),
+	CR_IGNORED(prevGlobalLOS),
+	CR_IGNORED(changedGlobalLOS),
+	CR_IGNORED(lastLosStatusFrame),
+
 	CR_MEMBER(activeSlowUpdateUnit),
 	CR_MEMBER(activeUpdateUnit),
 
@@ -116,6 +122,8 @@ CUnitHandler::CUnitHandler() {
 	}
 
 	units.resize(maxUnits, nullptr);
+	unitLosKeys.resize(maxUnits);
+	prevGlobalLOS.resize(teamHandler->ActiveAllyTeams(), false);
 	unitsByDefs.resize(teamHandler->ActiveTeams(), std::vector<std::vector<CUnit*>>(unitDefHandler->NumUnitDefs() + 1));
 
 	unitMemPool.reserve(128);
@@ -192,6 +200,9 @@ bool CUnitHandler::AddUnit(CUnit* unit)
 
 	InsertActiveUnit(unit);
 
+	// IDs are recycled, make sure the first LOS status update is not skipped
+	unitLosKeys[unit->id] = LosStatusKey();
+
 	teamHandler->Team(unit->team)->AddUnit(unit, CTeam::AddBuilt);
 
 	// 0 is not a valid UnitDef id, so just use unitsByDefs[team][0]
@@ -310,15 +321,91 @@ void CUnitHandler::UpdateUnitMoveTypes()
 	}
 }
 
+void CUnitHandler::InvalidateUnitLosStatus(const CUnit* unit)
+{
+	unitLosKeys[unit->id] = LosStatusKey();
+}
+
+CUnitHandler::LosStatusKey CUnitHandler::GetLosStatusKey(const CUnit* unit)
+{
+	const ILosType& losType = unit->useAirLos? losHandler->airLos: losHandler->los;
+
+	LosStatusKey key;
+	key.losSquares[0] = losType.GetSquareIndex(unit->pos);
+	key.losSquares[1] = losType.GetSquareIndex(unit->pos + unit->speed);
+	key.radarSquare = losHandler->radar.GetSquareIndex(unit->pos);
+	key.flags =
+		(unit->useAirLos     << 0) |
+		(unit->alwaysVisible << 1) |
+		(unit->isCloaked     << 2) |
+		(unit->stealth       << 3) |
+		(unit->sonarStealth  << 4) |
+		(unit->beingBuilt    << 5) |
+		(unit->IsInWater()   << 6) |
+		(unit->IsUnderWater()<< 7) |
+		(unit->allyteam      << 8);
+
+	return key;
+}
+
+bool CUnitHandler::LosSquaresChangedSince(const LosStatusKey& key, int frame)
+{
+	const ILosType& losType = (key.flags & 1)? losHandler->airLos: losHandler->los;
+
+	if (losType.SquareChangedSince(key.losSquares[0], frame))
+		return true;
+	if (losType.SquareChangedSince(key.losSquares[1], frame))
+		return true;
+
+	// radar, sonar and (sonar-)jammer maps all share the radar resolution
+	if (losHandler->radar.SquareChangedSince(key.radarSquare, frame))
+		return true;
+	if (losHandler->sonar.SquareChangedSince(key.radarSquare, frame))
+		return true;
+	if (losHandler->jammer.SquareChangedSince(key.radarSquare, frame))
+		return true;
+
+	return (losHandler->sonarJammer.SquareChangedSince(key.radarSquare, frame));
+}
+
 void CUnitHandler::UpdateUnitLosStates()
 {
 	SCOPED_TIMER("Sim::Unit::UpdateLosStatus");
 
+	// the status of a (unit, allyteam) pair can only change if any of the
+	// unit's own inputs (see LosStatusKey) or the coverage of the squares
+	// it samples changed since the previous update, or the allyteam had
+	// its globalLOS toggled; everything else keeps its status and skips
+	// the re-evaluation (events still fire in unit- and allyteam-order)
+	changedGlobalLOS.clear();
+
+	for (int at = 0; at < teamHandler->ActiveAllyTeams(); ++at) {
+		if (prevGlobalLOS[at] == losHandler->globalLOS[at])
+			continue;
+
+		prevGlobalLOS[at] = losHandler->globalLOS[at];
+		changedGlobalLOS.push_back(at);
+	}
+
 	for (CUnit* unit: activeUnits) {
-		for (int at = 0; at < teamHandler->ActiveAllyTeams(); ++at) {
+		const LosStatusKey key = GetLosStatusKey(unit);
+
+		if (key != unitLosKeys[unit->id] || LosSquaresChangedSince(key, lastLosStatusFrame)) {
+			unitLosKeys[unit->id] = key;
+
+			for (int at = 0; at < teamHandler->ActiveAllyTeams(); ++at) {
+				unit->UpdateLosStatus(at);
+			}
+
+			continue;
+		}
+
+		for (const int at: changedGlobalLOS) {
 			unit->UpdateLosStatus(at);
 		}
 	}
+
+	lastLosStatusFrame = gs->frameNum;
 }
 
 
@@ -49,6 +49,9 @@ public:
 	void AddBuilderCAI(CBuilderCAI*);
 	void RemoveBuilderCAI(CBuilderCAI*);
 
+	/// forces a full LOS status re-evaluation of <unit> on the next update
+	void InvalidateUnitLosStatus(const CUnit* unit);
+
 	// note: negative ID's are implicitly converted
 	CUnit* GetUnitUnsafe(unsigned int id) const { return units[id]; }
 	CUnit* GetUnit(unsigned int id) const { return ((id < MaxUnits())? units[id]: nullptr); }
@@ -79,6 +82,23 @@ private:
 	void UpdateUnits();
 	void UpdateUnitWeapons();
 
+private:
+	// inputs to CUnit::CalcLosStatus other than the LOS-maps themselves
+	struct LosStatusKey {
+		bool operator == (const LosStatusKey& k) const {
+			return (losSquares[0] == k.losSquares[0] && losSquares[1] == k.losSquares[1] && radarSquare == k.radarSquare && flags == k.flags);
+		}
+		bool operator != (const LosStatusKey& k) const { return !(*this == k); }
+
+		int losSquares[2] = {-1, -1}; ///< (air-)LOS squares at pos and pos + speed
+		int radarSquare = -1;         ///< shared by radar, sonar and both jammer maps
+
+		unsigned int flags = -1u;     ///< cloak, stealth, water state, ..., allyteam
+	};
+
+	static LosStatusKey GetLosStatusKey(const CUnit* unit);
+	static bool LosSquaresChangedSince(const LosStatusKey& key, int frame);
+
 private:
 	SimObjectIDPool idPool;
 
@@ -90,6 +110,12 @@ private:
 
 	spring::unordered_map<unsigned int, CBuilderCAI*> builderCAIs;
 
+	std::vector<LosStatusKey> unitLosKeys; ///< indexed by unit ID, key of the last LOS status update
+	std::vector<bool> prevGlobalLOS;       ///< per allyteam, globalLOS at the last LOS status update
+	std::vector<int> changedGlobalLOS;
+
+	int lastLosStatusFrame = -1;
+
 
 	size_t activeSlowUpdateUnit;  ///< first unit of batch that will be SlowUpdate'd this frame
 	size_t activeUpdateUnit;  ///< first unit of batch that will be SlowUpdate'd this frame
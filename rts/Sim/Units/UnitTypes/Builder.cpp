@@ -431,8 +431,11 @@ bool CBuilder::UpdateResurrect(const Command& fCommand)
 		// TODO: make configurable if this should happen
 		resurrectee->health *= 0.05f;
 
-		for (const int resurrecterID: cai->resurrecters) {
-			CBuilder* resurrecter = static_cast<CBuilder*>(unitHandler->GetUnit(resurrecterID));
+		// check every registered resurrecter rather than only those registered for
+		// this feature, a builder whose queue has moved on to it may not have
+		// re-registered yet
+		for (const auto& p: cai->resurrecters.GetBuilderTargets()) {
+			CBuilder* resurrecter = static_cast<CBuilder*>(unitHandler->GetUnit(p.first));
 			CCommandAI* resurrecterCAI = resurrecter->commandAI;
 
 			if (resurrecterCAI->commandQue.empty())
@@ -88,10 +88,12 @@ bool CFileHandler::TryReadFromRawFS(const string& fileName)
 bool CFileHandler::TryReadFromVFS(const string& fileName, int section)
 {
 #ifndef TOOLS
-	if (vfsHandler == nullptr)
+	CVFSHandler* vfs = GetVFSHandler();
+
+	if (vfs == nullptr)
 		return false;
 
-	if (vfsHandler->LoadFile(StringToLower(fileName), fileBuffer, (CVFSHandler::Section) section)) {
+	if (vfs->LoadFile(StringToLower(fileName), fileBuffer, (CVFSHandler::Section) section)) {
 		// capacity can exceed size if FH was used to open more than one file
 		// assert(fileBuffer.size() == fileBuffer.capacity());
 
@@ -139,7 +141,7 @@ bool CFileHandler::FileExists(const std::string& filePath, const std::string& mo
 	for (char c: modes) {
 #ifndef TOOLS
 		CVFSHandler::Section section = CVFSHandler::GetModeSection(c);
-		if ((section != CVFSHandler::Section::Error) && vfsHandler->FileExists(filePath, section))
+		if ((section != CVFSHandler::Section::Error) && GetVFSHandler()->FileExists(filePath, section))
 			return true;
 
 		if ((c == SPRING_VFS_RAW[0]) && FileSystem::FileExists(dataDirsAccess.LocateFile(filePath)))
@@ -322,7 +324,9 @@ bool CFileHandler::InsertVFSFiles(std::set<string>& fileSet,
 		const string& path, const string& pattern, int section)
 {
 #ifndef TOOLS
-	if (!vfsHandler) {
+	CVFSHandler* vfs = GetVFSHandler();
+
+	if (vfs == nullptr) {
 		return false;
 	}
 
@@ -334,7 +338,7 @@ bool CFileHandler::InsertVFSFiles(std::set<string>& fileSet,
 	spring::regex regexpattern(FileSystem::ConvertGlobToRegex(pattern),
 			spring::regex::icase);
 
-	const std::vector<string> &found = vfsHandler->GetFilesInDir(path, (CVFSHandler::Section) section);
+	const std::vector<string> &found = vfs->GetFilesInDir(path, (CVFSHandler::Section) section);
 	std::vector<string>::const_iterator fi;
 	for (fi = found.begin(); fi != found.end(); ++fi) {
 		if (spring::regex_match(*fi, regexpattern)) {
@@ -398,7 +402,9 @@ bool CFileHandler::InsertVFSDirs(std::set<string>& dirSet,
 		const string& path, const string& pattern, int section)
 {
 #ifndef TOOLS
-	if (!vfsHandler) {
+	CVFSHandler* vfs = GetVFSHandler();
+
+	if (vfs == nullptr) {
 		return false;
 	}
 
@@ -410,7 +416,7 @@ bool CFileHandler::InsertVFSDirs(std::set<string>& dirSet,
 	spring::regex regexpattern(FileSystem::ConvertGlobToRegex(pattern),
 			spring::regex::icase);
 
-	const std::vector<string> &found = vfsHandler->GetDirsInDir(path, (CVFSHandler::Section) section);
+	const std::vector<string> &found = vfs->GetDirsInDir(path, (CVFSHandler::Section) section);
 	std::vector<string>::const_iterator fi;
 	for (fi = found.begin(); fi != found.end(); ++fi) {
 		if (spring::regex_match(*fi, regexpattern)) {
@@ -27,6 +27,7 @@ LOG_REGISTER_SECTION_GLOBAL(LOG_SECTION_VFS)
 
 
 CVFSHandler* vfsHandler = nullptr;
+_threadlocal CVFSHandler* threadVFSHandler = nullptr;
 
 
 CVFSHandler::CVFSHandler()
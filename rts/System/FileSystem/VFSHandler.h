@@ -9,6 +9,8 @@
 #include <vector>
 #include <cinttypes>
 
+#include "System/MainDefines.h"
+
 class IArchive;
 
 /**
@@ -104,4 +106,15 @@ private:
 
 extern CVFSHandler* vfsHandler;
 
+/**
+ * Per-thread override of vfsHandler, used by CFileHandler if set.
+ * Lets worker threads read through a private VFS (for example a single
+ * map archive) without swapping out the global one under other threads.
+ */
+extern _threadlocal CVFSHandler* threadVFSHandler;
+
+static inline CVFSHandler* GetVFSHandler() {
+	return ((threadVFSHandler != nullptr)? threadVFSHandler: vfsHandler);
+}
+
 #endif // _VFS_HANDLER_H
@@ -15,6 +15,7 @@ CONFIG(bool, DisableDemoVersionCheck).defaultValue(false).description("Allow to
 
 #include <limits.h>
 #include <stdexcept>
+#include <string>
 #include <cassert>
 #include <cstring>
 
@@ -29,25 +30,33 @@ CDemoReader::CDemoReader(const std::string& filename, float curTime): playbackDe
 	playbackDemo->Read((char*)&fileHeader, sizeof(fileHeader));
 	fileHeader.swab();
 
+	// version 5 only differs by lacking compact team statistics
+	const bool isCurVersion = (fileHeader.version == DEMOFILE_VERSION);
+	const bool isOldVersion = (fileHeader.version == 5 && fileHeader.teamStatElemSize != DEMOFILE_COMPACT_TEAMSTATS);
+
+	// a different file format can not be parsed at all, whatever the version check settings
 	if (memcmp(fileHeader.magic, DEMOFILE_MAGIC, sizeof(fileHeader.magic))
-		|| fileHeader.version != DEMOFILE_VERSION
+		|| (!isCurVersion && !isOldVersion)
 		|| fileHeader.headerSize != sizeof(fileHeader)
 		|| fileHeader.playerStatElemSize != sizeof(PlayerStatistics)
-		|| fileHeader.teamStatElemSize != sizeof(TeamStatistics)
-		// Don't compare spring version in debug mode: we don't want to make
-		// debugging dev-version demos impossible (because the version is different
-		// each build.)
-#ifndef _DEBUG
-		|| (SpringVersion::IsRelease() && strcmp(fileHeader.versionString, SpringVersion::GetSync().c_str()))
-#endif
+		|| (fileHeader.teamStatElemSize != sizeof(TeamStatistics) && fileHeader.teamStatElemSize != DEMOFILE_COMPACT_TEAMSTATS)
 		) {
-			const std::string demoMsg = std::string("Demofile ") + filename + " corrupt or created by a different version of Spring, expects version " + fileHeader.versionString + ".";
+		throw std::runtime_error(std::string("Demofile ") + filename + " corrupt or of an unsupported format version (" + std::to_string(fileHeader.version) + ", expected " + std::to_string(DEMOFILE_VERSION) + ").");
+	}
+
+	// Don't compare spring version in debug mode: we don't want to make
+	// debugging dev-version demos impossible (because the version is different
+	// each build.)
+#ifndef _DEBUG
+	if (SpringVersion::IsRelease() && strcmp(fileHeader.versionString, SpringVersion::GetSync().c_str())) {
+		const std::string demoMsg = std::string("Demofile ") + filename + " created by a different version of Spring, expects version " + fileHeader.versionString + ".";
 #ifndef TOOLS
-			if (!configHandler->GetBool("DisableDemoVersionCheck"))
-				throw std::runtime_error(demoMsg);
+		if (!configHandler->GetBool("DisableDemoVersionCheck"))
+			throw std::runtime_error(demoMsg);
 #endif
-			LOG_L(L_WARNING, "%s", demoMsg.c_str());
+		LOG_L(L_WARNING, "%s", demoMsg.c_str());
 	}
+#endif
 
 	if (fileHeader.scriptSize != 0) {
 		std::vector<char> buf(fileHeader.scriptSize);
@@ -158,14 +167,40 @@ void CDemoReader::LoadStats()
 		teamStats.resize(fileHeader.numTeams);
 		// Read the array containing the number of team stats for each team.
 		std::vector<int> numStatsPerTeam(fileHeader.numTeams, 0);
-		playbackDemo->Read((char*) (&numStatsPerTeam[0]), numStatsPerTeam.size());
-
-		for (int teamNum = 0; teamNum < fileHeader.numTeams; ++teamNum) {
-			for (int i = 0; i < numStatsPerTeam[teamNum]; ++i) {
-				TeamStatistics buf;
-				playbackDemo->Read(reinterpret_cast<char*>(&buf), sizeof(TeamStatistics));
-				buf.swab();
-				teamStats[teamNum].push_back(buf);
+		if (!numStatsPerTeam.empty())
+			playbackDemo->Read((char*) (&numStatsPerTeam[0]), numStatsPerTeam.size() * sizeof(int));
+
+		for (int& numStats: numStatsPerTeam)
+			swabDWordInPlace(numStats);
+
+		if (fileHeader.teamStatElemSize == DEMOFILE_COMPACT_TEAMSTATS) {
+			// compact chunk: array of encoded sizes followed by the encoded histories
+			std::vector<int> encSizePerTeam(fileHeader.numTeams, 0);
+			std::vector<std::uint8_t> encBuffer;
+
+			if (!encSizePerTeam.empty())
+				playbackDemo->Read((char*) (&encSizePerTeam[0]), encSizePerTeam.size() * sizeof(int));
+
+			for (int teamNum = 0; teamNum < fileHeader.numTeams; ++teamNum) {
+				swabDWordInPlace(encSizePerTeam[teamNum]);
+
+				if (encSizePerTeam[teamNum] <= 0)
+					continue;
+
+				encBuffer.resize(encSizePerTeam[teamNum]);
+				playbackDemo->Read((char*) (&encBuffer[0]), encBuffer.size());
+
+				if (!TeamStatisticsHistory::Decode(&encBuffer[0], encBuffer.size(), numStatsPerTeam[teamNum], teamStats[teamNum]))
+					LOG_L(L_WARNING, "[DemoReader::%s] corrupt statistics for team %d", __func__, teamNum);
+			}
+		} else {
+			for (int teamNum = 0; teamNum < fileHeader.numTeams; ++teamNum) {
+				for (int i = 0; i < numStatsPerTeam[teamNum]; ++i) {
+					TeamStatistics buf;
+					playbackDemo->Read(reinterpret_cast<char*>(&buf), sizeof(TeamStatistics));
+					buf.swab();
+					teamStats[teamNum].push_back(buf);
+				}
 			}
 		}
 	}
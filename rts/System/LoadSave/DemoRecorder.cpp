@@ -65,7 +65,7 @@ void CDemoRecorder::SetFileHeader()
 	STRNCPY(fileHeader.versionString, (SpringVersion::GetSync()).c_str(), sizeof(fileHeader.versionString) - 1);
 	fileHeader.unixTime = CTimeUtil::GetCurrentTime();
 	fileHeader.playerStatElemSize = sizeof(PlayerStatistics);
-	fileHeader.teamStatElemSize = sizeof(TeamStatistics);
+	fileHeader.teamStatElemSize = DEMOFILE_COMPACT_TEAMSTATS;
 	fileHeader.teamStatPeriod = TeamStatistics::statsPeriod;
 	fileHeader.winningAllyTeamsSize = 0;
 
@@ -172,6 +172,7 @@ void CDemoRecorder::InitializeStats(int numPlayers, int numTeams)
 	// must be here so WriteWinnerList works
 	fileHeader.numTeams = numTeams;
 	teamStats.resize(numTeams);
+	numTeamStats.resize(numTeams, 0);
 }
 
 
@@ -193,15 +194,12 @@ void CDemoRecorder::SetPlayerStats(int playerNum, const PlayerStatistics& stats)
 }
 
 /** @brief Set (overwrite) the TeamStatistics history for team teamNum */
-void CDemoRecorder::SetTeamStats(int teamNum, const std::vector<TeamStatistics>& stats)
+void CDemoRecorder::SetTeamStats(int teamNum, const TeamStatisticsHistory& stats)
 {
 	assert((unsigned)teamNum < teamStats.size()); //FIXME
 
-	teamStats[teamNum].clear();
-	teamStats[teamNum].reserve(stats.size());
-
-	for (auto it = stats.cbegin(); it != stats.cend(); ++it)
-		teamStats[teamNum].push_back(*it);
+	stats.GetEncoded(teamStats[teamNum]);
+	numTeamStats[teamNum] = stats.size();
 }
 
 
@@ -286,20 +284,27 @@ void CDemoRecorder::WriteTeamStats()
 	int pos = demoStreams[isServerDemo]->tellp();
 
 	// Write array of dwords indicating number of TeamStatistics per team.
-	for (std::vector<TeamStatistics>& history: teamStats) {
+	for (unsigned int numStats: numTeamStats) {
+		unsigned int c = swabDWord(numStats);
+		demoStreams[isServerDemo]->write((char*)&c, sizeof(unsigned int));
+	}
+
+	// Write array of dwords indicating the encoded size per team.
+	for (const std::vector<std::uint8_t>& history: teamStats) {
 		unsigned int c = swabDWord(history.size());
 		demoStreams[isServerDemo]->write((char*)&c, sizeof(unsigned int));
 	}
 
-	// Write big array of TeamStatistics.
-	for (std::vector<TeamStatistics>& history: teamStats) {
-		for (TeamStatistics& stats: history) {
-			stats.swab();
-			demoStreams[isServerDemo]->write(reinterpret_cast<char*>(&stats), sizeof(TeamStatistics));
-		}
+	// Write the encoded histories; these are byte-streams and need no swabbing.
+	for (const std::vector<std::uint8_t>& history: teamStats) {
+		if (history.empty())
+			continue;
+
+		demoStreams[isServerDemo]->write(reinterpret_cast<const char*>(&history[0]), history.size());
 	}
 
 	fileHeader.teamStatSize = (int)demoStreams[isServerDemo]->tellp() - pos;
 
 	teamStats.clear();
+	numTeamStats.clear();
 }
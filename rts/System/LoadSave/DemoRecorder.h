@@ -34,7 +34,7 @@ public:
 	void AddNewPlayer(const std::string& name, int playerNum);
 	void InitializeStats(int numPlayers, int numTeams);
 	void SetPlayerStats(int playerNum, const PlayerStatistics& stats);
-	void SetTeamStats(int teamNum, const std::vector<TeamStatistics>& stats);
+	void SetTeamStats(int teamNum, const TeamStatisticsHistory& stats);
 	void SetWinningAllyTeams(const std::vector<unsigned char>& winningAllyTeams);
 
 private:
@@ -49,7 +49,8 @@ private:
 	gzFile file;
 
 	std::vector<PlayerStatistics> playerStats;
-	std::vector< std::vector<TeamStatistics> > teamStats;
+	std::vector< std::vector<std::uint8_t> > teamStats; // encoded history per team
+	std::vector<unsigned int> numTeamStats;
 	std::vector<unsigned char> winningAllyTeams;
 
 	bool isServerDemo;
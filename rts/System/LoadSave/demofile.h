@@ -21,7 +21,13 @@
  * The current demofile version. Only change on major modifications for which
  * appending stuff to DemoFileHeader is not sufficient.
  */
-#define DEMOFILE_VERSION 5
+#define DEMOFILE_VERSION 6
+
+/**
+ * Value of DemoFileHeader::teamStatElemSize marking a team statistics chunk
+ * in compact (TeamStatisticsHistory) encoding, introduced with version 6.
+ */
+#define DEMOFILE_COMPACT_TEAMSTATS 0
 
 #pragma pack(push, 1)
 
@@ -40,6 +46,13 @@
  *         CTeam::Statistics for each team.
  *       - Array of all CTeam::Statistics (total number of items is the
  *         sum of the elements in the array of dwords).
+ *       or, if teamStatElemSize equals DEMOFILE_COMPACT_TEAMSTATS:
+ *       - Array of numTeams dwords indicating the number of
+ *         CTeam::Statistics for each team.
+ *       - Array of numTeams dwords indicating the encoded size of each
+ *         team's statistics in bytes.
+ *       - The encoded statistics of each team, in the format written by
+ *         TeamStatisticsHistory::GetEncoded.
  *
  * The header is designed to be extensible: it contains a version field and a
  * headerSize field to support this. The version field is a major version number
@@ -67,7 +80,7 @@ struct DemoFileHeader
 	int playerStatElemSize;       ///< sizeof(CPlayer::Statistics)
 	int numTeams;                 ///< Number of teams for which stats are saved.
 	int teamStatSize;             ///< Size of the entire team statistics chunk.
-	int teamStatElemSize;         ///< sizeof(CTeam::Statistics)
+	int teamStatElemSize;         ///< sizeof(CTeam::Statistics), or DEMOFILE_COMPACT_TEAMSTATS
 	int teamStatPeriod;           ///< Interval (in seconds) between team stats.
 	int winningAllyTeamsSize;     ///< The size of the vector of the winning ally teams
 
@@ -1,12 +1,20 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdarg>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <thread>
 
 #include "Backend.h"
 #include "DefaultFilter.h"
+#include "FramePrefixer.h"
 #include "LogUtil.h"
 #include "System/MainDefines.h"
 
@@ -17,10 +25,335 @@ namespace {
 		return sinks;
 	}
 
+	std::set<log_sink_ptr>& log_formatter_getAsyncSinks() {
+		static std::set<log_sink_ptr> sinks;
+		return sinks;
+	}
+
 	std::set<log_cleanup_ptr>& log_formatter_getCleanupFuncs() {
 		static std::set<log_cleanup_ptr> cleanupFuncs;
 		return cleanupFuncs;
 	}
+
+
+	void log_formatter_sinkAsync(int level, const char* section, const char* msg) {
+		for (log_sink_ptr fptr: log_formatter_getAsyncSinks()) {
+			fptr(level, section, msg);
+		}
+	}
+
+
+	/**
+	 * Bounded multi-producer ring buffer (after D. Vyukov) feeding a single
+	 * writer thread. Every slot carries a sequence number telling producers
+	 * and the consumer whose turn it is, so pushing a record costs one CAS
+	 * plus a copy of its text.
+	 */
+	class AsyncLogWriter {
+	public:
+		static constexpr size_t NUM_RECORDS = 2048; // must be a power of two
+		static constexpr size_t MAX_INLINE_MSG_SIZE = 480;
+
+		AsyncLogWriter(): records(new Record[NUM_RECORDS]) {
+			for (size_t i = 0; i < NUM_RECORDS; i++) {
+				records[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+		~AsyncLogWriter();
+
+		void Start();
+		void Stop();
+		void Flush();
+
+		bool IsRunning() const { return running.load(std::memory_order_acquire); }
+
+		/// returns false if the record has to be sunk synchronously
+		bool Push(int level, const char* section, const char* msg);
+		/// sinks a record synchronously, after all records still queued
+		void SinkOrdered(int level, const char* section, const char* msg);
+
+		void GetStats(log_async_stats_t* stats) const;
+
+	private:
+		struct Record {
+			std::atomic<size_t> sequence;
+
+			const char* section;
+			char* oversizedMsg;
+
+			int level;
+			int frameNum;
+			bool haveFrameNum;
+
+			char msg[MAX_INLINE_MSG_SIZE];
+		};
+
+		/// passes all currently queued records on to the sinks; consumer lock must be held
+		size_t Drain();
+
+		bool TryLockConsumer() { return !consumerLock.test_and_set(std::memory_order_acquire); }
+		void UnlockConsumer() { consumerLock.clear(std::memory_order_release); }
+
+		void WriterThreadFunc();
+
+	private:
+		std::unique_ptr<Record[]> records;
+
+		std::atomic<size_t> pushPos = {0};
+		std::atomic<size_t> popPos = {0};
+
+		std::atomic_flag consumerLock = ATOMIC_FLAG_INIT;
+		/// set if the consumer lock could not be taken within the wait bound
+		std::atomic<bool> consumerStuck = {false};
+
+		std::atomic<bool> running = {false};
+		std::atomic<bool> writerActive = {false};
+
+		std::thread writerThread;
+		std::atomic<std::thread::id> writerThreadID{std::thread::id()};
+		std::mutex wakeMutex;
+		std::condition_variable wakeCond;
+
+		std::atomic<unsigned long long> numQueued = {0};
+		std::atomic<unsigned long long> numWritten = {0};
+		std::atomic<unsigned long long> numStalls = {0};
+		std::atomic<unsigned long long> numOversized = {0};
+		std::atomic<unsigned int> maxQueueDepth = {0};
+	};
+
+
+	void AsyncLogWriter::Start() {
+		if (IsRunning())
+			return;
+
+		// a previous writer might not have acknowledged its stop request
+		if (writerThread.joinable())
+			writerThread.detach();
+
+		running.store(true, std::memory_order_release);
+		writerActive.store(true, std::memory_order_release);
+		writerThread = std::thread(&AsyncLogWriter::WriterThreadFunc, this);
+	}
+
+	void AsyncLogWriter::Stop() {
+		if (!IsRunning())
+			return;
+
+		running.store(false, std::memory_order_release);
+		wakeCond.notify_one();
+
+		Flush();
+
+		if (!writerThread.joinable())
+			return;
+
+		// do not wait on a writer that crashed or hangs in a sink; the
+		// process is most likely going down in that case
+		for (int n = 0; n < 1000 && writerActive.load(std::memory_order_acquire); n++) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		if (writerActive.load(std::memory_order_acquire) || writerThread.get_id() == std::this_thread::get_id()) {
+			writerThread.detach();
+		} else {
+			writerThread.join();
+		}
+	}
+
+	void AsyncLogWriter::Flush() {
+		// the writer already holds the consumer lock if a sink flushes
+		if (std::this_thread::get_id() == writerThreadID.load(std::memory_order_relaxed))
+			return;
+
+		// wait (bounded) for the writer to finish its current batch
+		for (int n = 0; !TryLockConsumer(); n++) {
+			if (n >= 2000)
+				return;
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		Drain();
+		UnlockConsumer();
+	}
+
+
+	bool AsyncLogWriter::Push(int level, const char* section, const char* msg) {
+		if (!IsRunning())
+			return false;
+		// sinks logging by themselves would deadlock on a full buffer
+		if (std::this_thread::get_id() == writerThreadID.load(std::memory_order_relaxed))
+			return false;
+
+		size_t pos = pushPos.load(std::memory_order_relaxed);
+		bool claimed = false;
+		bool stalled = false;
+
+		while (!claimed) {
+			const size_t seq = records[pos & (NUM_RECORDS - 1)].sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t dif = std::ptrdiff_t(seq) - std::ptrdiff_t(pos);
+
+			if (dif == 0) {
+				claimed = pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed);
+				continue;
+			}
+
+			if (dif > 0) {
+				// another producer claimed this slot first
+				pos = pushPos.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			// buffer is full; apply backpressure to the logging thread
+			if (!IsRunning())
+				return false;
+
+			if (!stalled)
+				numStalls.fetch_add(1, std::memory_order_relaxed);
+
+			stalled = true;
+			wakeCond.notify_one();
+			std::this_thread::yield();
+
+			pos = pushPos.load(std::memory_order_relaxed);
+		}
+
+		const int* frameNumRef = log_framePrefixer_getFrameNumReference();
+		const size_t msgSize = strlen(msg) + 1;
+
+		Record& rec = records[pos & (NUM_RECORDS - 1)];
+		rec.section = section;
+		rec.level = level;
+		rec.haveFrameNum = (frameNumRef != nullptr);
+		rec.frameNum = (frameNumRef != nullptr)? *frameNumRef: 0;
+		rec.oversizedMsg = nullptr;
+
+		if (msgSize > MAX_INLINE_MSG_SIZE) {
+			rec.oversizedMsg = new char[msgSize];
+			memcpy(rec.oversizedMsg, msg, msgSize);
+			numOversized.fetch_add(1, std::memory_order_relaxed);
+		} else {
+			memcpy(rec.msg, msg, msgSize);
+		}
+
+		rec.sequence.store(pos + 1, std::memory_order_release);
+
+		// the writer may already have consumed this and later records
+		const std::ptrdiff_t depth = std::max(std::ptrdiff_t(pos + 1) - std::ptrdiff_t(popPos.load(std::memory_order_relaxed)), std::ptrdiff_t(0));
+		unsigned int maxDepth = maxQueueDepth.load(std::memory_order_relaxed);
+
+		while (depth > maxDepth && !maxQueueDepth.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed));
+
+		numQueued.fetch_add(1, std::memory_order_relaxed);
+
+		// the writer polls regularly, only wake it early when space gets scarce
+		if (depth >= std::ptrdiff_t(NUM_RECORDS / 2))
+			wakeCond.notify_one();
+
+		return true;
+	}
+
+	void AsyncLogWriter::SinkOrdered(int level, const char* section, const char* msg) {
+		// sinks logging by themselves from the writer already hold the consumer lock
+		if (std::this_thread::get_id() == writerThreadID.load(std::memory_order_relaxed)) {
+			log_formatter_sinkAsync(level, section, msg);
+			return;
+		}
+
+		// serialize with a concurrent drain (by the writer or Flush), but
+		// do not stall every record on a writer that hangs in a sink
+		const int maxWaitIters = consumerStuck.load(std::memory_order_relaxed)? 0: 2000;
+		bool locked = false;
+
+		for (int n = 0; !(locked = TryLockConsumer()) && n < maxWaitIters; n++) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		consumerStuck.store(!locked, std::memory_order_relaxed);
+
+		if (locked)
+			Drain();
+
+		log_formatter_sinkAsync(level, section, msg);
+
+		if (locked)
+			UnlockConsumer();
+	}
+
+	size_t AsyncLogWriter::Drain() {
+		size_t numDrained = 0;
+
+		for (size_t pos = popPos.load(std::memory_order_relaxed); ; pos++) {
+			Record& rec = records[pos & (NUM_RECORDS - 1)];
+
+			if (rec.sequence.load(std::memory_order_acquire) != (pos + 1))
+				break;
+
+			log_framePrefixer_setThreadFrameNumReference(rec.haveFrameNum? &rec.frameNum: nullptr);
+			log_formatter_sinkAsync(rec.level, rec.section, (rec.oversizedMsg != nullptr)? rec.oversizedMsg: rec.msg);
+
+			delete[] rec.oversizedMsg;
+			rec.oversizedMsg = nullptr;
+
+			popPos.store(pos + 1, std::memory_order_relaxed);
+			rec.sequence.store(pos + NUM_RECORDS, std::memory_order_release);
+
+			numDrained++;
+		}
+
+		log_framePrefixer_setThreadFrameNumReference(nullptr);
+		numWritten.fetch_add(numDrained, std::memory_order_relaxed);
+		return numDrained;
+	}
+
+	void AsyncLogWriter::WriterThreadFunc() {
+		writerThreadID.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+		while (IsRunning()) {
+			size_t numDrained = 0;
+
+			if (TryLockConsumer()) {
+				numDrained = Drain();
+				UnlockConsumer();
+			}
+
+			if (numDrained > 0)
+				continue;
+
+			std::unique_lock<std::mutex> lock(wakeMutex);
+			wakeCond.wait_for(lock, std::chrono::milliseconds(5));
+		}
+
+		writerThreadID.store(std::thread::id(), std::memory_order_relaxed);
+		writerActive.store(false, std::memory_order_release);
+	}
+
+	void AsyncLogWriter::GetStats(log_async_stats_t* stats) const {
+		stats->numQueued = numQueued.load(std::memory_order_relaxed);
+		stats->numWritten = numWritten.load(std::memory_order_relaxed);
+		stats->numStalls = numStalls.load(std::memory_order_relaxed);
+		stats->numOversized = numOversized.load(std::memory_order_relaxed);
+		stats->maxQueueDepth = maxQueueDepth.load(std::memory_order_relaxed);
+		stats->queueSize = NUM_RECORDS;
+	}
+
+
+	// non-null while asynchronous logging is enabled
+	std::atomic<AsyncLogWriter*> asyncLogWriter = {nullptr};
+	std::atomic<bool> asyncLogWriterCreated = {false};
+
+	AsyncLogWriter& log_formatter_getAsyncLogWriter() {
+		// constructed lazily, after the (function-static) sink sets
+		static AsyncLogWriter writer;
+		asyncLogWriterCreated.store(true);
+		return writer;
+	}
+
+	AsyncLogWriter::~AsyncLogWriter() {
+		asyncLogWriter.store(nullptr);
+		asyncLogWriterCreated.store(false);
+		Stop();
+	}
 }
 
 
@@ -39,10 +372,52 @@ extern void log_formatter_format(log_record_t* log, va_list arguments);
 void log_backend_registerSink(log_sink_ptr sink) { log_formatter_getSinks().insert(sink); }
 void log_backend_unregisterSink(log_sink_ptr sink) { log_formatter_getSinks().erase(sink); }
 
+void log_backend_registerAsyncSink(log_sink_ptr sink) { log_formatter_getAsyncSinks().insert(sink); }
+void log_backend_unregisterAsyncSink(log_sink_ptr sink) { log_formatter_getAsyncSinks().erase(sink); }
+
 void log_backend_registerCleanup(log_cleanup_ptr cleanupFunc) { log_formatter_getCleanupFuncs().insert(cleanupFunc); }
 void log_backend_unregisterCleanup(log_cleanup_ptr cleanupFunc) { log_formatter_getCleanupFuncs().erase(cleanupFunc); }
 
 
+void log_backend_setAsync(bool enable)
+{
+	if (enable) {
+		AsyncLogWriter& writer = log_formatter_getAsyncLogWriter();
+
+		writer.Start();
+		asyncLogWriter.store(&writer);
+		return;
+	}
+
+	AsyncLogWriter* writer = asyncLogWriter.exchange(nullptr);
+
+	// new records are sunk synchronously from here on
+	if (writer != nullptr)
+		writer->Stop();
+}
+
+bool log_backend_isAsync() { return (asyncLogWriter.load() != nullptr); }
+
+void log_backend_flushAsync()
+{
+	// also catches records pushed while asynchronous logging was being disabled
+	if (!asyncLogWriterCreated.load())
+		return;
+
+	log_formatter_getAsyncLogWriter().Flush();
+}
+
+void log_backend_getAsyncStats(log_async_stats_t* stats)
+{
+	memset(stats, 0, sizeof(*stats));
+
+	if (!asyncLogWriterCreated.load())
+		return;
+
+	log_formatter_getAsyncLogWriter().GetStats(stats);
+}
+
+
 /**
  * @name logging_backend
  * ILog.h backend implementation.
@@ -53,8 +428,9 @@ void log_backend_unregisterCleanup(log_cleanup_ptr cleanupFunc) { log_formatter_
 void log_backend_record(int level, const char* section, const char* fmt, va_list arguments)
 {
 	const auto& sinks = log_formatter_getSinks();
+	const auto& asyncSinks = log_formatter_getAsyncSinks();
 
-	if (sinks.empty())
+	if (sinks.empty() && asyncSinks.empty())
 		return;
 
 	cur_record.sec = section;
@@ -80,6 +456,18 @@ void log_backend_record(int level, const char* section, const char* fmt, va_list
 		fptr(level, section, cur_record.msg);
 	}
 
+	// hand the record to the writer thread, or sink it here if that is not running
+	AsyncLogWriter* writer = asyncLogWriter.load(std::memory_order_acquire);
+
+	if (!asyncSinks.empty() && (writer == nullptr || !writer->Push(level, section, cur_record.msg))) {
+		// the writer might still be draining records pushed before it was stopped
+		if (asyncLogWriterCreated.load()) {
+			log_formatter_getAsyncLogWriter().SinkOrdered(level, section, cur_record.msg);
+		} else {
+			log_formatter_sinkAsync(level, section, cur_record.msg);
+		}
+	}
+
 	if (cur_record.cnt > 0)
 		return;
 
@@ -88,6 +476,8 @@ void log_backend_record(int level, const char* section, const char* fmt, va_list
 
 /// Passes on a cleanup request to all sinks
 void log_backend_cleanup() {
+	log_backend_flushAsync();
+
 	for (log_cleanup_ptr fptr: log_formatter_getCleanupFuncs()) {
 		fptr();
 	}
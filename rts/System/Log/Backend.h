@@ -27,11 +27,53 @@ void log_backend_registerSink(log_sink_ptr sink);
 void log_backend_unregisterSink(log_sink_ptr sink);
 
 
+/**
+ * Start routing log records to the supplied sink.
+ * While asynchronous logging is enabled, the sink gets called from the log
+ * writer thread, so only sinks which merely do I/O (and touch no engine
+ * state) may be registered this way. Register them before enabling it.
+ */
+void log_backend_registerAsyncSink(log_sink_ptr sink);
+
+/// Stop routing log records to the supplied asynchronous sink
+void log_backend_unregisterAsyncSink(log_sink_ptr sink);
+
+
+/**
+ * Enables or disables asynchronous logging.
+ * While enabled, records for sinks registered with
+ * log_backend_registerAsyncSink are copied into a lock-free ring buffer by
+ * the logging thread and written in batches by a background thread.
+ * Disabling drains the ring buffer on the calling thread, so it is safe to
+ * call from a crash handler.
+ */
+void log_backend_setAsync(bool enable);
+
+bool log_backend_isAsync();
+
+/**
+ * Blocks until every queued record has been passed to the asynchronous sinks.
+ */
+void log_backend_flushAsync();
+
+struct log_async_stats_t {
+	unsigned long long numQueued;    ///< records pushed into the ring buffer
+	unsigned long long numWritten;   ///< records passed on to the sinks by the writer
+	unsigned long long numStalls;    ///< pushes which had to wait for a free slot
+	unsigned long long numOversized; ///< records too long for a slot, stored on the heap
+	unsigned int maxQueueDepth;      ///< highest number of records waiting at once
+	unsigned int queueSize;          ///< number of slots in the ring buffer
+};
+
+void log_backend_getAsyncStats(log_async_stats_t* stats);
+
+
 typedef void (*log_cleanup_ptr)();
 
 /**
  * Registers a cleanup function, which will be called in certain exceptional
  * situations only, for example during the graceful handling of a crash.
+ * Queued asynchronous records are written before cleanup functions run.
  */
 void log_backend_registerCleanup(log_cleanup_ptr cleanupFunc);
 
@@ -164,6 +164,25 @@ namespace {
 	{
 		log_file_getRecordBuffer().push_back(LogRecord(level, section, record));
 	}
+
+
+	/**
+	 * The asynchronous log writer iterates over the log files, so it is
+	 * paused while they get added or removed.
+	 */
+	struct ScopedAsyncLogPause {
+		ScopedAsyncLogPause(): wasAsync(log_backend_isAsync()) {
+			if (wasAsync)
+				log_backend_setAsync(false);
+		}
+		~ScopedAsyncLogPause() {
+			if (wasAsync)
+				log_backend_setAsync(true);
+		}
+
+	private:
+		bool wasAsync;
+	};
 }
 
 
@@ -179,6 +198,8 @@ void log_file_addLogFile(
 ) {
 	assert(filePath != nullptr);
 
+	const ScopedAsyncLogPause asyncLogPause;
+
 	logFiles_t& logFiles = log_file_getLogFiles();
 
 	const std::string sectionsStr = (sections == nullptr) ? "" : sections;
@@ -219,6 +240,8 @@ FILE* log_file_getLogFileStream(const char* filePath) {
 void log_file_removeLogFile(const char* filePath) {
 	assert(filePath != nullptr);
 
+	const ScopedAsyncLogPause asyncLogPause;
+
 	logFiles_t& logFiles = log_file_getLogFiles();
 
 	const std::string filePathStr = filePath;
@@ -279,11 +302,11 @@ namespace {
 	/// Auto-registers the sink defined in this file before main() is called
 	struct FileSinkRegistrator {
 		FileSinkRegistrator() {
-			log_backend_registerSink(&log_sink_record_file);
+			log_backend_registerAsyncSink(&log_sink_record_file);
 			log_backend_registerCleanup(&log_sink_cleanup_file);
 		}
 		~FileSinkRegistrator() {
-			log_backend_unregisterSink(&log_sink_record_file);
+			log_backend_unregisterAsyncSink(&log_sink_record_file);
 			log_backend_unregisterCleanup(&log_sink_cleanup_file);
 		}
 	} fileSinkRegistrator;
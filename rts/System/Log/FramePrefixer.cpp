@@ -16,15 +16,28 @@ extern "C" {
 
 // GlobalSynced makes sure this can not be dangling
 static int* frameNumRef = NULL;
+static _threadlocal const int* threadFrameNumRef = NULL;
 
 void log_framePrefixer_setFrameNumReference(int* frameNumReference)
 {
 	frameNumRef = frameNumReference;
 }
 
+const int* log_framePrefixer_getFrameNumReference()
+{
+	return frameNumRef;
+}
+
+void log_framePrefixer_setThreadFrameNumReference(const int* frameNumReference)
+{
+	threadFrameNumRef = frameNumReference;
+}
+
 size_t log_framePrefixer_createPrefix(char* result, size_t resultSize)
 {
-	if (frameNumRef == NULL) {
+	const int* curFrameNumRef = (threadFrameNumRef != NULL)? threadFrameNumRef: frameNumRef;
+
+	if (curFrameNumRef == NULL) {
 		if (resultSize > 0) {
 			result[0] = '\0';
 			return 1;
@@ -32,7 +45,7 @@ size_t log_framePrefixer_createPrefix(char* result, size_t resultSize)
 		return 0;
 	}
 
-	return (SNPRINTF(result, resultSize, "[f=%07d] ", *frameNumRef));
+	return (SNPRINTF(result, resultSize, "[f=%07d] ", *curFrameNumRef));
 }
 
 #ifdef __cplusplus
@@ -15,6 +15,19 @@ extern "C" {
  */
 void log_framePrefixer_setFrameNumReference(int* frameNumReference);
 
+/**
+ * Returns the injected frame number reference, or NULL if there is none.
+ */
+const int* log_framePrefixer_getFrameNumReference();
+
+/**
+ * Overrides the frame number reference for prefixes created by the calling
+ * thread only; NULL removes the override.
+ * Used by the asynchronous log writer, so records carry the frame number
+ * they were logged in rather than the one they were written in.
+ */
+void log_framePrefixer_setThreadFrameNumReference(const int* frameNumReference);
+
 /**
  * Fills a string containing the frame number, if it is available.
  * Else fils in the empty string.
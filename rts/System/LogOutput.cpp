@@ -6,6 +6,7 @@
 #include "Game/GameVersion.h"
 #include "System/Config/ConfigHandler.h"
 #include "System/FileSystem/FileSystem.h"
+#include "System/Log/Backend.h"
 #include "System/Log/DefaultFilter.h"
 #include "System/Log/FileSink.h"
 #include "System/Log/ILog.h"
@@ -43,6 +44,10 @@ CONFIG(int, LogRepeatLimit)
 	.defaultValue(10)
 	.description("Allow at most this many consecutive identical messages to be logged.");
 
+CONFIG(bool, LogAsync)
+	.defaultValue(false)
+	.description("Write the logfile and console output from a background thread, so slow disks do not stall the logging thread.");
+
 /******************************************************************************/
 /******************************************************************************/
 
@@ -212,6 +217,7 @@ CLogOutput::CLogOutput()
 
 CLogOutput::~CLogOutput()
 {
+	log_backend_setAsync(false);
 }
 
 void CLogOutput::SetFileName(std::string fname)
@@ -262,6 +268,7 @@ void CLogOutput::Initialize()
 
 	log_filter_setRepeatLimit(configHandler->GetInt("LogRepeatLimit")); // all sinks
 	log_file_addLogFile(filePath.c_str(), NULL, LOG_LEVEL_ALL, configHandler->GetInt("LogFlushLevel"));
+	log_backend_setAsync(configHandler->GetBool("LogAsync"));
 	InitializeLogSections();
 
 	LOG("LogOutput initialized.");
@@ -300,6 +307,17 @@ void CLogOutput::LogSystemInfo()
 	LOG("============== </User System> ==============");
 }
 
+void CLogOutput::LogAsyncInfo()
+{
+	log_async_stats_t stats;
+	log_backend_getAsyncStats(&stats);
+
+	LOG("[LogOutput] asynchronous logging %s", log_backend_isAsync()? "enabled": "disabled");
+	LOG("  records queued: %llu, written: %llu", stats.numQueued, stats.numWritten);
+	LOG("  stalled pushes: %llu, oversized records: %llu", stats.numStalls, stats.numOversized);
+	LOG("  max. queue depth: %u of %u", stats.maxQueueDepth, stats.queueSize);
+}
+
 void CLogOutput::LogExceptionInfo(const char* src, const char* msg)
 {
 	LOG_L(L_ERROR, "[%s] exception \"%s\"", src, msg);
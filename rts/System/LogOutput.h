@@ -58,6 +58,10 @@ public:
 	 */
 	static void LogSystemInfo();
 	static void LogConfigInfo();
+	/**
+	 * Log()s the backpressure counters of the asynchronous log writer
+	 */
+	static void LogAsyncInfo();
 	static void LogExceptionInfo(const char* src, const char* msg);
 
 private:
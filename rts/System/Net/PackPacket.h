@@ -40,27 +40,26 @@ public:
 
 	template <typename element>
 	PackPacket& operator<<(const std::vector<element>& vec) {
-		const size_t size = vec.size() * sizeof(element);
-		assert((size + pos) <= length);
-		if (size > 0) {
-			std::memcpy(GetWritingPos(), (void*)(vec.data()), size);
-			pos += size;
-		}
-		return *this;
+		return (WriteArray(vec.data(), vec.size()));
 	}
 
 #ifdef USE_SAFE_VECTOR
+	template <typename element, typename base>
+	PackPacket& operator<<(const safe_vector<element, base>& vec) {
+		return (WriteArray(vec.data(), vec.size()));
+	}
+#endif
+
 	template <typename element>
-	PackPacket& operator<<(const safe_vector<element>& vec) {
-		const size_t size = vec.size() * sizeof(element);
+	PackPacket& WriteArray(const element* elems, size_t count) {
+		const size_t size = count * sizeof(element);
 		assert((size + pos) <= length);
 		if (size > 0) {
-			std::memcpy(GetWritingPos(), (void*)(vec.data()), size);
+			std::memcpy(GetWritingPos(), (const void*)(elems), size);
 			pos += size;
 		}
 		return *this;
 	}
-#endif
 
 	uint8_t* GetWritingPos() { return (data + pos); }
 
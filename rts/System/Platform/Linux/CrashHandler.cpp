@@ -24,6 +24,7 @@
 
 #include "System/FileSystem/FileSystem.h"
 #include "Game/GameVersion.h"
+#include "System/Log/Backend.h"
 #include "System/Log/ILog.h"
 #include "System/Log/LogSinkHandler.h"
 #include "System/LogOutput.h"
@@ -948,6 +949,8 @@ namespace CrashHandler
 		ucontext_t* uctx = reinterpret_cast<ucontext_t*> (pctx);
 
 		logSinkHandler.SetSinking(false);
+		// write out queued records and log the crash synchronously
+		log_backend_setAsync(false);
 
 		std::string error = strsignal(signal);
 		// append the signal name (it seems there is no OS function to map signum to signame :<)
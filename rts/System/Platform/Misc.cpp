@@ -39,6 +39,7 @@
 
 
 #if !defined(WIN32)
+#include <sys/resource.h> // for getrusage()
 #include <sys/utsname.h> // for uname()
 #include <sys/types.h> // for getpw
 #include <pwd.h> // for getpw
@@ -409,6 +410,28 @@ namespace Platform
 	}
 
 
+	uint64_t GetPeakRSS() {
+		#ifdef WIN32
+		// would need psapi (GetProcessMemoryInfo), which we do not link
+		return 0;
+
+		#else
+
+		struct rusage usage;
+
+		if (getrusage(RUSAGE_SELF, &usage) != 0)
+			return 0;
+
+		#ifdef __APPLE__
+		return (uint64_t(usage.ru_maxrss));
+		#else
+		// KB on Linux and the BSDs
+		return (uint64_t(usage.ru_maxrss) * 1024);
+		#endif
+		#endif
+	}
+
+
 	uint32_t NativeWordSize() { return (sizeof(void*)); }
 	uint32_t SystemWordSize() { return ((Is32BitEmulation())? 8: NativeWordSize()); }
 	uint32_t DequeChunkSize() {
@@ -89,6 +89,11 @@ bool Is32BitEmulation();
 bool IsRunningInGDB();
 
 uint64_t FreeDiskSpace(const std::string& path);
+/**
+ * Returns the peak resident set size (high-water mark of physical memory
+ * used) of this process in bytes, or 0 if it can not be determined.
+ */
+uint64_t GetPeakRSS();
 uint32_t NativeWordSize(); // compiled process code
 uint32_t SystemWordSize(); // host operating system
 uint32_t DequeChunkSize();
@@ -7,6 +7,7 @@
 
 #include "System/Platform/CrashHandler.h"
 #include "System/Platform/errorhandler.h"
+#include "System/Log/Backend.h"
 #include "System/Log/ILog.h"
 #include "System/Log/FileSink.h"
 #include "System/Log/LogSinkHandler.h"
@@ -458,6 +459,8 @@ LONG CALLBACK ExceptionHandler(LPEXCEPTION_POINTERS e)
 {
 	// prologue; disable registered sinks (info-console, ...)
 	logSinkHandler.SetSinking(false);
+	// write out queued records, the trace partially bypasses the log backend
+	log_backend_setAsync(false);
 	LOG_RAW_LINE(LOG_LEVEL_ERROR, "Spring %s has crashed.", (SpringVersion::GetFull()).c_str());
 	PrepareStacktrace();
 
@@ -0,0 +1,476 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef _RING_DEQUE_H
+#define _RING_DEQUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "System/creg/creg_cond.h"
+
+namespace spring {
+	// storage shared by all ring_deque<T> instances: element slots handed out
+	// from a free-list over fixed-size chunks (never returned to the OS, the
+	// pool stays at its high-water mark) and per power-of-two capacity class
+	// recycled rings; queues that are repeatedly created, grown and destroyed
+	// (one per unit) then no longer hit the allocator every time
+	template<typename T>
+	class ring_deque_pool {
+	public:
+		static constexpr size_t MIN_CAPACITY = 4;
+		static constexpr size_t NUM_CLASSES = 24;
+		static constexpr size_t MAX_FREE_RINGS = 256;
+		static constexpr size_t CHUNK_SLOTS = 256;
+
+		static void* AllocSlot() {
+			State& s = GetState();
+			Lock(s);
+
+			if (s.freeSlots == nullptr) {
+				Slot* chunk = static_cast<Slot*>(::operator new(CHUNK_SLOTS * sizeof(Slot)));
+
+				for (size_t i = 0; i < CHUNK_SLOTS; i++) {
+					chunk[i].next = (i < (CHUNK_SLOTS - 1))? &chunk[i + 1]: nullptr;
+				}
+
+				s.freeSlots = chunk;
+			}
+
+			Slot* slot = s.freeSlots;
+			s.freeSlots = slot->next;
+
+			Unlock(s);
+			return slot;
+		}
+
+		static void FreeSlot(void* p) {
+			State& s = GetState();
+			Slot* slot = static_cast<Slot*>(p);
+
+			Lock(s);
+			slot->next = s.freeSlots;
+			s.freeSlots = slot;
+			Unlock(s);
+		}
+
+		static T** AllocRing(size_t capacity) {
+			State& s = GetState();
+			const size_t capClass = GetClass(capacity);
+
+			if (capClass < NUM_CLASSES) {
+				Lock(s);
+
+				if (s.numFreeRings[capClass] > 0) {
+					T** ring = s.freeRings[capClass][ --s.numFreeRings[capClass] ];
+					Unlock(s);
+					return ring;
+				}
+
+				Unlock(s);
+			}
+
+			return static_cast<T**>(::operator new(capacity * sizeof(T*)));
+		}
+
+		static void FreeRing(T** ring, size_t capacity) {
+			State& s = GetState();
+			const size_t capClass = GetClass(capacity);
+
+			if (capClass < NUM_CLASSES) {
+				Lock(s);
+
+				if (s.numFreeRings[capClass] < MAX_FREE_RINGS) {
+					s.freeRings[capClass][ s.numFreeRings[capClass]++ ] = ring;
+					Unlock(s);
+					return;
+				}
+
+				Unlock(s);
+			}
+
+			::operator delete(ring);
+		}
+
+	private:
+		union Slot {
+			Slot* next;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type data;
+		};
+
+		struct State {
+			std::atomic_flag lock;
+
+			Slot* freeSlots;
+			T** freeRings[NUM_CLASSES][MAX_FREE_RINGS];
+			size_t numFreeRings[NUM_CLASSES];
+		};
+
+		// intentionally leaked, containers may outlive static destruction
+		static State& GetState() {
+			static State* state = CreateState();
+			return *state;
+		}
+
+		static State* CreateState() {
+			State* s = new State();
+			s->lock.clear();
+			s->freeSlots = nullptr;
+			return s;
+		}
+
+		static size_t GetClass(size_t capacity) {
+			assert(capacity >= MIN_CAPACITY && (capacity & (capacity - 1)) == 0);
+
+			size_t capClass = 0;
+
+			for (capacity /= MIN_CAPACITY; capacity > 1; capacity >>= 1) {
+				capClass += 1;
+			}
+
+			return capClass;
+		}
+
+		static void Lock(State& s) { while (s.lock.test_and_set(std::memory_order_acquire)); }
+		static void Unlock(State& s) { s.lock.clear(std::memory_order_release); }
+	};
+
+	template<typename T> constexpr size_t ring_deque_pool<T>::MIN_CAPACITY;
+	template<typename T> constexpr size_t ring_deque_pool<T>::NUM_CLASSES;
+	template<typename T> constexpr size_t ring_deque_pool<T>::MAX_FREE_RINGS;
+	template<typename T> constexpr size_t ring_deque_pool<T>::CHUNK_SLOTS;
+
+
+
+	// double-ended queue over a power-of-two ring of element pointers, both
+	// drawn from ring_deque_pool; elements never move, so references remain
+	// valid across push_* and pop_* of other elements (as with std::deque),
+	// while insert and erase only shift pointers. iterators address elements
+	// by logical index and thus also survive push_back, after erase they
+	// refer to the element that followed the erased range
+	template<typename T>
+	class ring_deque {
+	private:
+		template<typename Q, typename V>
+		class ring_iterator {
+		public:
+			typedef std::random_access_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef V* pointer;
+			typedef V& reference;
+
+			ring_iterator(): q(nullptr), i(0) {}
+			ring_iterator(Q* _q, difference_type _i): q(_q), i(_i) {}
+
+			// allows iterator -> const_iterator
+			template<typename Q2, typename V2>
+			ring_iterator(const ring_iterator<Q2, V2>& it): q(it.q), i(it.i) {}
+
+			reference operator * () const { return (*q)[i]; }
+			pointer operator -> () const { return &(*q)[i]; }
+			reference operator [] (difference_type n) const { return (*q)[i + n]; }
+
+			ring_iterator& operator ++ () { i += 1; return *this; }
+			ring_iterator& operator -- () { i -= 1; return *this; }
+			ring_iterator operator ++ (int) { ring_iterator it = *this; i += 1; return it; }
+			ring_iterator operator -- (int) { ring_iterator it = *this; i -= 1; return it; }
+
+			ring_iterator& operator += (difference_type n) { i += n; return *this; }
+			ring_iterator& operator -= (difference_type n) { i -= n; return *this; }
+
+			ring_iterator operator + (difference_type n) const { return ring_iterator(q, i + n); }
+			ring_iterator operator - (difference_type n) const { return ring_iterator(q, i - n); }
+			friend ring_iterator operator + (difference_type n, const ring_iterator& it) { return (it + n); }
+
+			template<typename Q2, typename V2> difference_type operator - (const ring_iterator<Q2, V2>& it) const { return (i - it.i); }
+
+			template<typename Q2, typename V2> bool operator == (const ring_iterator<Q2, V2>& it) const { return (i == it.i); }
+			template<typename Q2, typename V2> bool operator != (const ring_iterator<Q2, V2>& it) const { return (i != it.i); }
+			template<typename Q2, typename V2> bool operator <  (const ring_iterator<Q2, V2>& it) const { return (i <  it.i); }
+			template<typename Q2, typename V2> bool operator >  (const ring_iterator<Q2, V2>& it) const { return (i >  it.i); }
+			template<typename Q2, typename V2> bool operator <= (const ring_iterator<Q2, V2>& it) const { return (i <= it.i); }
+			template<typename Q2, typename V2> bool operator >= (const ring_iterator<Q2, V2>& it) const { return (i >= it.i); }
+
+		private:
+			template<typename Q2, typename V2> friend class ring_iterator;
+			friend class ring_deque;
+
+			Q* q;
+			difference_type i;
+		};
+
+	public:
+		typedef T value_type;
+		typedef size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef T& reference;
+		typedef const T& const_reference;
+
+		typedef ring_iterator<ring_deque, T> iterator;
+		typedef ring_iterator<const ring_deque, const T> const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	public:
+		ring_deque(): ring(nullptr), head(0), count(0), capacity(0) {}
+		ring_deque(const ring_deque& q): ring_deque() { *this = q; }
+		ring_deque(ring_deque&& q): ring_deque() { *this = std::move(q); }
+		~ring_deque() { Release(); }
+
+		ring_deque& operator = (const ring_deque& q) {
+			if (this == &q)
+				return *this;
+
+			clear();
+			Reserve(q.count);
+
+			for (const T& e: q) {
+				push_back(e);
+			}
+
+			return *this;
+		}
+		ring_deque& operator = (ring_deque&& q) {
+			if (this == &q)
+				return *this;
+
+			Release();
+
+			std::swap(ring, q.ring);
+			std::swap(head, q.head);
+			std::swap(count, q.count);
+			std::swap(capacity, q.capacity);
+			return *this;
+		}
+
+
+		bool empty() const { return (count == 0); }
+		size_type size() const { return count; }
+
+		void clear() {
+			while (!empty()) {
+				pop_back();
+			}
+
+			head = 0;
+		}
+
+		// default-constructs new elements at the back, needed by creg
+		void resize(size_type n) {
+			Reserve(n);
+
+			while (count > n)
+				pop_back();
+			while (count < n)
+				emplace_back();
+		}
+
+
+		void push_back(const T& e) { emplace_back(e); }
+		void push_back(T&& e) { emplace_back(std::move(e)); }
+		void push_front(const T& e) { emplace_front(e); }
+		void push_front(T&& e) { emplace_front(std::move(e)); }
+
+		template<typename... Args> T& emplace_back(Args&&... args) {
+			T* e = Construct(std::forward<Args>(args)...);
+
+			Reserve(count + 1);
+
+			ring[Wrap(head + count)] = e;
+			count += 1;
+			return *e;
+		}
+
+		template<typename... Args> T& emplace_front(Args&&... args) {
+			T* e = Construct(std::forward<Args>(args)...);
+
+			Reserve(count + 1);
+
+			head = Wrap(head + capacity - 1);
+			ring[head] = e;
+			count += 1;
+			return *e;
+		}
+
+		void pop_back() {
+			assert(!empty());
+			Destroy(ring[Wrap(head + count - 1)]);
+			count -= 1;
+		}
+
+		void pop_front() {
+			assert(!empty());
+			Destroy(ring[head]);
+			head = Wrap(head + 1);
+			count -= 1;
+		}
+
+
+		// shifts whichever side of <pos> holds fewer pointers
+		iterator insert(const_iterator pos, const T& e) {
+			const size_type idx = pos.i;
+
+			assert(idx <= count);
+
+			T* p = Construct(e);
+
+			Reserve(count + 1);
+
+			if (idx < (count - idx)) {
+				head = Wrap(head + capacity - 1);
+				count += 1;
+
+				for (size_type j = 0; j < idx; j++) {
+					Ptr(j) = Ptr(j + 1);
+				}
+			} else {
+				count += 1;
+
+				for (size_type j = count - 1; j > idx; j--) {
+					Ptr(j) = Ptr(j - 1);
+				}
+			}
+
+			Ptr(idx) = p;
+			return (begin() + idx);
+		}
+
+		iterator erase(const_iterator pos) { return (erase(pos, pos + 1)); }
+		iterator erase(const_iterator first, const_iterator last) {
+			const size_type idx = first.i;
+			const size_type num = last.i - first.i;
+
+			assert((idx + num) <= count);
+
+			for (size_type j = idx; j < (idx + num); j++) {
+				Destroy(Ptr(j));
+			}
+
+			if (idx < (count - idx - num)) {
+				for (size_type j = idx; j > 0; j--) {
+					Ptr(j - 1 + num) = Ptr(j - 1);
+				}
+
+				head = Wrap(head + num);
+			} else {
+				for (size_type j = idx + num; j < count; j++) {
+					Ptr(j - num) = Ptr(j);
+				}
+			}
+
+			count -= num;
+			return (begin() + idx);
+		}
+
+
+		      T& operator[] (size_type i)       { assert(i < count); return *ring[Wrap(head + i)]; }
+		const T& operator[] (size_type i) const { assert(i < count); return *ring[Wrap(head + i)]; }
+
+		      T& at(size_type i)       { if (i >= count) throw std::out_of_range("ring_deque::at"); return (*this)[i]; }
+		const T& at(size_type i) const { if (i >= count) throw std::out_of_range("ring_deque::at"); return (*this)[i]; }
+
+		      T& front()       { return (*this)[0]; }
+		const T& front() const { return (*this)[0]; }
+		      T& back()       { return (*this)[count - 1]; }
+		const T& back() const { return (*this)[count - 1]; }
+
+		iterator begin() { return (iterator(this, 0)); }
+		iterator end() { return (iterator(this, count)); }
+		const_iterator begin() const { return (const_iterator(this, 0)); }
+		const_iterator end() const { return (const_iterator(this, count)); }
+		const_iterator cbegin() const { return (begin()); }
+		const_iterator cend() const { return (end()); }
+
+		reverse_iterator rbegin() { return (reverse_iterator(end())); }
+		reverse_iterator rend() { return (reverse_iterator(begin())); }
+		const_reverse_iterator rbegin() const { return (const_reverse_iterator(end())); }
+		const_reverse_iterator rend() const { return (const_reverse_iterator(begin())); }
+
+	private:
+		typedef ring_deque_pool<T> pool;
+
+		size_type Wrap(size_type i) const { return (i & (capacity - 1)); }
+
+		T*& Ptr(size_type i) { return ring[Wrap(head + i)]; }
+
+		template<typename... Args> static T* Construct(Args&&... args) {
+			void* slot = pool::AllocSlot();
+
+			try {
+				return (new (slot) T(std::forward<Args>(args)...));
+			} catch (...) {
+				pool::FreeSlot(slot);
+				throw;
+			}
+		}
+
+		static void Destroy(T* e) {
+			e->~T();
+			pool::FreeSlot(e);
+		}
+
+		void Reserve(size_type n) {
+			if (n <= capacity)
+				return;
+
+			size_type newCapacity = std::max(capacity, pool::MIN_CAPACITY);
+
+			while (newCapacity < n) {
+				newCapacity <<= 1;
+			}
+
+			T** newRing = pool::AllocRing(newCapacity);
+
+			for (size_type i = 0; i < count; i++) {
+				newRing[i] = Ptr(i);
+			}
+
+			if (ring != nullptr)
+				pool::FreeRing(ring, capacity);
+
+			ring = newRing;
+			head = 0;
+			capacity = newCapacity;
+		}
+
+		void Release() {
+			clear();
+
+			if (ring != nullptr)
+				pool::FreeRing(ring, capacity);
+
+			ring = nullptr;
+			capacity = 0;
+		}
+
+	private:
+		T** ring;
+
+		size_type head;
+		size_type count;
+		size_type capacity;
+	};
+};
+
+#ifdef USING_CREG
+
+namespace creg
+{
+	template<typename T>
+	struct DeduceType<spring::ring_deque<T>> {
+		static std::unique_ptr<IType> Get() {
+			return std::unique_ptr<IType>(new DynamicArrayType<spring::ring_deque<T> >());
+		}
+	};
+}
+
+#endif // USING_CREG
+
+#endif // _RING_DEQUE_H
@@ -7,32 +7,11 @@
 #include "System/Platform/CrashHandler.h"
 #include "System/MainDefines.h"
 
-template <> const float& safe_vector<float>::safe_element(size_type idx) const {
-	static const float def = 0.0f;
-
-	if (showError) {
-		showError = false;
-		LOG_L(L_ERROR, "[%s const] index " _STPF_ " out of bounds! (size " _STPF_ ")", __FUNCTION__, idx, size());
-#ifndef UNITSYNC
-		CrashHandler::OutputStacktrace();
-#endif
-	}
-
-	return def;
-}
-
-template <> float& safe_vector<float>::safe_element(size_type idx) {
-	static float def = 0.0f;
-
-	if (showError) {
-		showError = false;
-		LOG_L(L_ERROR, "[%s] index " _STPF_ " out of bounds! (size " _STPF_ ")", __FUNCTION__, idx, size());
+void safe_vector_error(const char* func, size_t idx, size_t size) {
+	LOG_L(L_ERROR, "[%s] index " _STPF_ " out of bounds! (size " _STPF_ ")", func, idx, size);
 #ifndef UNITSYNC
-		CrashHandler::OutputStacktrace();
+	CrashHandler::OutputStacktrace();
 #endif
-	}
-
-	return def;
 }
 
 #endif // USE_SAFE_VECTOR
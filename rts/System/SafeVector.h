@@ -10,41 +10,65 @@
 #ifdef USE_SAFE_VECTOR
 #include "System/creg/creg_cond.h"
 
-template<class T>
-class safe_vector : public std::vector<T>
+// logs (once per container) an out-of-bounds access, see SafeVector.cpp
+void safe_vector_error(const char* func, size_t idx, size_t size);
+
+// <B> is the underlying container, any type with a std::vector-like interface
+template<class T, class B = std::vector<T>>
+class safe_vector : public B
 {
 public:
-	typedef typename std::vector<T>::size_type size_type;
+	typedef typename B::size_type size_type;
 
 	safe_vector(): showError(true) {}
-	safe_vector(size_type size, T value): std::vector<T>(size, value), showError(true) {}
-	safe_vector(const safe_vector<T>& vec): std::vector<T>(vec), showError(true) {}
+	safe_vector(size_type size, T value): B(size, value), showError(true) {}
+	safe_vector(const safe_vector& vec): B(vec), showError(true) {}
+
+	safe_vector& operator = (const safe_vector& vec) { B::operator = (vec); return *this; }
 
 	const T& operator[] (const size_type i) const {
-		if (i >= std::vector<T>::size())
+		if (i >= B::size())
 			return safe_element(i);
-		return std::vector<T>::operator[](i);
+		return B::operator[](i);
 	}
 	T& operator[] (const size_type i) {
-		if (i >= std::vector<T>::size())
+		if (i >= B::size())
 			return safe_element(i);
-		return std::vector<T>::operator[](i);
+		return B::operator[](i);
 	}
 
 	const T& at (const size_type i) const {
-		if (i >= std::vector<T>::size())
+		if (i >= B::size())
 			return safe_element(i);
-		return std::vector<T>::at(i);
+		return B::at(i);
 	}
 	T& at (const size_type i) {
-		if (i >= std::vector<T>::size())
+		if (i >= B::size())
 			return safe_element(i);
-		return std::vector<T>::at(i);
+		return B::at(i);
 	}
 
 private:
-	const T& safe_element(size_type idx) const;
-	      T& safe_element(size_type idx);
+	const T& safe_element(size_type idx) const {
+		static const T def = T();
+
+		if (showError) {
+			showError = false;
+			safe_vector_error("safe_element const", idx, B::size());
+		}
+
+		return def;
+	}
+	T& safe_element(size_type idx) {
+		static T def = T();
+
+		if (showError) {
+			showError = false;
+			safe_vector_error("safe_element", idx, B::size());
+		}
+
+		return def;
+	}
 
 	mutable bool showError;
 };
@@ -55,10 +79,10 @@ private:
 namespace creg
 {
 	// Vector type (vector<T>)
-	template<typename T>
-	struct DeduceType<safe_vector<T>> {
+	template<typename T, typename B>
+	struct DeduceType<safe_vector<T, B>> {
 		static std::unique_ptr<IType> Get() {
-			return std::unique_ptr<IType>(new DynamicArrayType<safe_vector<T> >());
+			return std::unique_ptr<IType>(new DynamicArrayType<safe_vector<T, B> >());
 		}
 	};
 }
@@ -66,7 +90,7 @@ namespace creg
 #endif // USING_CREG
 
 #else
-#define safe_vector std::vector
+template<class T, class B = std::vector<T>> using safe_vector = B;
 #endif
 
 #endif // _SAFE_VECTOR_H
@@ -0,0 +1,247 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef _SMALL_VECTOR_H
+#define _SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "System/creg/creg_cond.h"
+
+namespace spring {
+	// vector whose first N elements live inside the object itself; only
+	// grows onto the heap beyond that (restricted to trivially copyable
+	// types so elements can be moved around with memcpy)
+	template<typename T, size_t N>
+	class small_vector {
+	public:
+		static_assert(std::is_trivially_copyable<T>::value, "small_vector requires trivially copyable elements");
+		static_assert(N > 0, "small_vector requires a non-zero inline capacity");
+
+		typedef T value_type;
+		typedef size_t size_type;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T* iterator;
+		typedef const T* const_iterator;
+
+	public:
+		small_vector(): elems(inlineElems), numElems(0), maxElems(N) {}
+		small_vector(size_type n, const T& value = T()): small_vector() { resize(n, value); }
+		small_vector(std::initializer_list<T> l): small_vector() { assign(l.begin(), l.end()); }
+		small_vector(const small_vector& v): small_vector() { assign(v.begin(), v.end()); }
+		small_vector(small_vector&& v): small_vector() { *this = std::move(v); }
+
+		template<typename InputIt> small_vector(InputIt first, InputIt last): small_vector() { assign(first, last); }
+
+		~small_vector() { Deallocate(); }
+
+		small_vector& operator = (const small_vector& v) {
+			if (this != &v)
+				assign(v.begin(), v.end());
+
+			return *this;
+		}
+		small_vector& operator = (small_vector&& v) {
+			if (this == &v)
+				return *this;
+
+			if (v.IsInline()) {
+				assign(v.begin(), v.end());
+				v.clear();
+				return *this;
+			}
+
+			// steal the heap buffer
+			Deallocate();
+
+			elems = v.elems;
+			numElems = v.numElems;
+			maxElems = v.maxElems;
+
+			v.elems = v.inlineElems;
+			v.numElems = 0;
+			v.maxElems = N;
+			return *this;
+		}
+
+		template<typename InputIt> void assign(InputIt first, InputIt last) {
+			clear();
+			reserve(std::distance(first, last));
+
+			for (; first != last; ++first) {
+				elems[numElems++] = *first;
+			}
+		}
+
+
+		bool empty() const { return (numElems == 0); }
+
+		size_type size() const { return numElems; }
+		size_type capacity() const { return maxElems; }
+		static constexpr size_type inline_capacity() { return N; }
+
+		void reserve(size_type n) {
+			if (n <= maxElems)
+				return;
+
+			Reallocate(std::max(n, maxElems * 2));
+		}
+
+		void resize(size_type n, const T& value = T()) {
+			reserve(n);
+
+			for (size_type i = numElems; i < n; i++) {
+				elems[i] = value;
+			}
+
+			numElems = n;
+		}
+
+		void clear() { numElems = 0; }
+		void shrink_to_fit() {
+			if (IsInline() || numElems > N)
+				return;
+
+			T* heapElems = elems;
+
+			std::memcpy(inlineElems, heapElems, numElems * sizeof(T));
+			std::free(heapElems);
+
+			elems = inlineElems;
+			maxElems = N;
+		}
+
+
+		void push_back(const T& value) {
+			if (numElems == maxElems) {
+				// <value> might alias an element
+				const T tmp = value;
+				Reallocate(maxElems * 2);
+				elems[numElems++] = tmp;
+				return;
+			}
+
+			elems[numElems++] = value;
+		}
+
+		template<typename... Args> T& emplace_back(Args&&... args) {
+			push_back(T(std::forward<Args>(args)...));
+			return back();
+		}
+
+		void pop_back() { assert(!empty()); numElems -= 1; }
+
+
+		iterator insert(const_iterator pos, const T& value) {
+			const size_type idx = pos - elems;
+			const T tmp = value;
+
+			assert(idx <= numElems);
+			reserve(numElems + 1);
+
+			std::memmove(elems + idx + 1, elems + idx, (numElems - idx) * sizeof(T));
+
+			elems[idx] = tmp;
+			numElems += 1;
+			return (elems + idx);
+		}
+
+		iterator erase(const_iterator pos) { return (erase(pos, pos + 1)); }
+		iterator erase(const_iterator first, const_iterator last) {
+			const size_type idx = first - elems;
+			const size_type cnt = last - first;
+
+			assert((idx + cnt) <= numElems);
+			std::memmove(elems + idx, elems + idx + cnt, (numElems - idx - cnt) * sizeof(T));
+
+			numElems -= cnt;
+			return (elems + idx);
+		}
+
+
+		      T& operator[] (size_type i)       { assert(i < numElems); return elems[i]; }
+		const T& operator[] (size_type i) const { assert(i < numElems); return elems[i]; }
+
+		      T& at(size_type i)       { if (i >= numElems) throw std::out_of_range("small_vector::at"); return elems[i]; }
+		const T& at(size_type i) const { if (i >= numElems) throw std::out_of_range("small_vector::at"); return elems[i]; }
+
+		      T& front()       { assert(!empty()); return elems[0]; }
+		const T& front() const { assert(!empty()); return elems[0]; }
+		      T& back()       { assert(!empty()); return elems[numElems - 1]; }
+		const T& back() const { assert(!empty()); return elems[numElems - 1]; }
+
+		      T* data()       { return elems; }
+		const T* data() const { return elems; }
+
+		iterator begin() { return (elems); }
+		iterator end() { return (elems + numElems); }
+		const_iterator begin() const { return (elems); }
+		const_iterator end() const { return (elems + numElems); }
+		const_iterator cbegin() const { return (begin()); }
+		const_iterator cend() const { return (end()); }
+
+		bool operator == (const small_vector& v) const { return (numElems == v.numElems && std::equal(begin(), end(), v.begin())); }
+		bool operator != (const small_vector& v) const { return (!(*this == v)); }
+
+	private:
+		bool IsInline() const { return (elems == inlineElems); }
+
+		void Reallocate(size_type n) {
+			assert(n > numElems);
+
+			T* newElems = static_cast<T*>(std::malloc(n * sizeof(T)));
+
+			if (newElems == nullptr)
+				throw std::bad_alloc();
+
+			std::memcpy(newElems, elems, numElems * sizeof(T));
+			Deallocate();
+
+			elems = newElems;
+			maxElems = n;
+		}
+
+		void Deallocate() {
+			if (IsInline())
+				return;
+
+			std::free(elems);
+			elems = inlineElems;
+		}
+
+	private:
+		T inlineElems[N];
+		T* elems;
+
+		size_type numElems;
+		size_type maxElems;
+	};
+};
+
+
+#ifdef USING_CREG
+
+namespace creg
+{
+	template<typename T, size_t N>
+	struct DeduceType<spring::small_vector<T, N>> {
+		static std::unique_ptr<IType> Get() {
+			return std::unique_ptr<IType>(new DynamicArrayType<spring::small_vector<T, N> >());
+		}
+	};
+}
+
+#endif // USING_CREG
+
+#endif // _SMALL_VECTOR_H
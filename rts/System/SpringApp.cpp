@@ -117,6 +117,7 @@ DEFINE_string   (server,                                   "",    "Set listening
 DEFINE_bool     (textureatlas,                             false, "Dump each finalized textureatlas in textureatlasN.tga");
 DEFINE_int32    (benchmark,                                -1,    "Enable benchmark mode (writes a benchmark.data file). The given number specifies the timespan to test.");
 DEFINE_int32    (benchmarkstart,                           -1,    "Benchmark start time in minutes.");
+DEFINE_string_EX(benchmark_json,     "benchmark-json",     "",    "Replay at maximum speed in benchmark mode and write per-timer sim-frame statistics (mean, p50, p99, max) as JSON to this file.");
 
 DEFINE_bool_EX  (list_ai_interfaces, "list-ai-interfaces", false, "Dump a list of available AI Interfaces to stdout");
 DEFINE_bool_EX  (list_skirmish_ais,  "list-skirmish-ais",  false, "Dump a list of available Skirmish AIs to stdout");
@@ -478,6 +479,7 @@ void SpringApp::ParseCmdLine(int argc, char* argv[])
 			CBenchmark::startFrame = FLAGS_benchmarkstart * 60 * GAME_SPEED;
 
 		CBenchmark::endFrame = CBenchmark::startFrame + FLAGS_benchmark * 60 * GAME_SPEED;
+		CBenchmark::jsonFile = FLAGS_benchmark_json;
 	}
 }
 
@@ -1,6 +1,7 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
 #include <cassert>
+#include <cstdio>
 #include <cstring>
 
 #include "SHA512.hpp"
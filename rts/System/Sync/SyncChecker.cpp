@@ -5,9 +5,47 @@
 
 #include "SyncChecker.h"
 
+#include <cstring>
+
 
 unsigned CSyncChecker::g_checksum;
+unsigned CSyncChecker::g_laneChecksums[NUM_SYNC_LANES];
+CSyncChecker::SyncLane CSyncChecker::g_lane = CSyncChecker::SYNC_LANE_MISC;
+CSyncChecker::FrameLanes CSyncChecker::g_laneHistory[SYNC_LANE_HISTORY];
 int CSyncChecker::inSyncedCode;
 
 
+void CSyncChecker::FinishFrame(int frameNum)
+{
+	FrameLanes& frameLanes = g_laneHistory[frameNum % SYNC_LANE_HISTORY];
+
+	frameLanes.frameNum = frameNum;
+
+	for (unsigned i = 0; i < NUM_SYNC_LANES; ++i) {
+		frameLanes.laneSums[i] = g_laneChecksums[i];
+
+		// fold lanes in a fixed order so the frame result stays order-dependent
+		g_checksum += g_laneChecksums[i];
+		g_checksum ^= g_checksum << 16;
+		g_checksum += g_checksum >> 11;
+
+		g_laneChecksums[i] = 0;
+	}
+}
+
+bool CSyncChecker::GetFrameLanes(int frameNum, std::uint32_t laneSums[NUM_SYNC_LANES])
+{
+	if (frameNum < 0)
+		return false;
+
+	const FrameLanes& frameLanes = g_laneHistory[frameNum % SYNC_LANE_HISTORY];
+
+	if (frameLanes.frameNum != frameNum)
+		return false;
+
+	std::memcpy(laneSums, frameLanes.laneSums, sizeof(frameLanes.laneSums));
+	return true;
+}
+
+
 #endif // SYNCDEBUG
@@ -14,15 +14,55 @@
 #endif
 
 #include <assert.h>
+#include <cinttypes>
 
 /**
  * @brief sync checker class
  *
  * A Lightweight sync debugger that just keeps a running checksum over all
  * assignments to synced variables.
+ *
+ * Assignments are hashed into one of several per-subsystem lanes, which are
+ * folded into the running checksum at the end of every frame. The last
+ * SYNC_LANE_HISTORY frames of lane checksums are kept around so that on a
+ * desync the server can ask clients for them and name the subsystem (and
+ * frame) that diverged first, without a SYNCDEBUG build.
  */
 class CSyncChecker {
 
+	public:
+		enum SyncLane {
+			SYNC_LANE_MISC        = 0,
+			SYNC_LANE_LUA         = 1,
+			SYNC_LANE_MAPDAMAGE   = 2,
+			SYNC_LANE_PATH        = 3,
+			SYNC_LANE_UNITS       = 4,
+			SYNC_LANE_PROJECTILES = 5,
+			SYNC_LANE_FEATURES    = 6,
+			SYNC_LANE_LOS         = 7,
+			SYNC_LANE_TEAMS       = 8,
+			NUM_SYNC_LANES        = 9,
+		};
+
+		static constexpr unsigned SYNC_LANE_HISTORY = 1024;
+
+		/**
+		 * Makes all Sync() calls within its scope hash into the given lane.
+		 */
+		struct ScopedLane {
+			ScopedLane(SyncLane lane): prevLane(g_lane) { g_lane = lane; }
+			~ScopedLane() { g_lane = prevLane; }
+
+			SyncLane prevLane;
+		};
+
+		static const char* GetLaneName(unsigned lane) {
+			constexpr const char* laneNames[NUM_SYNC_LANES + 1] = {
+				"Misc", "Lua", "MapDamage", "Path", "Units", "Projectiles", "Features", "LOS", "Teams", "<invalid>"
+			};
+			return laneNames[(lane < NUM_SYNC_LANES)? lane: NUM_SYNC_LANES];
+		}
+
 	public:
 		/**
 		 * Whether one thread (doesn't have to be the current thread!!!) is currently processing a SimFrame.
@@ -35,50 +75,71 @@ class CSyncChecker {
 		 * Keeps a running checksum over all assignments to synced variables.
 		 */
 		static unsigned GetChecksum() { return g_checksum; }
-		static void NewFrame() { g_checksum = 0xfade1eaf; }
+		static unsigned GetLaneChecksum() { return g_laneChecksums[g_lane]; }
+		static void NewFrame() {
+			g_checksum = 0xfade1eaf;
+
+			for (unsigned i = 0; i < NUM_SYNC_LANES; ++i)
+				g_laneChecksums[i] = 0;
+		}
+
+		/**
+		 * Folds the lane checksums of <frameNum> into the running checksum,
+		 * stores them in the history ring and starts a new set of lanes.
+		 * Must be called once after every SimFrame, before GetChecksum.
+		 */
+		static void FinishFrame(int frameNum);
+
+		/**
+		 * Copies the stored lane checksums of <frameNum> into <laneSums>.
+		 * Returns false if the frame is no longer (or not yet) in history.
+		 */
+		static bool GetFrameLanes(int frameNum, std::uint32_t laneSums[NUM_SYNC_LANES]);
 
 		static void Sync(const void* p, unsigned size) {
+			unsigned& checksum = g_laneChecksums[g_lane];
+
 			// most common cases first, make it easy for compiler to optimize for it
 			// simple xor is not enough to detect multiple zeroes, e.g.
 #ifdef TRACE_SYNC_HEAVY
-			g_checksum = HsiehHash((const char*)p, size, g_checksum);
+			checksum = HsiehHash((const char*)p, size, checksum);
 #else
 			switch(size) {
 			case 1:
-				g_checksum += *(const unsigned char*)p;
-				g_checksum ^= g_checksum << 10;
-				g_checksum += g_checksum >> 1;
+				checksum += *(const unsigned char*)p;
+				checksum ^= checksum << 10;
+				checksum += checksum >> 1;
 				break;
 			case 2:
-				g_checksum += *(const unsigned short*)(const char*)p;
-				g_checksum ^= g_checksum << 11;
-				g_checksum += g_checksum >> 17;
+				checksum += *(const unsigned short*)(const char*)p;
+				checksum ^= checksum << 11;
+				checksum += checksum >> 17;
 				break;
 			case 3:
 				// just here to make the switch statements contiguous (so it can be optimized)
 				for (unsigned i = 0; i < 3; ++i) {
-					g_checksum += *(const unsigned char*)p + i;
-					g_checksum ^= g_checksum << 10;
-					g_checksum += g_checksum >> 1;
+					checksum += *(const unsigned char*)p + i;
+					checksum ^= checksum << 10;
+					checksum += checksum >> 1;
 				}
 				break;
 			case 4:
-				g_checksum += *(const unsigned int*)(const char*)p;
-				g_checksum ^= g_checksum << 16;
-				g_checksum += g_checksum >> 11;
+				checksum += *(const unsigned int*)(const char*)p;
+				checksum ^= checksum << 16;
+				checksum += checksum >> 11;
 				break;
 			default:
 			{
 				unsigned i = 0;
 				for (; i < (size & ~3) / 4; ++i) {
-					g_checksum += *(reinterpret_cast<const unsigned int*>(p) + i);
-					g_checksum ^= g_checksum << 16;
-					g_checksum += g_checksum >> 11;
+					checksum += *(reinterpret_cast<const unsigned int*>(p) + i);
+					checksum ^= checksum << 16;
+					checksum += checksum >> 11;
 				}
 				for (; i < size; ++i) {
-					g_checksum += *(const unsigned char*)p + i;
-					g_checksum ^= g_checksum << 10;
-					g_checksum += g_checksum >> 1;
+					checksum += *(const unsigned char*)p + i;
+					checksum ^= checksum << 10;
+					checksum += checksum >> 1;
 				}
 				break;
 			}
@@ -93,6 +154,24 @@ class CSyncChecker {
 		 */
 		static unsigned g_checksum;
 
+		/**
+		 * Per-subsystem checksums of the current frame, and the lane
+		 * that Sync() is currently hashing into
+		 */
+		static unsigned g_laneChecksums[NUM_SYNC_LANES];
+		static SyncLane g_lane;
+
+		struct FrameLanes {
+			// -1 marks slots no frame has been stored in yet
+			int frameNum = -1;
+			std::uint32_t laneSums[NUM_SYNC_LANES];
+		};
+
+		/**
+		 * Ring buffer of the lane checksums of the last SYNC_LANE_HISTORY frames
+		 */
+		static FrameLanes g_laneHistory[SYNC_LANE_HISTORY];
+
 		/**
 		 * @brief in synced code
 		 *
@@ -47,7 +47,7 @@ namespace Sync {
 		assert(CSyncChecker::InSyncedCode());
 		CSyncChecker::Sync(p, size);
 	#ifdef TRACE_SYNC_HEAVY
-		tracefile << "Sync " << msg << " " << CSyncChecker::GetChecksum() << "\n";
+		tracefile << "Sync " << msg << " " << CSyncChecker::GetLaneChecksum() << "\n";
 	#endif
 #endif
 	}
@@ -70,6 +70,12 @@ namespace Sync {
 #  define LEAVE_SYNCED_CODE()
 #endif
 
+#ifdef SYNCCHECK
+#  define SCOPED_SYNC_LANE(lane) CSyncChecker::ScopedLane syncLane(CSyncChecker::lane)
+#else
+#  define SCOPED_SYNC_LANE(lane)
+#endif
+
 #ifdef SYNCDEBUG
 #  define ASSERT_SYNCED(x) Sync::AssertDebugger(x, "assert(" #x ")")
 #else
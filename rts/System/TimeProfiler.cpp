@@ -1,11 +1,15 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
 #include <algorithm>
-#include <climits>
+#include <array>
+#include <cstdio>
 #include <cstring>
+#include <memory>
 
 #include "System/TimeProfiler.h"
 #include "System/GlobalRNG.h"
+#include "System/MainDefines.h"
+#include "System/UnorderedSet.hpp"
 #include "System/Log/ILog.h"
 #include "System/Threading/SpringThreading.h"
 
@@ -14,76 +18,50 @@
 #endif
 
 static spring::mutex profileMutex;
-static spring::unordered_map<int, std::string> hashToName;
-static spring::unordered_map<int, int> refCounters;
-
-static CGlobalUnsyncedRNG profileColorRNG;
+static spring::mutex traceMutex;
+static spring::unordered_map<unsigned, std::string> hashToName;
+static spring::unordered_map<unsigned, std::string> traceZoneNames;
 
+// zones of the ScopedTimers running on this thread, innermost last; a
+// timer nested (recursively) in one of the same zone records nothing
+static constexpr unsigned MAX_ACTIVE_ZONES = 64;
+static _threadlocal unsigned activeZones[MAX_ACTIVE_ZONES];
+static _threadlocal unsigned numActiveZones = 0;
 
+static CGlobalUnsyncedRNG profileColorRNG;
 
-static unsigned HashString(const char* s, size_t n)
-{
-	unsigned hash = 0;
 
-	for (size_t i = 0; (i < n || n == std::string::npos); ++i) {
-		if (s[i] == 0)
-			break;
+// written only by its owning thread; WriteTrace reads the first numEvents
+// entries, which are never modified again while tracing (no reallocation)
+// and only if the buffer belongs to the current capture (generation)
+struct TraceBuffer {
+	struct Event {
+		unsigned hash;
+		spring_time begTime;
+		spring_time endTime;
+	};
 
-		hash += s[i];
-		hash ^= (hash << 7) | (hash >> (sizeof(hash) * CHAR_BIT - 7));
-	}
+	static constexpr unsigned MAX_EVENTS = 1 << 16;
 
-	return hash;
-}
+	std::array<Event, MAX_EVENTS> events;
+	std::atomic<unsigned> numEvents = {0};
+	std::atomic<unsigned> generation = {0};
 
-#if 0
-// unused
-static unsigned HashString(const std::string& s) {
-	return (HashString(s.c_str(), s.size()));
-}
+	// zones whose names this thread already registered in traceZoneNames
+	spring::unordered_set<unsigned> knownZones;
 
+	int threadIdx = 0;
+};
 
+static std::vector< std::unique_ptr<TraceBuffer> > traceBuffers;
+static _threadlocal TraceBuffer* threadTraceBuffer = nullptr;
 
-BasicTimer::BasicTimer(const std::string& timerName)
-	: nameHash(HashString(timerName))
-	, startTime(spring_gettime())
+// bumped by StartTrace; each owner clears its own buffer when it sees a
+// new value, so a writer that is still appending to the previous capture
+// never races with the reset
+static std::atomic<unsigned> traceGeneration = {0};
 
-	, name(timerName)
-{
-	const auto iter = hashToName.find(nameHash);
 
-	if (iter == hashToName.end()) {
-		hashToName.insert(std::pair<int, std::string>(nameHash, timerName)).first;
-	} else {
-#ifdef DEBUG
-		if (iter->second != timerName) {
-			LOG_L(L_ERROR, "Timer hash collision: %s <=> %s", timerName.c_str(), iter->second.c_str());
-			assert(false);
-		}
-#endif
-	}
-}
-#endif
-
-BasicTimer::BasicTimer(const char* timerName)
-	: nameHash(HashString(timerName, std::string::npos))
-	, startTime(spring_gettime())
-
-	, name(timerName)
-{
-	const auto iter = hashToName.find(nameHash);
-
-	if (iter == hashToName.end()) {
-		hashToName.insert(std::pair<int, std::string>(nameHash, timerName));
-	} else {
-#ifdef DEBUG
-		if (iter->second != timerName) {
-			LOG_L(L_ERROR, "Timer hash collision: %s <=> %s", timerName, iter->second.c_str());
-			assert(false);
-		}
-#endif
-	}
-}
 
 spring_time BasicTimer::GetDuration() const
 {
@@ -92,50 +70,41 @@ spring_time BasicTimer::GetDuration() const
 
 
 
-#if 0
-// unused
-ScopedTimer::ScopedTimer(const std::string& name, bool _autoShowGraph, bool _specialTimer)
-	: BasicTimer(name)
-
-	, autoShowGraph(_autoShowGraph)
-	, specialTimer(_specialTimer)
-{
-	auto iter = refCounters.find(nameHash);
-
-	if (iter == refCounters.end())
-		iter = refCounters.insert(std::pair<int, int>(nameHash, 0)).first;
-
-	++(iter->second);
-}
-#endif
-
-ScopedTimer::ScopedTimer(const char* timerName, bool _autoShowGraph, bool _specialTimer)
-	: BasicTimer(timerName)
+ScopedTimer::ScopedTimer(const char* timerName, unsigned timerHash, bool _autoShowGraph, bool _specialTimer)
+	: BasicTimer(timerName, timerHash)
 
 	// Game::SendClientProcUsage depends on "Sim" and "Draw" percentages, BenchMark on "Lua"
-	// note that address-comparison is intended here, timer names are (and must be) literals
 	, autoShowGraph(_autoShowGraph)
 	, specialTimer(_specialTimer)
+	, nested(false)
 {
-	auto iter = refCounters.find(nameHash);
+	const unsigned numZones = std::min(numActiveZones, MAX_ACTIVE_ZONES);
+
+	for (unsigned n = 0; n < numZones && !nested; n++) {
+		nested = (activeZones[n] == nameHash);
+	}
 
-	if (iter == refCounters.end())
-		iter = refCounters.insert(std::pair<int, int>(nameHash, 0)).first;
+	// zones beyond the maximum depth are counted but not compared against
+	if (numActiveZones < MAX_ACTIVE_ZONES)
+		activeZones[numActiveZones] = nameHash;
 
-	++(iter->second);
+	numActiveZones += 1;
 }
 
 ScopedTimer::~ScopedTimer()
 {
-	// no avoiding a second lookup since iterators can be invalidated with unordered_map
-	auto iter = refCounters.find(nameHash);
+	assert(numActiveZones > 0);
+	numActiveZones -= 1;
+
+	if (nested)
+		return;
 
-	assert(iter != refCounters.end());
-	assert(iter->second > 0);
+	const spring_time endTime = spring_gettime();
 
-	if (--(iter->second) == 0) {
-		profiler.AddTime(GetName(), startTime, GetDuration(), autoShowGraph, specialTimer, false);
-	}
+	profiler.AddTime(name, nameHash, startTime, endTime - startTime, autoShowGraph, specialTimer, false);
+
+	if (profiler.IsTracing())
+		profiler.AddTraceEvent(name, nameHash, startTime, endTime);
 }
 
 
@@ -164,28 +133,21 @@ spring_time ScopedOnceTimer::GetDuration() const
 
 
 
-#if 0
-// unused
-ScopedMtTimer::ScopedMtTimer(const std::string& timerName, bool _autoShowGraph)
-	// can not call BasicTimer's other ctor, accesses global map
-	// collisions for MT timers do not need to be checked anyway
-	: BasicTimer(spring_gettime())
-	, autoShowGraph(_autoShowGraph)
-{
-	name = timerName;
-}
-#endif
-
-ScopedMtTimer::ScopedMtTimer(const char* timerName, bool _autoShowGraph)
-	: BasicTimer(spring_gettime())
+ScopedMtTimer::ScopedMtTimer(const char* timerName, unsigned timerHash, bool _autoShowGraph)
+	// collisions for MT timers do not need to be checked
+	: BasicTimer(timerName, timerHash)
 	, autoShowGraph(_autoShowGraph)
 {
-	name = timerName;
 }
 
 ScopedMtTimer::~ScopedMtTimer()
 {
-	profiler.AddTime(GetName(), startTime, GetDuration(), autoShowGraph, false, true);
+	const spring_time endTime = spring_gettime();
+
+	profiler.AddTime(name, nameHash, startTime, endTime - startTime, autoShowGraph, false, true);
+
+	if (profiler.IsTracing())
+		profiler.AddTraceEvent(name, nameHash, startTime, endTime);
 }
 
 
@@ -195,6 +157,9 @@ ScopedMtTimer::~ScopedMtTimer()
 //////////////////////////////////////////////////////////////////////
 
 CTimeProfiler::CTimeProfiler()
+	: tracing(false)
+	, traceBegFrame(-1)
+	, traceEndFrame(-1)
 {
 	ResetState();
 }
@@ -316,7 +281,7 @@ void CTimeProfiler::ResortProfilesRaw()
 
 		// either caller already has lock, or we are disabled and thread-safe
 		for (auto it = profile.begin(); it != profile.end(); ++it) {
-			sortedProfile.emplace_back(it->first, it->second);
+			sortedProfile.emplace_back(hashToName[it->first], it->second);
 		}
 
 		std::sort(sortedProfile.begin(), sortedProfile.end(), sortFunc);
@@ -345,7 +310,7 @@ void CTimeProfiler::RefreshProfilesRaw()
 
 		const bool showGraph = rec.showGraph;
 
-		rec = profile[it->first];
+		rec = profile[ProfilerZoneHash(it->first.c_str())];
 		rec.showGraph = showGraph;
 	}
 }
@@ -366,7 +331,8 @@ float CTimeProfiler::GetPercent(const char* name) const
 
 
 void CTimeProfiler::AddTime(
-	const std::string& name,
+	const char* name,
+	const unsigned hash,
 	const spring_time startTime,
 	const spring_time deltaTime,
 	const bool showGraph,
@@ -380,8 +346,8 @@ void CTimeProfiler::AddTime(
 			return;
 
 		assert(!threadTimer);
-		AddTimeRaw(name, startTime, deltaTime, showGraph, threadTimer);
-		AddTimeRaw("Misc::Profiler::AddTime", t0, spring_now() - t0, false, false);
+		AddTimeRaw(name, hash, startTime, deltaTime, showGraph, threadTimer);
+		AddTimeRaw("Misc::Profiler::AddTime", ProfilerZoneHash("Misc::Profiler::AddTime"), t0, spring_now() - t0, false, false);
 		return;
 	}
 
@@ -390,12 +356,13 @@ void CTimeProfiler::AddTime(
 	std::unique_lock<spring::mutex> ulk(profileMutex, std::defer_lock);
 	while (!ulk.try_lock()) {}
 
-	AddTimeRaw(name, startTime, deltaTime, showGraph, threadTimer);
-	AddTimeRaw("Misc::Profiler::AddTime", t0, spring_now() - t0, false, false);
+	AddTimeRaw(name, hash, startTime, deltaTime, showGraph, threadTimer);
+	AddTimeRaw("Misc::Profiler::AddTime", ProfilerZoneHash("Misc::Profiler::AddTime"), t0, spring_now() - t0, false, false);
 }
 
 void CTimeProfiler::AddTimeRaw(
-	const std::string& name,
+	const char* name,
+	const unsigned hash,
 	const spring_time startTime,
 	const spring_time deltaTime,
 	const bool showGraph,
@@ -406,8 +373,8 @@ void CTimeProfiler::AddTimeRaw(
 		threadProfile[ThreadPool::GetThreadNum()].emplace_back(startTime, spring_gettime());
 #endif
 
-	auto pi = profile.find(name);
-	auto& p = (pi != profile.end())? pi->second: profile[name];
+	auto pi = profile.find(hash);
+	auto& p = (pi != profile.end())? pi->second: profile[hash];
 
 	// these are 0 if just created, works for both paths
 	p.total   += deltaTime;
@@ -419,8 +386,17 @@ void CTimeProfiler::AddTimeRaw(
 	if (pi != profile.end()) {
 		// profile already exists
 		p.frames[currentPosition] += deltaTime;
+
+		#ifdef DEBUG
+		if (hashToName[hash] != name) {
+			LOG_L(L_ERROR, "Timer hash collision: %s <=> %s", name, hashToName[hash].c_str());
+			assert(false);
+		}
+		#endif
 	} else {
 		// new profile, new color
+		hashToName[hash] = name;
+
 		p.color.x = profileColorRNG.NextFloat();
 		p.color.y = profileColorRNG.NextFloat();
 		p.color.z = profileColorRNG.NextFloat();
@@ -430,6 +406,19 @@ void CTimeProfiler::AddTimeRaw(
 	}
 }
 
+std::string CTimeProfiler::GetTimerName(unsigned hash) const
+{
+	std::unique_lock<spring::mutex> ulk(profileMutex, std::defer_lock);
+	while (!ulk.try_lock()) {}
+
+	const auto it = hashToName.find(hash);
+
+	if (it == hashToName.end())
+		return "";
+
+	return it->second;
+}
+
 void CTimeProfiler::PrintProfilingInfo() const
 {
 	if (sortedProfile.empty())
@@ -445,3 +434,149 @@ void CTimeProfiler::PrintProfilingInfo() const
 	}
 }
 
+
+
+void CTimeProfiler::StartTrace(int begFrame, int endFrame, const std::string& fileName)
+{
+	std::lock_guard<spring::mutex> lck(traceMutex);
+
+	// any running capture is discarded
+	tracing = false;
+	traceGeneration.fetch_add(1);
+
+	traceBegFrame = begFrame;
+	traceEndFrame = endFrame;
+	traceFileName = fileName;
+
+	LOG("[TimeProfiler::%s] tracing frames %d to %d into \"%s\"", __func__, begFrame, endFrame, fileName.c_str());
+}
+
+void CTimeProfiler::SetTraceFrame(int frameNum)
+{
+	if (traceFileName.empty())
+		return;
+
+	if (frameNum > traceEndFrame) {
+		if (tracing) {
+			tracing = false;
+			WriteTrace();
+		}
+
+		traceFileName.clear();
+		return;
+	}
+
+	tracing = (frameNum >= traceBegFrame);
+}
+
+void CTimeProfiler::AddTraceEvent(const char* name, unsigned hash, spring_time startTime, spring_time endTime)
+{
+	TraceBuffer* buffer = threadTraceBuffer;
+
+	if (buffer == nullptr) {
+		std::lock_guard<spring::mutex> lck(traceMutex);
+
+		traceBuffers.emplace_back(new TraceBuffer());
+		traceBuffers.back()->threadIdx = traceBuffers.size() - 1;
+
+		buffer = (threadTraceBuffer = traceBuffers.back().get());
+	}
+
+	const unsigned curGeneration = traceGeneration.load(std::memory_order_acquire);
+
+	if (buffer->generation.load(std::memory_order_relaxed) != curGeneration) {
+		buffer->numEvents.store(0, std::memory_order_relaxed);
+		buffer->generation.store(curGeneration, std::memory_order_release);
+	}
+
+	if (buffer->knownZones.find(hash) == buffer->knownZones.end()) {
+		std::lock_guard<spring::mutex> lck(traceMutex);
+
+		traceZoneNames[hash] = name;
+		buffer->knownZones.insert(hash);
+	}
+
+	const unsigned idx = buffer->numEvents.load(std::memory_order_relaxed);
+
+	// full buffers drop further events until the next capture
+	if (idx >= TraceBuffer::MAX_EVENTS)
+		return;
+
+	buffer->events[idx] = {hash, startTime, endTime};
+	buffer->numEvents.store(idx + 1, std::memory_order_release);
+}
+
+
+static void WriteJsonString(FILE* file, const std::string& str)
+{
+	fputc('"', file);
+
+	for (const char c: str) {
+		if (c == '"' || c == '\\')
+			fputc('\\', file);
+		if (static_cast<unsigned char>(c) < 0x20)
+			continue;
+
+		fputc(c, file);
+	}
+
+	fputc('"', file);
+}
+
+void CTimeProfiler::WriteTrace()
+{
+	std::lock_guard<spring::mutex> lck(traceMutex);
+
+	FILE* file = fopen(traceFileName.c_str(), "w");
+
+	if (file == nullptr) {
+		LOG_L(L_ERROR, "[TimeProfiler::%s] could not open \"%s\"", __func__, traceFileName.c_str());
+		return;
+	}
+
+	unsigned int numEvents = 0;
+	unsigned int numFullBuffers = 0;
+
+	const unsigned int curGeneration = traceGeneration.load();
+
+	// complete ("X") events, timestamps in microseconds; the category
+	// is the top-level part of a zone name such as "Sim" in "Sim::Path"
+	fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+
+	for (const auto& buffer: traceBuffers) {
+		// threads that recorded nothing since StartTrace still hold older events
+		if (buffer->generation.load(std::memory_order_acquire) != curGeneration)
+			continue;
+
+		const unsigned int bufferEvents = buffer->numEvents.load(std::memory_order_acquire);
+
+		if (bufferEvents == 0)
+			continue;
+
+		fprintf(file, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": %d, \"args\": {\"name\": \"thread %d\"}}", (numEvents > 0)? ",\n": "", buffer->threadIdx, buffer->threadIdx);
+
+		for (unsigned int n = 0; n < bufferEvents; n++) {
+			const TraceBuffer::Event& e = buffer->events[n];
+			const std::string& name = traceZoneNames[e.hash];
+			const size_t catEnd = name.find("::", 1);
+
+			fprintf(file, ",\n{\"name\": ");
+			WriteJsonString(file, name);
+			fprintf(file, ", \"cat\": ");
+			WriteJsonString(file, (catEnd != std::string::npos)? name.substr(0, catEnd): name);
+			fprintf(file, ", \"ph\": \"X\", \"pid\": 0, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+				buffer->threadIdx,
+				e.begTime.toNanoSecsi() * 0.001,
+				(e.endTime - e.begTime).toNanoSecsi() * 0.001
+			);
+		}
+
+		numEvents += bufferEvents;
+		numFullBuffers += (bufferEvents == TraceBuffer::MAX_EVENTS);
+	}
+
+	fprintf(file, "\n]}\n");
+	fclose(file);
+
+	LOG("[TimeProfiler::%s] wrote %u events to \"%s\" (%u full thread-buffers)", __func__, numEvents, traceFileName.c_str(), numFullBuffers);
+}
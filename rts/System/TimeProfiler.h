@@ -16,26 +16,49 @@
 
 // disable this if you want minimal profiling
 // (sim time is still measured because of game slowdown)
-#define SCOPED_TIMER(name) ScopedTimer __scopedTimer(name);
-#define SCOPED_SPECIAL_TIMER(name) ScopedTimer __scopedTimer(name, false, true)
-#define SCOPED_MT_TIMER(name) ScopedMtTimer __scopedTimer(name);
+// names must be literals, they are hashed at compile-time; timers with
+// runtime names construct a ScopedTimer directly
+#define SCOPED_TIMER(name) constexpr ProfilerZone __scopedTimerZone(name); ScopedTimer __scopedTimer(__scopedTimerZone);
+#define SCOPED_SPECIAL_TIMER(name) constexpr ProfilerZone __scopedTimerZone(name); ScopedTimer __scopedTimer(__scopedTimerZone, false, true)
+#define SCOPED_MT_TIMER(name) constexpr ProfilerZone __scopedTimerZone(name); ScopedMtTimer __scopedTimer(__scopedTimerZone);
+
+
+constexpr unsigned ProfilerZoneHashRot(unsigned hash) {
+	return (hash ^ ((hash << 7) | (hash >> (sizeof(hash) * 8 - 7))));
+}
+
+// identifies a timer (zone) by name
+constexpr unsigned ProfilerZoneHash(const char* s, unsigned hash = 0) {
+	return ((*s == 0)? hash: ProfilerZoneHash(s + 1, ProfilerZoneHashRot(hash + static_cast<unsigned>(*s))));
+}
+
+struct ProfilerZone {
+	explicit constexpr ProfilerZone(const char* zoneName): name(zoneName), hash(ProfilerZoneHash(zoneName)) {}
+
+	const char* name;
+	const unsigned hash;
+};
 
 
 class BasicTimer : public spring::noncopyable
 {
 public:
-	BasicTimer(const spring_time time): nameHash(0), startTime(time) {}
-	BasicTimer(const std::string& timerName);
-	BasicTimer(const char* timerName);
-
-	const std::string& GetName() const { return name; }
+	BasicTimer(const char* timerName, unsigned timerHash, const spring_time time = spring_gettime())
+		: nameHash(timerHash)
+		, startTime(time)
+		, name(timerName)
+	{}
+	BasicTimer(const char* timerName): BasicTimer(timerName, ProfilerZoneHash(timerName)) {}
+
+	// name must outlive the timer, it is not copied
+	const char* GetName() const { return name; }
 	spring_time GetDuration() const;
 
 protected:
 	const unsigned nameHash;
 	const spring_time startTime;
 
-	std::string name;
+	const char* name;
 };
 
 
@@ -48,21 +71,34 @@ protected:
 class ScopedTimer : public BasicTimer
 {
 public:
-	ScopedTimer(const std::string& timerName, bool _autoShowGraph = false, bool _specialTimer = false);
-	ScopedTimer(const char* timerName, bool _autoShowGraph = false, bool _specialTimer = false);
+	ScopedTimer(const char* timerName, unsigned timerHash, bool _autoShowGraph = false, bool _specialTimer = false);
+	ScopedTimer(const ProfilerZone& zone, bool _autoShowGraph = false, bool _specialTimer = false)
+		: ScopedTimer(zone.name, zone.hash, _autoShowGraph, _specialTimer)
+	{}
+	ScopedTimer(const char* timerName, bool _autoShowGraph = false, bool _specialTimer = false)
+		: ScopedTimer(timerName, ProfilerZoneHash(timerName), _autoShowGraph, _specialTimer)
+	{}
 	~ScopedTimer();
 
 private:
 	const bool autoShowGraph;
 	const bool specialTimer;
+
+	// true if an enclosing timer of this thread measures the same zone
+	bool nested;
 };
 
 
 class ScopedMtTimer : public BasicTimer
 {
 public:
-	ScopedMtTimer(const std::string& timerName, bool _autoShowGraph = false);
-	ScopedMtTimer(const char* timerName, bool _autoShowGraph = false);
+	ScopedMtTimer(const char* timerName, unsigned timerHash, bool _autoShowGraph = false);
+	ScopedMtTimer(const ProfilerZone& zone, bool _autoShowGraph = false)
+		: ScopedMtTimer(zone.name, zone.hash, _autoShowGraph)
+	{}
+	ScopedMtTimer(const char* timerName, bool _autoShowGraph = false)
+		: ScopedMtTimer(timerName, ProfilerZoneHash(timerName), _autoShowGraph)
+	{}
 	~ScopedMtTimer();
 
 private:
@@ -102,7 +138,7 @@ public:
 	float GetPercent(const char* name) const;
 	float GetPercentRaw(const char* name) const {
 		// do not default-create keys, breaks resorting
-		const auto it = profile.find(name);
+		const auto it = profile.find(ProfilerZoneHash(name));
 		if (it != profile.end())
 			return ((it->second).percent);
 		return 0.0f;
@@ -127,10 +163,13 @@ public:
 	void RefreshProfilesRaw();
 
 	void SetEnabled(bool b) { enabled = b; }
+	// name of the timer <hash> refers to, empty if it never ran
+	std::string GetTimerName(unsigned hash) const;
 	void PrintProfilingInfo() const;
 
 	void AddTime(
-		const std::string& name,
+		const char* name,
+		const unsigned hash,
 		const spring_time startTime,
 		const spring_time deltaTime,
 		const bool showGraph = false,
@@ -138,13 +177,24 @@ public:
 		const bool threadTimer = false
 	);
 	void AddTimeRaw(
-		const std::string& name,
+		const char* name,
+		const unsigned hash,
 		const spring_time startTime,
 		const spring_time deltaTime,
 		const bool showGraph,
 		const bool threadTimer
 	);
 
+	/**
+	 * Records every timer (from any thread) while the frames passed to
+	 * SetTraceFrame are within [begFrame, endFrame], then writes them to
+	 * fileName as Chrome trace-event JSON (chrome://tracing, Perfetto).
+	 */
+	void StartTrace(int begFrame, int endFrame, const std::string& fileName);
+	void SetTraceFrame(int frameNum);
+	bool IsTracing() const { return tracing.load(std::memory_order_relaxed); }
+	void AddTraceEvent(const char* name, unsigned hash, spring_time startTime, spring_time endTime);
+
 public:
 	struct TimeRecord {
 		TimeRecord()
@@ -179,7 +229,8 @@ public:
 		bool showGraph;
 	};
 
-	spring::unordered_map<std::string, TimeRecord> profile;
+	// keyed by ProfilerZoneHash of the timer names
+	spring::unordered_map<unsigned, TimeRecord> profile;
 
 	std::vector< std::pair<std::string, TimeRecord> > sortedProfile;
 	std::vector< std::deque< std::pair<spring_time, spring_time> > > threadProfile;
@@ -193,6 +244,16 @@ private:
 
 	// if false, AddTime is a no-op for (almost) all timers
 	std::atomic<bool> enabled;
+	// if true, timers also append to their thread's trace buffer
+	std::atomic<bool> tracing;
+
+	int traceBegFrame;
+	int traceEndFrame;
+
+	std::string traceFileName;
+
+private:
+	void WriteTrace();
 };
 
 #define profiler (CTimeProfiler::GetInstance())
@@ -255,3 +255,42 @@ float3 hs2rgb(float h, float s)
 	return col;
 }
 
+
+unsigned int EncodeNormalOct(const float3 n)
+{
+	const auto SignNotZero = [](const float v) { return ((v >= 0.0f)? 1.0f: -1.0f); };
+
+	const float invL1 = 1.0f / (math::fabs(n.x) + math::fabs(n.y) + math::fabs(n.z));
+
+	float u = n.x * invL1;
+	float v = n.z * invL1;
+
+	if (n.y < 0.0f) {
+		const float pu = u;
+		u = (1.0f - math::fabs(v )) * SignNotZero(pu);
+		v = (1.0f - math::fabs(pu)) * SignNotZero(v );
+	}
+
+	const short qu = Round(Clamp(u, -1.0f, 1.0f) * 32767.0f);
+	const short qv = Round(Clamp(v, -1.0f, 1.0f) * 32767.0f);
+
+	return ((unsigned short) qu) | (((unsigned int) ((unsigned short) qv)) << 16);
+}
+
+float3 DecodeNormalOct(const unsigned int enc)
+{
+	const auto SignNotZero = [](const float v) { return ((v >= 0.0f)? 1.0f: -1.0f); };
+
+	float3 n;
+	n.x = short(enc & 0xFFFF) / 32767.0f;
+	n.z = short(enc >>    16) / 32767.0f;
+	n.y = 1.0f - math::fabs(n.x) - math::fabs(n.z);
+
+	if (n.y < 0.0f) {
+		const float px = n.x;
+		n.x = (1.0f - math::fabs(n.z)) * SignNotZero(px );
+		n.z = (1.0f - math::fabs(px )) * SignNotZero(n.z);
+	}
+
+	return n.Normalize();
+}
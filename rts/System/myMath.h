@@ -158,6 +158,15 @@ float GetRadFromXY(const float dx, const float dy) _const;
 float3 hs2rgb(float h, float s) _pure _warn_unused_result;
 
 
+/**
+ * octahedral encoding of a unit vector into two 16-bit snorms (x in the
+ * low, z in the high half); the octahedron is folded along -y, so normals
+ * of the upper hemisphere (e.g. terrain) are represented most accurately
+ */
+unsigned int EncodeNormalOct(const float3 n) _pure _warn_unused_result;
+float3 DecodeNormalOct(const unsigned int enc) _pure _warn_unused_result;
+
+
 #include "myMath.inl"
 
 #undef _const
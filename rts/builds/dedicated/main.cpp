@@ -1,6 +1,9 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
+#include <algorithm>
+#include <memory>
 #include <string>
+#include <vector>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -11,6 +14,7 @@
 #include "Game/GameData.h"
 #include "Game/GameVersion.h"
 #include "Net/GameServer.h"
+#include "Net/GameServerHost.h"
 #include "System/Exceptions.h"
 #include "System/GlobalConfig.h"
 #include "System/GlobalRNG.h"
@@ -54,7 +58,7 @@ extern "C"
 {
 #endif
 
-void ParseCmdLine(int argc, char* argv[], std::string& scriptName)
+void ParseCmdLine(int argc, char* argv[], std::vector<std::string>& scriptNames)
 {
 	#undef  LOG_SECTION_CURRENT
 	#define LOG_SECTION_CURRENT LOG_SECTION_DEFAULT
@@ -71,10 +75,10 @@ void ParseCmdLine(int argc, char* argv[], std::string& scriptName)
 		exit(0);
 	}
 
-	if (argc >= 2)
-		scriptName = argv[1];
+	for (int i = 1; i < argc; i++)
+		scriptNames.push_back(argv[i]);
 
-	if (scriptName.empty() && !FLAGS_list_config_vars) {
+	if (scriptNames.empty() && !FLAGS_list_config_vars) {
 		gflags::ShowUsageWithFlags(argv[0]);
 		exit(1);
 	}
@@ -106,6 +110,60 @@ void ParseCmdLine(int argc, char* argv[], std::string& scriptName)
 
 
 
+static bool LoadGameSetup(
+	const std::string& scriptName,
+	CGlobalUnsyncedRNG& rng,
+	std::shared_ptr<ClientSetup> dsClientSetup,
+	std::shared_ptr<GameData> dsGameData,
+	std::shared_ptr<CGameSetup> dsGameSetup
+) {
+	std::string scriptText;
+	CFileHandler fh(scriptName);
+
+	if (!fh.FileExists())
+		throw content_error("script does not exist in given location: " + scriptName);
+
+	if (!fh.LoadStringData(scriptText))
+		throw content_error("script cannot be read: " + scriptName);
+
+	dsClientSetup->LoadFromStartScript(scriptText);
+
+	if (!dsGameSetup->Init(scriptText)) {
+		// read the script provided by cmdline
+		LOG_L(L_ERROR, "failed to load script %s", scriptName.c_str());
+		return false;
+	}
+
+	dsGameData->SetRandomSeed(rng.NextInt());
+
+	//  Use script provided hashes if they exist
+	if (dsGameSetup->mapHash != 0) {
+		dsGameData->SetMapChecksum(dsGameSetup->mapHash);
+		dsGameSetup->LoadStartPositions(false); // reduced mode
+	} else {
+		dsGameData->SetMapChecksum(archiveScanner->GetArchiveCompleteChecksum(dsGameSetup->mapName));
+
+		CFileHandler f("maps/" + dsGameSetup->mapName);
+		if (!f.FileExists())
+			vfsHandler->AddArchiveWithDeps(dsGameSetup->mapName, false);
+
+		dsGameSetup->LoadStartPositions(); // full mode
+	}
+
+	if (dsGameSetup->modHash != 0) {
+		dsGameData->SetModChecksum(dsGameSetup->modHash);
+	} else {
+		const std::string& modArchive = archiveScanner->ArchiveFromName(dsGameSetup->modName);
+		const unsigned int modCheckSum = archiveScanner->GetArchiveCompleteChecksum(modArchive);
+		dsGameData->SetModChecksum(modCheckSum);
+	}
+
+	dsGameData->SetSetupText(dsGameSetup->setupText);
+	return true;
+}
+
+
+
 int main(int argc, char* argv[])
 {
 	Threading::SetMainThread();
@@ -117,14 +175,13 @@ int main(int argc, char* argv[])
 
 		CLogOutput::LogSystemInfo();
 
-		std::string scriptName;
-		std::string scriptText;
+		std::vector<std::string> scriptNames;
 		std::string binaryName = argv[0];
 
-		gflags::SetUsageMessage("Usage: " + binaryName + " [options] path_to_script.txt");
+		gflags::SetUsageMessage("Usage: " + binaryName + " [options] path_to_script.txt [path_to_script2.txt ...]");
 		gflags::SetVersionString(SpringVersion::GetFull());
 		gflags::ParseCommandLineFlags(&argc, &argv, true);
-		ParseCmdLine(argc, argv, scriptName);
+		ParseCmdLine(argc, argv, scriptNames);
 
 		GlobalConfig::Instantiate();
 		FileSystemInitializer::InitializeLogOutput();
@@ -134,91 +191,94 @@ int main(int argc, char* argv[])
 		CrashHandler::Install();
 
 		LOG("report any errors to Mantis or the forums.");
-		LOG("loading script from file: %s", scriptName.c_str());
-
-		// server will take ownership of these
-		std::shared_ptr<ClientSetup> dsClientSetup(new ClientSetup());
-		std::shared_ptr<GameData> dsGameData(new GameData());
-		std::shared_ptr<CGameSetup> dsGameSetup(new CGameSetup());
-
-		CFileHandler fh(scriptName);
-
-		if (!fh.FileExists())
-			throw content_error("script does not exist in given location: " + scriptName);
 
-		if (!fh.LoadStringData(scriptText))
-			throw content_error("script cannot be read: " + scriptName);
+		std::vector< std::shared_ptr<ClientSetup> > dsClientSetups(scriptNames.size());
+		std::vector< std::shared_ptr<GameData> > dsGameDatas(scriptNames.size());
+		std::vector< std::shared_ptr<CGameSetup> > dsGameSetups(scriptNames.size());
 
-		dsClientSetup->LoadFromStartScript(scriptText);
-
-		if (!dsGameSetup->Init(scriptText)) {
-			// read the script provided by cmdline
-			LOG_L(L_ERROR, "failed to load script %s", scriptName.c_str());
-			return 1;
-		}
-
-		// Create the server, it will run in a separate thread
 		CGlobalUnsyncedRNG rng;
 
 		const unsigned sleepTime = FLAGS_sleeptime;
 		const unsigned randSeed = time(nullptr) % ((spring_gettime().toNanoSecsi() + 1) * 9007);
 
 		rng.Seed(randSeed);
-		dsGameData->SetRandomSeed(rng.NextInt());
 
-		//  Use script provided hashes if they exist
-		if (dsGameSetup->mapHash != 0) {
-			dsGameData->SetMapChecksum(dsGameSetup->mapHash);
-			dsGameSetup->LoadStartPositions(false); // reduced mode
-		} else {
-			dsGameData->SetMapChecksum(archiveScanner->GetArchiveCompleteChecksum(dsGameSetup->mapName));
+		for (size_t n = 0; n < scriptNames.size(); n++) {
+			LOG("loading script from file: %s", scriptNames[n].c_str());
 
-			CFileHandler f("maps/" + dsGameSetup->mapName);
-			if (!f.FileExists())
-				vfsHandler->AddArchiveWithDeps(dsGameSetup->mapName, false);
+			// server(s) will take ownership of these
+			dsClientSetups[n].reset(new ClientSetup());
+			dsGameDatas[n].reset(new GameData());
+			dsGameSetups[n].reset(new CGameSetup());
 
-			dsGameSetup->LoadStartPositions(); // full mode
+			if (!LoadGameSetup(scriptNames[n], rng, dsClientSetups[n], dsGameDatas[n], dsGameSetups[n]))
+				return 1;
 		}
 
-		if (dsGameSetup->modHash != 0) {
-			dsGameData->SetModChecksum(dsGameSetup->modHash);
-		} else {
-			const std::string& modArchive = archiveScanner->ArchiveFromName(dsGameSetup->modName);
-			const unsigned int modCheckSum = archiveScanner->GetArchiveCompleteChecksum(modArchive);
-			dsGameData->SetModChecksum(modCheckSum);
-		}
+		if (scriptNames.size() > 1) {
+			// several games: one process, one socket and server thread per
+			// distinct HostIP:HostPort (scripts not setting it share the default)
+			LOG("starting server for %u games...", unsigned(scriptNames.size()));
+
+			std::vector< std::unique_ptr<CGameServerHost> > serverHosts;
+			std::vector< std::pair<std::string, int> > hostAddrs;
 
-		LOG("starting server...");
+			for (size_t n = 0; n < scriptNames.size(); n++) {
+				const std::pair<std::string, int> hostAddr = {dsClientSetups[n]->hostIP, dsClientSetups[n]->hostPort};
+				const size_t hostIdx = std::find(hostAddrs.begin(), hostAddrs.end(), hostAddr) - hostAddrs.begin();
 
-		{
-			dsGameData->SetSetupText(dsGameSetup->setupText);
-			CGameServer server(dsClientSetup, dsGameData, dsGameSetup);
+				if (hostIdx == hostAddrs.size()) {
+					LOG("script %s: listening on %s:%d", scriptNames[n].c_str(), hostAddr.first.c_str(), hostAddr.second);
 
-			while (!server.HasGameID()) {
-				// wait until gameID has been generated or
-				// a timeout occurs (if no clients connect)
-				if (server.HasFinished())
-					break;
+					serverHosts.emplace_back(new CGameServerHost(hostAddr.second, hostAddr.first));
+					hostAddrs.push_back(hostAddr);
+				}
 
-				spring_sleep(spring_secs(sleepTime));
+				serverHosts[hostIdx]->AddGame(dsClientSetups[n], dsGameDatas[n], dsGameSetups[n]);
 			}
 
-			while (!server.HasFinished()) {
-				static bool printData = (server.GetDemoRecorder() != nullptr);
+			const auto HasFinished = [](const std::unique_ptr<CGameServerHost>& host) { return host->HasFinished(); };
 
-				if (printData) {
-					printData = false;
+			while (!std::all_of(serverHosts.begin(), serverHosts.end(), HasFinished)) {
+				spring_secs(sleepTime).sleep(true);
+			}
+		} else {
+			const std::shared_ptr<ClientSetup>& dsClientSetup = dsClientSetups[0];
+			const std::shared_ptr<GameData>& dsGameData = dsGameDatas[0];
+			const std::shared_ptr<CGameSetup>& dsGameSetup = dsGameSetups[0];
+
+			LOG("starting server...");
+
+			{
+				// Create the server, it will run in a separate thread
+				CGameServer server(dsClientSetup, dsGameData, dsGameSetup);
 
-					const std::unique_ptr<CDemoRecorder>& demoRec = server.GetDemoRecorder();
-					const std::uint8_t* gameID = (demoRec->GetFileHeader()).gameID;
+				while (!server.HasGameID()) {
+					// wait until gameID has been generated or
+					// a timeout occurs (if no clients connect)
+					if (server.HasFinished())
+						break;
 
-					LOG("recording demo: %s", (demoRec->GetName()).c_str());
-					LOG("using mod: %s", (dsGameSetup->modName).c_str());
-					LOG("using map: %s", (dsGameSetup->mapName).c_str());
-					LOG("GameID: %02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x", gameID[0], gameID[1], gameID[2], gameID[3], gameID[4], gameID[5], gameID[6], gameID[7], gameID[8], gameID[9], gameID[10], gameID[11], gameID[12], gameID[13], gameID[14], gameID[15]);
+					spring_sleep(spring_secs(sleepTime));
 				}
 
-				spring_secs(sleepTime).sleep(true);
+				while (!server.HasFinished()) {
+					static bool printData = (server.GetDemoRecorder() != nullptr);
+
+					if (printData) {
+						printData = false;
+
+						const std::unique_ptr<CDemoRecorder>& demoRec = server.GetDemoRecorder();
+						const std::uint8_t* gameID = (demoRec->GetFileHeader()).gameID;
+
+						LOG("recording demo: %s", (demoRec->GetName()).c_str());
+						LOG("using mod: %s", (dsGameSetup->modName).c_str());
+						LOG("using map: %s", (dsGameSetup->mapName).c_str());
+						LOG("GameID: %02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x", gameID[0], gameID[1], gameID[2], gameID[3], gameID[4], gameID[5], gameID[6], gameID[7], gameID[8], gameID[9], gameID[10], gameID[11], gameID[12], gameID[13], gameID[14], gameID[15]);
+					}
+
+					spring_secs(sleepTime).sleep(true);
+				}
 			}
 		}
 
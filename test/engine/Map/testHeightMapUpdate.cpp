@@ -0,0 +1,156 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "Map/HeightMapUpdate.h"
+#include "System/Platform/Threading.h"
+#include "System/Threading/ThreadPool.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#define BOOST_TEST_MODULE HeightMapUpdate
+#include <boost/test/unit_test.hpp>
+
+
+struct do_once {
+	do_once() { Threading::DetectCores(); ThreadPool::SetThreadCount(ThreadPool::GetMaxThreads()); }
+	~do_once() { ThreadPool::SetThreadCount(0); }
+};
+
+BOOST_GLOBAL_FIXTURE(do_once);
+
+
+static constexpr int NUM_MIPMAPS = 7;
+
+// owns one full set of derived heightmap fields
+struct HeightMapFields {
+	HeightMapFields(int x, int y)
+		: mapx(x)
+		, mapy(y)
+		, cornerHeightMap((x + 1) * (y + 1), 0.0f)
+		, faceNormals(2 * x * y)
+		, centerNormals(x * y)
+		, centerNormals2D(x * y)
+		, slopeMap((x / 2) * (y / 2), 0.0f)
+	{
+		for (int i = 0; i < NUM_MIPMAPS; i++) {
+			mipHeightMaps[i].resize((x >> i) * (y >> i), 0.0f);
+			mipPointers[i] = &mipHeightMaps[i][0];
+		}
+	}
+
+	HeightMapUpdate::Buffers GetBuffers() {
+		HeightMapUpdate::Buffers bufs;
+
+		bufs.mapx = mapx;
+		bufs.mapy = mapy;
+		bufs.numMipMaps = NUM_MIPMAPS;
+		bufs.cornerHeightMap = &cornerHeightMap[0];
+		bufs.mipHeightMaps = &mipPointers[0];
+		bufs.faceNormals = &faceNormals[0];
+		bufs.centerNormals = &centerNormals[0];
+		bufs.centerNormals2D = &centerNormals2D[0];
+		bufs.slopeMap = &slopeMap[0];
+		bufs.faceNormalsCopy = nullptr;
+		bufs.centerNormalsCopy = nullptr;
+		return bufs;
+	}
+
+	int mapx;
+	int mapy;
+
+	std::vector<float> cornerHeightMap;
+	std::vector<float> mipHeightMaps[NUM_MIPMAPS];
+	std::vector<float3> faceNormals;
+	std::vector<float3> centerNormals;
+	std::vector<float3> centerNormals2D;
+	std::vector<float> slopeMap;
+
+	float* mipPointers[NUM_MIPMAPS];
+};
+
+
+template<typename T>
+static bool BitIdentical(const std::vector<T>& a, const std::vector<T>& b)
+{
+	return (a.size() == b.size() && memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+static void CheckBitIdentical(const HeightMapFields& serial, const HeightMapFields& tiled)
+{
+	for (int i = 0; i < NUM_MIPMAPS; i++) {
+		BOOST_CHECK(BitIdentical(serial.mipHeightMaps[i], tiled.mipHeightMaps[i]));
+	}
+
+	BOOST_CHECK(BitIdentical(serial.faceNormals, tiled.faceNormals));
+	BOOST_CHECK(BitIdentical(serial.centerNormals, tiled.centerNormals));
+	BOOST_CHECK(BitIdentical(serial.centerNormals2D, tiled.centerNormals2D));
+	BOOST_CHECK(BitIdentical(serial.slopeMap, tiled.slopeMap));
+}
+
+
+BOOST_AUTO_TEST_CASE( TiledMatchesSerial )
+{
+	std::mt19937 rng(1234);
+
+	for (const int2 size: {int2(128, 128), int2(320, 192), int2(64, 512)}) {
+		HeightMapFields serial(size.x, size.y);
+		HeightMapFields tiled(size.x, size.y);
+
+		std::uniform_real_distribution<float> heightDist(-200.0f, 800.0f);
+
+		for (float& h: serial.cornerHeightMap) {
+			h = heightDist(rng);
+		}
+
+		tiled.cornerHeightMap = serial.cornerHeightMap;
+
+		const SRectangle mapRect = {0, 0, size.x - 1, size.y - 1};
+
+		HeightMapUpdate::UpdateSerial(serial.GetBuffers(), mapRect);
+		HeightMapUpdate::UpdateTiled(tiled.GetBuffers(), mapRect);
+		CheckBitIdentical(serial, tiled);
+
+		// deform random rectangles (including ones hugging the edges and
+		// tile borders) and update both copies incrementally
+		for (int n = 0; n < 200; n++) {
+			std::uniform_int_distribution<int> xDist(0, size.x - 1);
+			std::uniform_int_distribution<int> zDist(0, size.y - 1);
+			std::uniform_real_distribution<float> deltaDist(-50.0f, 50.0f);
+
+			int x1 = xDist(rng), x2 = xDist(rng);
+			int z1 = zDist(rng), z2 = zDist(rng);
+
+			if (x1 > x2) std::swap(x1, x2);
+			if (z1 > z2) std::swap(z1, z2);
+
+			// keep most updates small, like explosion craters
+			if ((n % 4) != 0) {
+				x2 = std::min(x2, x1 + 12);
+				z2 = std::min(z2, z1 + 12);
+			}
+
+			const float delta = deltaDist(rng);
+
+			for (int z = z1; z <= z2 + 1; z++) {
+				for (int x = x1; x <= x2 + 1; x++) {
+					serial.cornerHeightMap[z * (size.x + 1) + x] += delta * ((x + z) & 3);
+				}
+			}
+
+			tiled.cornerHeightMap = serial.cornerHeightMap;
+
+			// CReadMap expands the rectangle by one square before the update
+			const SRectangle rect = {
+				std::max(         0, x1 - 1),
+				std::max(         0, z1 - 1),
+				std::min(size.x - 1, x2 + 1),
+				std::min(size.y - 1, z2 + 1),
+			};
+
+			HeightMapUpdate::UpdateSerial(serial.GetBuffers(), rect);
+			HeightMapUpdate::UpdateTiled(tiled.GetBuffers(), rect);
+			CheckBitIdentical(serial, tiled);
+		}
+	}
+}
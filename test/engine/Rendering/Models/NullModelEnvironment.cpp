@@ -0,0 +1,80 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+// minimal stand-ins for what the model cache touches besides the format
+// itself: plain files instead of the VFS and no GL buffers
+
+#include "Rendering/GL/VBO.h"
+#include "Rendering/Models/3DModel.h"
+#include "Sim/Units/Unit.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileHandler.h"
+#include "System/FileSystem/FileSystem.h"
+
+
+DataDirsAccess dataDirsAccess;
+
+
+// cache-files are read from and written to the working directory
+CFileHandler::CFileHandler(const std::string& fileName, const std::string& modes)
+	: filePos(0)
+	, fileSize(-1)
+{
+	Open(fileName, modes);
+}
+
+void CFileHandler::Open(const std::string& fileName, const std::string& modes)
+{
+	this->fileName = fileName;
+	TryReadFromRawFS(fileName);
+}
+
+void CFileHandler::Close()
+{
+	ifs.close();
+	fileBuffer.clear();
+
+	filePos = 0;
+	fileSize = -1;
+}
+
+int CFileHandler::Read(void* buf, int length)
+{
+	ifs.read(static_cast<char*>(buf), length);
+	return (ifs.gcount());
+}
+
+bool CFileHandler::TryReadFromPWD(const std::string& fileName) { return false; }
+bool CFileHandler::TryReadFromRawFS(const std::string& fileName)
+{
+	ifs.open(fileName.c_str(), std::ios::in | std::ios::binary);
+
+	if (!ifs.good())
+		return false;
+
+	ifs.seekg(0, std::ios_base::end);
+	fileSize = ifs.tellg();
+	ifs.seekg(0, std::ios_base::beg);
+	return true;
+}
+bool CFileHandler::TryReadFromVFS(const std::string& fileName, int section) { return false; }
+
+const std::string& FileSystem::GetCacheDir() { static const std::string dir = "."; return dir; }
+bool FileSystem::CreateDirectory(std::string dir) { return true; }
+std::string FileSystem::GetDirectory(const std::string& path) { return (path.substr(0, path.find_last_of('/') + 1)); }
+std::string FileSystem::GetBasename(const std::string& path) { return (path.substr(path.find_last_of('/') + 1)); }
+std::string DataDirsAccess::LocateFile(std::string file, int flags) const { return file; }
+
+
+VBO::VBO(GLenum, bool, bool) {}
+void VBO::Bind(GLenum) const {}
+void VBO::Unbind() const {}
+void VBO::Delete() const {}
+void VBO::UnmapBuffer() {}
+
+float3 S3DModelPiece::GetEmitPos() const { return ZeroVector; }
+float3 S3DModelPiece::GetEmitDir() const { return FwdVector; }
+void S3DModel::DeleteBuffers() {}
+
+// only referenced by collision-volume queries against units and pieces
+CMatrix44f CUnit::GetTransformMatrix(bool synced, bool fullread) const { return CMatrix44f(); }
+void LocalModelPiece::UpdateParentMatricesRec() const {}
@@ -0,0 +1,180 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "Rendering/Models/AssCache.h"
+#include "Rendering/Models/AssParser.h"
+#include "Rendering/Models/3DModel.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_MODULE AssCache
+#include <boost/test/unit_test.hpp>
+
+
+static const std::string CACHE_FILE_NAME = "testAssCache.smc";
+
+
+// a model whose pieces are listed in the given order, parents[i] is the
+// index of the parent of piece i (-1 for none); pieces own a few vertices
+// and indices each so their ranges in the file differ
+static void CreateModel(S3DModel& model, const std::vector<int>& parents)
+{
+	model.name = "fixture.dae";
+
+	for (size_t i = 0; i < parents.size(); i++) {
+		SAssPiece* piece = new SAssPiece();
+
+		piece->name = "piece" + std::to_string(i);
+		piece->offset = float3(i * 1.0f, i * 2.0f, i * 3.0f);
+		piece->goffset = piece->offset * 2.0f;
+		piece->mins = float3(-1.0f, -1.0f, -1.0f) * (i + 1);
+		piece->maxs = float3( 1.0f,  1.0f,  1.0f) * (i + 1);
+		piece->SetNumTexCoorChannels(i % 2 + 1);
+
+		for (size_t n = 0; n <= i; n++) {
+			piece->vertices.emplace_back(float3(i, n, 0.0f), UpVector, FwdVector, RgtVector, float2(n * 0.5f, i * 0.5f), float2(), i);
+			piece->indices.push_back(n);
+		}
+
+		model.AddPiece(piece);
+	}
+
+	for (size_t i = 0; i < parents.size(); i++) {
+		if (parents[i] < 0)
+			continue;
+
+		S3DModelPiece* piece = model.GetPiece(i);
+
+		piece->parent = model.GetPiece(parents[i]);
+		piece->parent->children.push_back(piece);
+	}
+
+	model.numPieces = parents.size();
+	model.mins = float3(-10.0f, -20.0f, -30.0f);
+	model.maxs = float3( 10.0f,  20.0f,  30.0f);
+	model.relMidPos = float3(0.0f, 5.0f, 0.0f);
+	model.radius = 42.0f;
+	model.height = 60.0f;
+}
+
+static void DeletePieces(S3DModel& model)
+{
+	for (S3DModelPiece* piece: model.pieceObjects) {
+		delete piece;
+	}
+
+	model.pieceObjects.clear();
+}
+
+
+struct CacheFixture {
+	CacheFixture() {
+		key.modelCheckSum = 0x12345678;
+		key.metaCheckSum = 0x9abcdef0;
+		key.maxVertices = 1 << 16;
+		key.maxIndices = 1 << 20;
+	}
+	~CacheFixture() {
+		DeletePieces(srcModel);
+		DeletePieces(dstModel);
+
+		std::remove(CACHE_FILE_NAME.c_str());
+	}
+
+	AssCache::CacheKey key;
+
+	S3DModel srcModel;
+	S3DModel dstModel;
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(AssCacheSuite, CacheFixture)
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+	const std::vector<std::string> srcTextures = {"tex1.dds", "tex2.png"};
+	std::vector<std::string> dstTextures;
+
+	CreateModel(srcModel, {-1, 0, 0, 1});
+
+	BOOST_REQUIRE(AssCache::WriteModel(CACHE_FILE_NAME, key, &srcModel, srcTextures));
+	BOOST_REQUIRE(AssCache::ReadModel(CACHE_FILE_NAME, key, &dstModel, dstTextures));
+
+	BOOST_CHECK(dstTextures == srcTextures);
+	BOOST_CHECK_EQUAL(dstModel.numPieces, srcModel.numPieces);
+	BOOST_CHECK(dstModel.mins == srcModel.mins);
+	BOOST_CHECK(dstModel.maxs == srcModel.maxs);
+	BOOST_CHECK(dstModel.relMidPos == srcModel.relMidPos);
+	BOOST_CHECK_EQUAL(dstModel.radius, srcModel.radius);
+	BOOST_CHECK_EQUAL(dstModel.height, srcModel.height);
+	BOOST_REQUIRE_EQUAL(dstModel.pieceObjects.size(), srcModel.pieceObjects.size());
+
+	for (size_t i = 0; i < srcModel.pieceObjects.size(); i++) {
+		const SAssPiece* srcPiece = static_cast<const SAssPiece*>(srcModel.GetPiece(i));
+		const SAssPiece* dstPiece = static_cast<const SAssPiece*>(dstModel.GetPiece(i));
+
+		BOOST_CHECK_EQUAL(dstPiece->name, srcPiece->name);
+		BOOST_CHECK(dstPiece->offset == srcPiece->offset);
+		BOOST_CHECK(dstPiece->goffset == srcPiece->goffset);
+		BOOST_CHECK(dstPiece->mins == srcPiece->mins);
+		BOOST_CHECK(dstPiece->maxs == srcPiece->maxs);
+		BOOST_CHECK_EQUAL(dstPiece->GetNumTexCoorChannels(), srcPiece->GetNumTexCoorChannels());
+		BOOST_CHECK(dstPiece->indices == srcPiece->indices);
+		BOOST_REQUIRE_EQUAL(dstPiece->vertices.size(), srcPiece->vertices.size());
+
+		for (size_t n = 0; n < srcPiece->vertices.size(); n++) {
+			BOOST_CHECK(dstPiece->vertices[n].pos == srcPiece->vertices[n].pos);
+			BOOST_CHECK(dstPiece->vertices[n].texCoords[0] == srcPiece->vertices[n].texCoords[0]);
+			BOOST_CHECK_EQUAL(dstPiece->vertices[n].pieceIndex, srcPiece->vertices[n].pieceIndex);
+		}
+
+		BOOST_CHECK_EQUAL(dstPiece->HasParent(), srcPiece->HasParent());
+		BOOST_CHECK_EQUAL(dstPiece->children.size(), srcPiece->children.size());
+
+		if (srcPiece->HasParent())
+			BOOST_CHECK_EQUAL(dstPiece->parent->name, srcPiece->parent->name);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ChildBeforeParent)
+{
+	std::vector<std::string> textures;
+
+	// piece 1 is a child of piece 2
+	CreateModel(srcModel, {-1, 2, 0});
+
+	BOOST_REQUIRE(AssCache::WriteModel(CACHE_FILE_NAME, key, &srcModel, textures));
+	BOOST_REQUIRE(AssCache::ReadModel(CACHE_FILE_NAME, key, &dstModel, textures));
+	BOOST_REQUIRE_EQUAL(dstModel.pieceObjects.size(), 3);
+
+	BOOST_CHECK(dstModel.GetPiece(1)->parent == dstModel.GetPiece(2));
+	BOOST_CHECK(dstModel.GetPiece(2)->parent == dstModel.GetPiece(0));
+}
+
+BOOST_AUTO_TEST_CASE(RejectCycle)
+{
+	std::vector<std::string> textures;
+
+	// pieces 1 and 2 are each other's parent and unreachable from the root
+	CreateModel(srcModel, {-1, 2, 1});
+
+	BOOST_REQUIRE(AssCache::WriteModel(CACHE_FILE_NAME, key, &srcModel, textures));
+	BOOST_CHECK(!AssCache::ReadModel(CACHE_FILE_NAME, key, &dstModel, textures));
+	BOOST_CHECK(dstModel.pieceObjects.empty());
+}
+
+BOOST_AUTO_TEST_CASE(RejectOtherKey)
+{
+	std::vector<std::string> textures;
+
+	CreateModel(srcModel, {-1, 0});
+
+	BOOST_REQUIRE(AssCache::WriteModel(CACHE_FILE_NAME, key, &srcModel, textures));
+
+	key.maxVertices += 1;
+
+	BOOST_CHECK(!AssCache::ReadModel(CACHE_FILE_NAME, key, &dstModel, textures));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "Sim/Misc/TeamStatistics.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define BOOST_TEST_MODULE TeamStatisticsHistory
+#include <boost/test/unit_test.hpp>
+
+
+static bool Equal(const TeamStatistics& a, const TeamStatistics& b)
+{
+	return (memcmp(&a, &b, sizeof(TeamStatistics)) == 0);
+}
+
+static void Accumulate(TeamStatistics& stats, int frame)
+{
+	stats.frame = frame;
+
+	stats.metalUsed      += (rand() % 1000) * 0.37f;
+	stats.energyUsed     += (rand() % 1000) * 1.13f;
+	stats.metalProduced  += (rand() % 1000) * 0.41f;
+	stats.energyProduced += (rand() % 1000) * 2.71f;
+	stats.damageDealt    += ((rand() % 4) == 0)? 12345.678f: 0.0f;
+
+	stats.unitsProduced += rand() % 5;
+	stats.unitsDied     += rand() % 3;
+	stats.unitsKilled   += rand() % 3;
+	stats.unitsSent     -= rand() % 2; // deltas may also be negative
+}
+
+static void FillHistory(TeamStatisticsHistory& history, std::vector<TeamStatistics>& reference, unsigned int numEntries)
+{
+	srand(1234);
+
+	for (unsigned int i = 0; i < numEntries; ++i) {
+		Accumulate(history.GetCurrent(), i * 450);
+		reference.push_back(history.GetCurrent());
+		history.Commit();
+	}
+
+	Accumulate(history.GetCurrent(), numEntries * 450);
+	reference.push_back(history.GetCurrent());
+}
+
+
+BOOST_AUTO_TEST_CASE(RandomAccess)
+{
+	TeamStatisticsHistory history;
+	std::vector<TeamStatistics> reference;
+
+	BOOST_CHECK(history.size() == 1);
+
+	FillHistory(history, reference, 100);
+
+	BOOST_CHECK(history.size() == reference.size());
+
+	for (size_t i = 0; i < reference.size(); ++i) {
+		BOOST_CHECK(Equal(history.Get(i), reference[i]));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(Ranges)
+{
+	TeamStatisticsHistory history;
+	std::vector<TeamStatistics> reference;
+
+	FillHistory(history, reference, 3 * TeamStatisticsHistory::KEY_INTERVAL + 5);
+
+	const size_t ranges[][2] = {{0, 1}, {0, 100}, {5, 17}, {16, 32}, {30, reference.size()}, {reference.size() - 1, reference.size()}, {7, 3}};
+
+	for (const auto& range: ranges) {
+		std::vector<TeamStatistics> decoded;
+		history.GetRange(range[0], range[1], decoded);
+
+		const size_t end = std::min(range[1], reference.size());
+		const size_t num = (range[0] < end)? (end - range[0]): 0;
+
+		BOOST_CHECK(decoded.size() == num);
+
+		for (size_t i = 0; i < std::min(num, decoded.size()); ++i) {
+			BOOST_CHECK(Equal(decoded[i], reference[range[0] + i]));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(EncodedRoundTrip)
+{
+	TeamStatisticsHistory history;
+	std::vector<TeamStatistics> reference;
+	std::vector<std::uint8_t> encoded;
+	std::vector<TeamStatistics> decoded;
+
+	FillHistory(history, reference, 250);
+	history.GetEncoded(encoded);
+
+	BOOST_CHECK(encoded.size() < (reference.size() * sizeof(TeamStatistics)));
+	BOOST_CHECK(TeamStatisticsHistory::Decode(&encoded[0], encoded.size(), reference.size(), decoded));
+	BOOST_CHECK(decoded.size() == reference.size());
+
+	for (size_t i = 0; i < std::min(decoded.size(), reference.size()); ++i) {
+		BOOST_CHECK(Equal(decoded[i], reference[i]));
+	}
+
+	// truncated input must be detected
+	decoded.clear();
+	BOOST_CHECK(!TeamStatisticsHistory::Decode(&encoded[0], encoded.size() - 1, reference.size(), decoded));
+}
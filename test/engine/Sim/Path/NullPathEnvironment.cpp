@@ -0,0 +1,168 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+// minimal stand-ins for the engine globals the default pathfinder touches,
+// enough to build the estimators over a fixture map without loading a game
+
+#include "Game/GameVersion.h"
+#include "Game/LoadScreen.h"
+#include "Map/Ground.h"
+#include "Map/MapInfo.h"
+#include "Map/ReadMap.h"
+#include "Net/Protocol/BaseNetProtocol.h"
+#include "Net/Protocol/NetProtocol.h"
+#include "Sim/Misc/GlobalSynced.h"
+#include "Sim/Misc/GroundBlockingObjectMap.h"
+#include "Sim/Misc/ModInfo.h"
+#include "Sim/MoveTypes/MoveDefHandler.h"
+#include "Sim/Path/Default/PathHeatMap.hpp"
+#include "Sim/Units/Unit.h"
+#include "System/Config/ConfigHandler.h"
+#include "System/FileSystem/ArchiveLoader.h"
+#include "System/FileSystem/Archives/IArchive.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileSystem.h"
+
+#include <map>
+
+
+// answers every key with its registered default (or "0" for unregistered ones)
+class NullConfigHandler: public ConfigHandler {
+public:
+	void SetString(const std::string& key, const std::string& value, bool useOverlay) override { values[key] = value; }
+	std::string GetString(const std::string& key) const override {
+		const auto it = values.find(key);
+		const ConfigVariableMetaData* meta = ConfigVariable::GetMetaData(key);
+
+		if (it != values.end())
+			return it->second;
+		if (meta != nullptr && meta->GetDefaultValue().IsSet())
+			return (meta->GetDefaultValue().ToString());
+
+		return "0";
+	}
+
+	bool IsSet(const std::string& key) const override { return true; }
+	bool IsReadOnly(const std::string& key) const override { return false; }
+	void Delete(const std::string& key) override { values.erase(key); }
+	std::string GetConfigFile() const override { return ""; }
+	const std::map<std::string, std::string> GetData() const override { return values; }
+	std::map<std::string, std::string> GetDataWithoutDefaults() const override { return values; }
+	void Update() override {}
+	void EnableWriting(bool write) override {}
+
+protected:
+	void AddObserver(ConfigNotifyCallback callback, void* observer, const std::vector<std::string>& configs) override {}
+	void RemoveObserver(void* observer) override {}
+
+private:
+	std::map<std::string, std::string> values;
+};
+
+static NullConfigHandler nullConfigHandler;
+
+
+ConfigHandler* configHandler = &nullConfigHandler;
+CGlobalSynced* gs = nullptr;
+CNetProtocol* clientNet = nullptr;
+CReadMap* readMap = nullptr;
+const CMapInfo* mapInfo = nullptr;
+MoveDefHandler* moveDefHandler = nullptr;
+CGroundBlockingObjectMap* groundBlockingObjectMap = nullptr;
+CLoadScreen* CLoadScreen::singleton = nullptr;
+
+MapDimensions mapDims;
+CModInfo modInfo;
+DataDirsAccess dataDirsAccess;
+
+std::vector<float> CReadMap::centerHeightMap;
+std::vector<float> CReadMap::slopeMap;
+std::vector<uint8_t> CReadMap::typeMap;
+std::vector<float3> CReadMap::centerNormals2D;
+
+
+CGlobalSynced::CGlobalSynced(): frameNum(0), tempNum(1) {}
+CGlobalSynced::~CGlobalSynced() {}
+
+void CModInfo::ResetState() {
+	allowDirectionalPathing = false;
+	pfRawDistMult = 1.25f;
+	pfUpdateRate = 0.007f;
+}
+
+CMapInfo::CMapInfo(const std::string&, const std::string&) {}
+CMapInfo::~CMapInfo() {}
+
+CReadMap::CReadMap() {}
+CReadMap::~CReadMap() {}
+unsigned int CReadMap::CalcHeightmapChecksum() { return 0; }
+unsigned int CReadMap::CalcTypemapChecksum() { return 0; }
+
+// the fixture map is flat and has no water, so depth never matters
+float CGround::GetHeightReal(float x, float z, bool synced) { return 10.0f; }
+float CGround::GetHeightAboveWater(float x, float z, bool synced) { return (GetHeightReal(x, z, synced)); }
+float MoveDef::GetDepthMod(const float height) const { return 1.0f; }
+
+MoveDef::MoveDef()
+	: speedModClass(MoveDef::Tank)
+	, terrainClass(MoveDef::Mixed)
+	, xsize(0)
+	, xsizeh(0)
+	, zsize(0)
+	, zsizeh(0)
+	, depth(0.0f)
+	, maxSlope(1.0f)
+	, slopeMod(0.0f)
+	, crushStrength(0.0f)
+	, pathType(0)
+	, heatMod(0.0f)
+	, flowMod(1.0f)
+	, heatProduced(0)
+	, followGround(true)
+	, subMarine(false)
+	, avoidMobilesOnPath(false)
+	, allowTerrainCollisions(true)
+	, allowRawMovement(false)
+	, heatMapping(false)
+	, flowMapping(false)
+	, cacheBlockChecks(false)
+{
+	std::fill(std::begin(depthModParams), std::end(depthModParams), 0.0f);
+	std::fill(std::begin(speedModMults), std::end(speedModMults), 1.0f);
+}
+
+// one 3x3 tank-class MoveDef; the parser is never read
+MoveDefHandler::MoveDefHandler(LuaParser* defsParser): checksum(0) {
+	moveDefs.emplace_back();
+	moveDefs.back().name = "tank3";
+	moveDefs.back().xsize = 3;
+	moveDefs.back().zsize = 3;
+	moveDefs.back().xsizeh = 1;
+	moveDefs.back().zsizeh = 1;
+	moveDefs.back().maxSlope = 0.5f;
+}
+
+unsigned int CGroundBlockingObjectMap::CalcChecksum() const { return 0; }
+bool CUnit::IsIdle() const { return true; }
+
+PathHeatMap* PathHeatMap::GetInstance() { return nullptr; }
+float PathHeatMap::GetHeatCost(unsigned int x, unsigned int z, const MoveDef& md, unsigned int ownerID) const { return 0.0f; }
+
+void CLoadScreen::SetLoadMessage(const std::string& text, bool replace_lastline) {}
+CBaseNetProtocol::CBaseNetProtocol() {}
+CBaseNetProtocol& CBaseNetProtocol::Get() { static CBaseNetProtocol instance; return instance; }
+CBaseNetProtocol::PacketType CBaseNetProtocol::SendCPUUsage(float cpuUsage) { return nullptr; }
+void CNetProtocol::Send(std::shared_ptr<const netcode::RawPacket> pkt) {}
+
+// no path-cache files are ever read or written
+const std::string& FileSystem::GetCacheDir() { static const std::string dir; return dir; }
+bool FileSystem::FileExists(std::string path) { return false; }
+bool FileSystem::CreateDirectory(std::string dir) { return false; }
+bool FileSystem::Remove(std::string file) { return false; }
+std::string DataDirsAccess::LocateFile(std::string file, int flags) const { return file; }
+CArchiveLoader::CArchiveLoader() {}
+CArchiveLoader::~CArchiveLoader() {}
+CArchiveLoader& CArchiveLoader::GetInstance() { static CArchiveLoader instance; return instance; }
+IArchive* CArchiveLoader::OpenArchive(const std::string& fileName, const std::string& type) const { return nullptr; }
+unsigned int IArchive::FindFile(const std::string& filePath) const { return 0; }
+
+const std::string& SpringVersion::GetMajor() { static const std::string major = "0"; return major; }
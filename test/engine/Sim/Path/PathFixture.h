@@ -0,0 +1,151 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef PATH_FIXTURE_H
+#define PATH_FIXTURE_H
+
+#include "Map/MapInfo.h"
+#include "Map/ReadMap.h"
+#include "Sim/Misc/GlobalSynced.h"
+#include "Sim/Misc/GroundBlockingObjectMap.h"
+#include "Sim/MoveTypes/MoveDefHandler.h"
+#include "Sim/Path/Default/PathConstants.h"
+#include "Sim/Path/Default/PathEstimator.h"
+#include "Sim/Path/Default/PathFinder.h"
+#include "Sim/Path/Default/PathFinderDef.h"
+#include "Sim/Path/Default/PathMemPool.h"
+#include "System/Platform/Threading.h"
+
+#include <vector>
+
+
+static constexpr int MAP_SIZE = 512;
+static constexpr float MAP_HEIGHT = 10.0f;
+
+class FixtureReadMap: public CReadMap {
+public:
+	FixtureReadMap() {
+		mipHeightMap.resize(mapDims.hmapx * mapDims.hmapy, MAP_HEIGHT);
+		mipPointerHeightMaps.fill(nullptr);
+		mipPointerHeightMaps[1] = &mipHeightMap[0];
+
+		centerHeightMap.resize(mapDims.mapx * mapDims.mapy, MAP_HEIGHT);
+		centerNormals2D.resize(mapDims.mapx * mapDims.mapy, UpVector);
+		slopeMap.resize(mapDims.hmapx * mapDims.hmapy, 0.0f);
+		typeMap.resize(mapDims.hmapx * mapDims.hmapy, 0);
+	}
+
+	// marks the squares in [x1, x2) x [z1, z2) as too steep for the fixture MoveDef
+	void AddWall(int x1, int z1, int x2, int z2) {
+		for (int z = z1 >> 1; z < (z2 >> 1); z++) {
+			for (int x = x1 >> 1; x < (x2 >> 1); x++) {
+				slopeMap[x + z * mapDims.hmapx] = 1.0f;
+			}
+		}
+	}
+
+	void UpdateHeightMapUnsynced(const SRectangle&) override {}
+	void InitGroundDrawer() override {}
+	void KillGroundDrawer() override {}
+	unsigned int GetShadingTexture() const override { return 0; }
+	void DrawMinimap() const override {}
+	int GetNumFeatures() override { return 0; }
+	int GetNumFeatureTypes() override { return 0; }
+	void GetFeatureInfo(MapFeatureInfo* f) override {}
+	const char* GetFeatureTypeName(int typeID) override { return ""; }
+	unsigned char* GetInfoMap(const std::string& name, MapBitmapInfo* bm) override { return nullptr; }
+	void FreeInfoMap(const std::string& name, unsigned char* data) override {}
+	void GridVisibility(CCamera* cam, IQuadDrawer* cb, float maxDist, int quadSize, int extraSize) override {}
+
+private:
+	std::vector<float> mipHeightMap;
+};
+
+
+// a flat map with a long wall (passable only at its far end), a sealed
+// pocket and a small walled cup whose interior is not reachable from the
+// node of the block containing it
+struct PathFixture {
+	PathFixture() {
+		Threading::SetMainThread();
+
+		mapDims.mapx = MAP_SIZE;
+		mapDims.mapy = MAP_SIZE;
+		mapDims.Initialize();
+
+		float3::maxxpos = mapDims.mapx * SQUARE_SIZE - 1;
+		float3::maxzpos = mapDims.mapy * SQUARE_SIZE - 1;
+
+		fixtureReadMap = new FixtureReadMap();
+		fixtureReadMap->AddWall(160, 0, 176, 400);
+		fixtureReadMap->AddWall(344, 344, 424, 352);
+		fixtureReadMap->AddWall(344, 416, 424, 424);
+		fixtureReadMap->AddWall(344, 344, 352, 424);
+		fixtureReadMap->AddWall(416, 344, 424, 424);
+		fixtureReadMap->AddWall( 96, 444, 112, 448);
+		fixtureReadMap->AddWall( 96, 460, 112, 464);
+		fixtureReadMap->AddWall( 96, 444, 100, 464);
+		fixtureReadMap->AddWall(108, 444, 112, 464);
+
+		fixtureMapInfo = new CMapInfo("", "");
+		fixtureMapInfo->terrainTypes[0].tankSpeed = 1.0f;
+
+		readMap = fixtureReadMap;
+		mapInfo = fixtureMapInfo;
+		gs = new CGlobalSynced();
+		moveDefHandler = new MoveDefHandler(nullptr);
+		groundBlockingObjectMap = new CGroundBlockingObjectMap(mapDims.mapSquares);
+
+		IPathFinder::InitStatic();
+		CPathFinder::InitStatic();
+
+		maxResPF = pfMemPool.alloc<CPathFinder>(false);
+		medResPE = peMemPool.alloc<CPathEstimator>(maxResPF, MEDRES_PE_BLOCKSIZE, "pe",  "fixture");
+		lowResPE = peMemPool.alloc<CPathEstimator>(medResPE, LOWRES_PE_BLOCKSIZE, "pe2", "fixture");
+	}
+
+	~PathFixture() {
+		peMemPool.free(lowResPE);
+		peMemPool.free(medResPE);
+		pfMemPool.free(maxResPF);
+
+		IPathFinder::KillStatic();
+
+		delete groundBlockingObjectMap;
+		delete moveDefHandler;
+		delete gs;
+		delete fixtureMapInfo;
+		delete fixtureReadMap;
+	}
+
+	// same settings as the low-res search in CPathManager::ArrangePath
+	static CCircularSearchConstraint MakePathDef(const float3& startPos, const float3& goalPos) {
+		CCircularSearchConstraint peDef(startPos, goalPos, PATH_NODE_SPACING * SQUARE_SIZE, 3.0f, 2000);
+		peDef.DisableConstraint(true);
+		peDef.AllowRawPathSearch(false);
+		return peDef;
+	}
+
+	IPath::SearchResult GetEstimatorPath(const float3& startPos, const float3& goalPos, IPath::Path& path) {
+		CCircularSearchConstraint peDef = MakePathDef(startPos, goalPos);
+		return (lowResPE->GetPath(*moveDefHandler->GetMoveDefByPathType(0), peDef, nullptr, startPos, path, MAX_SEARCHED_NODES_PE >> 3));
+	}
+
+	// the estimator's cost also includes the heuristic from its goal-node to the goal
+	static float GetEstimatorPathCost(const float3& startPos, const float3& goalPos, const IPath::Path& path) {
+		const CCircularSearchConstraint peDef = MakePathDef(startPos, goalPos);
+		const float3& goalNode = path.path.front();
+
+		return (path.pathCost - peDef.Heuristic(goalNode.x / SQUARE_SIZE, goalNode.z / SQUARE_SIZE, LOWRES_PE_BLOCKSIZE));
+	}
+
+	FixtureReadMap* fixtureReadMap;
+	CMapInfo* fixtureMapInfo;
+
+	CPathFinder* maxResPF;
+	CPathEstimator* medResPE;
+	CPathEstimator* lowResPE;
+};
+
+static float3 SquarePos(int x, int z) { return (float3(x * SQUARE_SIZE, MAP_HEIGHT, z * SQUARE_SIZE)); }
+
+#endif
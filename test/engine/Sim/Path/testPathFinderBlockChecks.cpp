@@ -0,0 +1,99 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "PathFixture.h"
+#include "System/Misc/SpringTime.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#define BOOST_TEST_MODULE PathFinderBlockChecks
+#include <boost/test/unit_test.hpp>
+
+BOOST_GLOBAL_FIXTURE(InitSpringTime);
+
+static constexpr unsigned int NUM_SEARCHES = 500;
+static constexpr unsigned int NUM_ROUNDS = 5;
+static constexpr int MAX_SEARCH_DIST = 96;
+
+
+struct BlockChecksFixture: public PathFixture {
+	BlockChecksFixture() {
+		std::mt19937 rng(1234);
+		std::uniform_int_distribution<int> posDist(8, MAP_SIZE - 8);
+		std::uniform_int_distribution<int> offDist(-MAX_SEARCH_DIST, MAX_SEARCH_DIST);
+
+		// max-res searches span a few waypoints, not the whole map
+		for (unsigned int n = 0; n < NUM_SEARCHES; n++) {
+			const int sx = posDist(rng);
+			const int sz = posDist(rng);
+			const int gx = Clamp(sx + offDist(rng), 8, MAP_SIZE - 8);
+			const int gz = Clamp(sz + offDist(rng), 8, MAP_SIZE - 8);
+
+			searches.emplace_back(SquarePos(sx, sz), SquarePos(gx, gz));
+		}
+	}
+
+	// runs every search once, returns the total time spent in the finder
+	spring_time RunSearches(bool cacheBlockChecks, std::vector<IPath::Path>& paths, std::vector<IPath::SearchResult>& results) {
+		MoveDef* moveDef = moveDefHandler->GetMoveDefByPathType(0);
+		moveDef->cacheBlockChecks = cacheBlockChecks;
+
+		paths.clear();
+		paths.resize(searches.size());
+		results.clear();
+		results.resize(searches.size());
+
+		const spring_time t0 = spring_gettime();
+
+		for (size_t n = 0; n < searches.size(); n++) {
+			CCircularSearchConstraint pfDef(searches[n].first, searches[n].second, 0.0f, 2.0f, 1000);
+			pfDef.DisableConstraint(true);
+			pfDef.AllowRawPathSearch(false);
+
+			results[n] = maxResPF->GetPath(*moveDef, pfDef, nullptr, searches[n].first, paths[n], MAX_SEARCHED_NODES_PF >> 3);
+		}
+
+		return (spring_gettime() - t0);
+	}
+
+	std::vector< std::pair<float3, float3> > searches;
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(PathFinderBlockChecksSuite, BlockChecksFixture)
+
+BOOST_AUTO_TEST_CASE(CachedMatchesUncached)
+{
+	std::vector<IPath::Path> uncachedPaths;
+	std::vector<IPath::Path> cachedPaths;
+	std::vector<IPath::SearchResult> uncachedResults;
+	std::vector<IPath::SearchResult> cachedResults;
+
+	spring_time uncachedTime = spring_notime;
+	spring_time cachedTime = spring_notime;
+
+	// warm up the finder's buffers so neither pass pays for them, then keep
+	// the best of several alternating rounds to filter out scheduling noise
+	RunSearches(true, cachedPaths, cachedResults);
+
+	for (unsigned int n = 0; n < NUM_ROUNDS; n++) {
+		const spring_time ut = RunSearches(false, uncachedPaths, uncachedResults);
+		const spring_time ct = RunSearches(true, cachedPaths, cachedResults);
+
+		uncachedTime = (n == 0)? ut: std::min(uncachedTime, ut);
+		cachedTime = (n == 0)? ct: std::min(cachedTime, ct);
+	}
+
+	for (size_t n = 0; n < searches.size(); n++) {
+		BOOST_CHECK_EQUAL(cachedResults[n], uncachedResults[n]);
+		BOOST_CHECK_EQUAL(cachedPaths[n].pathCost, uncachedPaths[n].pathCost);
+		BOOST_CHECK(cachedPaths[n].squares == uncachedPaths[n].squares);
+	}
+
+	BOOST_TEST_MESSAGE("max-res searches: " << searches.size());
+	BOOST_TEST_MESSAGE("uncached block-checks: " << uncachedTime.toMilliSecsf() << "ms");
+	BOOST_TEST_MESSAGE("cached block-checks:   " << cachedTime.toMilliSecsf() << "ms");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
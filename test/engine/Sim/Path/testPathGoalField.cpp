@@ -0,0 +1,118 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "PathFixture.h"
+#include "Sim/Path/Default/PathGoalField.hpp"
+
+#include <map>
+#include <random>
+
+#define BOOST_TEST_MODULE PathGoalField
+#include <boost/test/unit_test.hpp>
+
+
+struct GoalFieldFixture: public PathFixture {
+	IPath::SearchResult GetGoalFieldPath(const float3& startPos, const float3& goalPos, IPath::Path& path) {
+		const MoveDef& moveDef = *moveDefHandler->GetMoveDefByPathType(0);
+		const int2 goalBlock = {
+			int(goalPos.x / SQUARE_SIZE) / int(LOWRES_PE_BLOCKSIZE),
+			int(goalPos.z / SQUARE_SIZE) / int(LOWRES_PE_BLOCKSIZE),
+		};
+
+		PathGoalField& goalField = goalFields[PathGoalField::GetKey(goalBlock, moveDef.pathType)];
+
+		if (!goalField.IsValid()) {
+			goalField.Init(goalBlock, moveDef.pathType);
+			goalField.Calc(lowResPE, moveDef);
+		}
+
+		CCircularSearchConstraint peDef = MakePathDef(startPos, goalPos);
+		return (goalField.GetPath(lowResPE, moveDef, peDef, nullptr, path));
+	}
+
+	std::map<std::uint64_t, PathGoalField> goalFields;
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(PathGoalFieldSuite, GoalFieldFixture)
+
+BOOST_AUTO_TEST_CASE(DetourAroundWall)
+{
+	const float3 startPos = SquarePos( 40, 40);
+	const float3 goalPos  = SquarePos(300, 40);
+
+	IPath::Path estPath;
+	IPath::Path gfPath;
+
+	BOOST_REQUIRE_EQUAL(GetEstimatorPath(startPos, goalPos, estPath), IPath::Ok);
+	BOOST_REQUIRE_EQUAL(GetGoalFieldPath(startPos, goalPos, gfPath), IPath::Ok);
+
+	BOOST_CHECK(estPath.path.front() == gfPath.path.front());
+	BOOST_CHECK(estPath.path.back() == gfPath.path.back());
+	BOOST_CHECK_CLOSE(GetEstimatorPathCost(startPos, goalPos, estPath), gfPath.pathCost, 0.01f);
+	BOOST_CHECK(gfPath.pathGoal == goalPos);
+}
+
+BOOST_AUTO_TEST_CASE(UnreachableGoal)
+{
+	// inside the cup; the node of its block lies outside
+	const float3 startPos = SquarePos( 40, 40);
+	const float3 goalPos  = SquarePos(104, 454);
+
+	IPath::Path estPath;
+	IPath::Path gfPath;
+
+	BOOST_CHECK_NE(GetEstimatorPath(startPos, goalPos, estPath), IPath::Ok);
+	BOOST_CHECK_NE(GetGoalFieldPath(startPos, goalPos, gfPath), IPath::Ok);
+}
+
+BOOST_AUTO_TEST_CASE(LockedInStart)
+{
+	const float3 startPos = SquarePos(384, 384);
+	const float3 goalPos  = SquarePos( 40,  40);
+
+	IPath::Path estPath;
+	IPath::Path gfPath;
+
+	BOOST_CHECK_NE(GetEstimatorPath(startPos, goalPos, estPath), IPath::Ok);
+	BOOST_CHECK_NE(GetGoalFieldPath(startPos, goalPos, gfPath), IPath::Ok);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesEstimator)
+{
+	std::mt19937 rng(1234);
+	std::uniform_int_distribution<int> dist(8, MAP_SIZE - 8);
+
+	unsigned int numServed = 0;
+	unsigned int numTested = 0;
+
+	for (numTested = 0; numTested < 250; numTested++) {
+		const float3 startPos = SquarePos(dist(rng), dist(rng));
+		const float3 goalPos  = SquarePos(dist(rng), dist(rng));
+
+		IPath::Path estPath;
+		IPath::Path gfPath;
+
+		const IPath::SearchResult estResult = GetEstimatorPath(startPos, goalPos, estPath);
+		const IPath::SearchResult gfResult = GetGoalFieldPath(startPos, goalPos, gfPath);
+
+		// Error means the request would be passed on to the estimator
+		if (gfResult == IPath::Error)
+			continue;
+
+		BOOST_CHECK_EQUAL(gfResult, estResult);
+
+		if (gfResult != IPath::Ok || estResult != IPath::Ok)
+			continue;
+
+		BOOST_CHECK(estPath.path.front() == gfPath.path.front());
+		BOOST_CHECK(estPath.path.back() == gfPath.path.back());
+		BOOST_CHECK_CLOSE(GetEstimatorPathCost(startPos, goalPos, estPath), gfPath.pathCost, 0.01f);
+
+		numServed += 1;
+	}
+
+	// most requests on this map should not need a fallback
+	BOOST_CHECK_GT(numServed, numTested / 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
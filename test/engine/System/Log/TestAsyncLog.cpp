@@ -0,0 +1,226 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "System/Log/ILog.h"
+#include "System/Log/Backend.h"
+#include "System/Log/FileSink.h"
+
+#define BOOST_TEST_MODULE AsyncLog
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace {
+	struct TempLogFile {
+		TempLogFile() {
+			char* tmpName = tmpnam(NULL);
+			BOOST_REQUIRE_MESSAGE((tmpName != NULL), "Failed to fetch a temporary log file name");
+
+			filePath = tmpName;
+			log_file_addLogFile(filePath.c_str(), NULL, LOG_LEVEL_ALL, LOG_LEVEL_NONE);
+		}
+		~TempLogFile() {
+			log_backend_setAsync(false);
+			log_file_removeLogFile(filePath.c_str());
+			remove(filePath.c_str());
+		}
+
+		std::vector<std::string> ReadLines() const {
+			std::vector<std::string> lines;
+
+			fflush(log_file_getLogFileStream(filePath.c_str()));
+			FILE* file = fopen(filePath.c_str(), "r");
+
+			if (file == NULL)
+				return lines;
+
+			char line[1024 * 4];
+
+			while (fgets(line, sizeof(line), file) != NULL) {
+				line[strcspn(line, "\r\n")] = '\0';
+				lines.emplace_back(line);
+			}
+
+			fclose(file);
+			return lines;
+		}
+
+		std::string filePath;
+	};
+
+	double LogRecordsPerSecond(int numThreads, int numRecords) {
+		const auto t0 = std::chrono::high_resolution_clock::now();
+
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < numThreads; ++t) {
+			threads.emplace_back([=]() {
+				for (int i = 0; i < numRecords; ++i) {
+					LOG("bench thread %d record %d", t, i);
+				}
+			});
+		}
+
+		for (std::thread& t: threads)
+			t.join();
+
+		const auto t1 = std::chrono::high_resolution_clock::now();
+		return (numThreads * numRecords) / std::chrono::duration<double>(t1 - t0).count();
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(OrderAndCompleteness)
+{
+	TempLogFile logFile;
+	log_backend_setAsync(true);
+	BOOST_CHECK(log_backend_isAsync());
+
+	const int numRecords = 10000;
+
+	for (int i = 0; i < numRecords; ++i) {
+		// every 100th record exceeds the inline buffer of a ring slot
+		if ((i % 100) == 0) {
+			LOG("record %d %s", i, std::string(1000, 'x').c_str());
+		} else {
+			LOG("record %d", i);
+		}
+	}
+
+	log_backend_flushAsync();
+
+	const std::vector<std::string> lines = logFile.ReadLines();
+	BOOST_REQUIRE_EQUAL(lines.size(), numRecords);
+
+	for (int i = 0; i < numRecords; ++i) {
+		int n = -1;
+		BOOST_CHECK(sscanf(lines[i].c_str(), "%*s record %d", &n) == 1 || sscanf(lines[i].c_str(), "record %d", &n) == 1);
+		BOOST_CHECK_EQUAL(n, i);
+	}
+
+	log_async_stats_t stats;
+	log_backend_getAsyncStats(&stats);
+	BOOST_CHECK_EQUAL(stats.numQueued, stats.numWritten);
+	BOOST_CHECK_GE(stats.numQueued, numRecords);
+	BOOST_CHECK_GE(stats.numOversized, numRecords / 100);
+	BOOST_CHECK_LE(stats.maxQueueDepth, stats.queueSize);
+}
+
+
+BOOST_AUTO_TEST_CASE(PerThreadOrder)
+{
+	TempLogFile logFile;
+	log_backend_setAsync(true);
+
+	const int numThreads = 4;
+	const int numRecords = 5000;
+
+	LogRecordsPerSecond(numThreads, numRecords);
+	log_backend_flushAsync();
+
+	// records of different threads interleave, those of one thread stay ordered
+	std::vector<int> nextRecord(numThreads, 0);
+
+	for (const std::string& line: logFile.ReadLines()) {
+		const char* str = strstr(line.c_str(), "bench thread");
+		int t = -1;
+		int i = -1;
+
+		BOOST_REQUIRE(str != NULL && sscanf(str, "bench thread %d record %d", &t, &i) == 2);
+		BOOST_REQUIRE(t >= 0 && t < numThreads);
+		BOOST_CHECK_EQUAL(i, nextRecord[t]++);
+	}
+
+	for (int t = 0; t < numThreads; ++t) {
+		BOOST_CHECK_EQUAL(nextRecord[t], numRecords);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(DisableDrainsQueue)
+{
+	TempLogFile logFile;
+	log_backend_setAsync(true);
+
+	for (int i = 0; i < 1000; ++i) {
+		LOG("record %d", i);
+	}
+
+	log_backend_setAsync(false);
+	BOOST_CHECK(!log_backend_isAsync());
+	BOOST_CHECK_EQUAL(logFile.ReadLines().size(), 1000);
+
+	// synchronous records are written immediately
+	LOG("record %d", 1000);
+	BOOST_CHECK_EQUAL(logFile.ReadLines().size(), 1001);
+}
+
+
+BOOST_AUTO_TEST_CASE(PerThreadOrderAcrossDisable)
+{
+	TempLogFile logFile;
+	log_backend_setAsync(true);
+
+	const int numThreads = 4;
+	const int numRecords = 5000;
+
+	// records sunk synchronously while the queue is still being drained
+	// must neither overtake queued ones nor interleave with them
+	std::thread logThread([&]() { LogRecordsPerSecond(numThreads, numRecords); });
+	std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	log_backend_setAsync(false);
+	logThread.join();
+
+	std::vector<int> nextRecord(numThreads, 0);
+
+	for (const std::string& line: logFile.ReadLines()) {
+		const char* str = strstr(line.c_str(), "bench thread");
+		int t = -1;
+		int i = -1;
+
+		BOOST_REQUIRE(str != NULL && sscanf(str, "bench thread %d record %d", &t, &i) == 2);
+		BOOST_REQUIRE(t >= 0 && t < numThreads);
+		BOOST_CHECK_EQUAL(i, nextRecord[t]++);
+	}
+
+	for (int t = 0; t < numThreads; ++t) {
+		BOOST_CHECK_EQUAL(nextRecord[t], numRecords);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(Throughput)
+{
+	const int numThreads = 4;
+	const int numRecords = 20000;
+
+	double syncRate = 0.0;
+	double asyncRate = 0.0;
+
+	{
+		TempLogFile logFile;
+		syncRate = LogRecordsPerSecond(numThreads, numRecords);
+	}
+	{
+		TempLogFile logFile;
+		log_backend_setAsync(true);
+		asyncRate = LogRecordsPerSecond(numThreads, numRecords);
+		log_backend_flushAsync();
+	}
+
+	log_async_stats_t stats;
+	log_backend_getAsyncStats(&stats);
+
+	printf("\tsync:  %.0f records/sec\n", syncRate);
+	printf("\tasync: %.0f records/sec (%llu stalls, max. queue depth %u/%u)\n", asyncRate, stats.numStalls, stats.maxQueueDepth, stats.queueSize);
+
+	BOOST_CHECK(syncRate > 0.0);
+	BOOST_CHECK(asyncRate > 0.0);
+}
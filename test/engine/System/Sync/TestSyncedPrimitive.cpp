@@ -38,3 +38,43 @@ BOOST_AUTO_TEST_CASE(ImplicitConversions)
 
 	LEAVE_SYNCED_CODE();
 }
+
+BOOST_AUTO_TEST_CASE(SyncLanes)
+{
+	ENTER_SYNCED_CODE();
+	CSyncChecker::NewFrame();
+
+	std::uint32_t laneSums[CSyncChecker::NUM_SYNC_LANES];
+
+	SyncedSint si = 0;
+	{
+		SCOPED_SYNC_LANE(SYNC_LANE_UNITS);
+		si = 42;
+	}
+	CSyncChecker::FinishFrame(0);
+
+	BOOST_CHECK(CSyncChecker::GetFrameLanes(0, laneSums));
+	BOOST_CHECK(laneSums[CSyncChecker::SYNC_LANE_UNITS] != 0);
+	BOOST_CHECK(laneSums[CSyncChecker::SYNC_LANE_PATH] == 0);
+	BOOST_CHECK(!CSyncChecker::GetFrameLanes(1, laneSums));
+
+	const unsigned checksum = CSyncChecker::GetChecksum();
+
+	// the same assignment hashed into another lane must change the frame checksum
+	CSyncChecker::NewFrame();
+	{
+		SCOPED_SYNC_LANE(SYNC_LANE_PATH);
+		si = 42;
+	}
+	CSyncChecker::FinishFrame(0);
+
+	BOOST_CHECK(CSyncChecker::GetFrameLanes(0, laneSums));
+	BOOST_CHECK(laneSums[CSyncChecker::SYNC_LANE_UNITS] == 0);
+	BOOST_CHECK(CSyncChecker::GetChecksum() != checksum);
+
+	// frames older than the history size are dropped
+	CSyncChecker::FinishFrame(CSyncChecker::SYNC_LANE_HISTORY);
+	BOOST_CHECK(!CSyncChecker::GetFrameLanes(0, laneSums));
+
+	LEAVE_SYNCED_CODE();
+}
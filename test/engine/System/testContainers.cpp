@@ -0,0 +1,140 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "System/RingDeque.h"
+#include "System/SmallVector.h"
+
+#include <algorithm>
+#include <deque>
+#include <string>
+
+#define BOOST_TEST_MODULE Containers
+#include <boost/test/unit_test.hpp>
+
+
+BOOST_AUTO_TEST_CASE( SmallVectorInlineAndSpill )
+{
+	spring::small_vector<float, 4> v;
+
+	for (int i = 0; i < 4; i++) {
+		v.push_back(i);
+	}
+
+	BOOST_CHECK_EQUAL(v.size(), 4);
+	BOOST_CHECK_EQUAL(v.capacity(), 4);
+
+	// spills onto the heap, contents must survive
+	for (int i = 4; i < 20; i++) {
+		v.push_back(i);
+	}
+
+	BOOST_CHECK_EQUAL(v.size(), 20);
+
+	for (int i = 0; i < 20; i++) {
+		BOOST_CHECK_EQUAL(v[i], float(i));
+	}
+
+	// pushing an own element across the growth boundary
+	while (v.size() < v.capacity())
+		v.push_back(0.0f);
+
+	v.push_back(v[1]);
+	BOOST_CHECK_EQUAL(v.back(), 1.0f);
+
+	v.erase(v.begin(), v.begin() + 2);
+	BOOST_CHECK_EQUAL(v[0], 2.0f);
+
+	v.insert(v.begin(), -1.0f);
+	BOOST_CHECK_EQUAL(v[0], -1.0f);
+	BOOST_CHECK_EQUAL(v[1], 2.0f);
+}
+
+BOOST_AUTO_TEST_CASE( SmallVectorCopyMove )
+{
+	spring::small_vector<int, 2> a = {1, 2};
+	spring::small_vector<int, 2> b = {1, 2, 3, 4, 5};
+
+	spring::small_vector<int, 2> c = a;
+	spring::small_vector<int, 2> d = b;
+
+	BOOST_CHECK(c == a);
+	BOOST_CHECK(d == b);
+
+	d[0] = 42;
+	BOOST_CHECK_EQUAL(b[0], 1);
+
+	spring::small_vector<int, 2> e = std::move(b);
+	BOOST_CHECK_EQUAL(e.size(), 5);
+	BOOST_CHECK(b.empty());
+
+	spring::small_vector<int, 2> f = std::move(a);
+	BOOST_CHECK_EQUAL(f.size(), 2);
+	BOOST_CHECK_EQUAL(f[1], 2);
+
+	e.clear();
+	e.shrink_to_fit();
+	BOOST_CHECK_EQUAL(e.capacity(), 2);
+}
+
+
+BOOST_AUTO_TEST_CASE( RingDequeMatchesDeque )
+{
+	spring::ring_deque<std::string> rd;
+	std::deque<std::string> sd;
+
+	// mix of operations at both ends and in the middle, wrapping the ring
+	for (int i = 0; i < 1000; i++) {
+		const std::string s = std::to_string(i);
+
+		switch (i % 7) {
+			case 0: { rd.push_back(s); sd.push_back(s); } break;
+			case 1: { rd.push_front(s); sd.push_front(s); } break;
+			case 2: { rd.insert(rd.begin() + rd.size() / 3, s); sd.insert(sd.begin() + sd.size() / 3, s); } break;
+			case 3: { rd.insert(rd.end() - rd.size() / 4, s); sd.insert(sd.end() - sd.size() / 4, s); } break;
+			case 4: { rd.pop_front(); sd.pop_front(); } break;
+			case 5: {
+				if (rd.size() > 4) {
+					rd.erase(rd.begin() + 1, rd.begin() + 3);
+					sd.erase(sd.begin() + 1, sd.begin() + 3);
+				}
+			} break;
+			case 6: {
+				rd.erase(rd.end() - 1);
+				sd.erase(sd.end() - 1);
+			} break;
+		}
+
+		BOOST_REQUIRE_EQUAL(rd.size(), sd.size());
+		BOOST_REQUIRE(std::equal(rd.begin(), rd.end(), sd.begin()));
+	}
+
+	BOOST_CHECK(std::equal(rd.rbegin(), rd.rend(), sd.rbegin()));
+}
+
+BOOST_AUTO_TEST_CASE( RingDequeStableReferences )
+{
+	spring::ring_deque<int> q;
+	q.push_back(1);
+
+	const int& front = q.front();
+
+	// grows the ring several times
+	for (int i = 0; i < 100; i++) {
+		q.push_back(i);
+		q.push_front(i);
+	}
+
+	BOOST_CHECK_EQUAL(&front, &q[100]);
+	BOOST_CHECK_EQUAL(front, 1);
+
+	// erase returns the element following the erased one
+	spring::ring_deque<int>::iterator it = std::find(q.begin(), q.end(), 1);
+	it = q.erase(it);
+	BOOST_CHECK_EQUAL(*it, 0);
+
+	q.clear();
+	BOOST_CHECK(q.empty());
+
+	q.resize(3);
+	BOOST_CHECK_EQUAL(q.size(), 3);
+	BOOST_CHECK_EQUAL(q.at(2), 0);
+}
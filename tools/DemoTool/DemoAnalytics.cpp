@@ -0,0 +1,288 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "DemoAnalytics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include "Net/Protocol/BaseNetProtocol.h"
+#include "Sim/Misc/GlobalConstants.h"
+#include "System/LoadSave/DemoReader.h"
+#include "System/Net/RawPacket.h"
+
+
+namespace {
+	/// per-player counters gathered from the recorded packet stream
+	struct StreamPlayerCounters {
+		StreamPlayerCounters()
+			: commands(0)
+			, aiCommands(0)
+			, selections(0)
+			, chatMessages(0)
+			, luaMessages(0)
+			, mapDraws(0)
+			, pauses(0)
+		{}
+
+		unsigned commands;
+		unsigned aiCommands;
+		unsigned selections;
+		unsigned chatMessages;
+		unsigned luaMessages;
+		unsigned mapDraws;
+		unsigned pauses;
+	};
+
+	/// formatted table rows of a single demo
+	struct DemoRows {
+		std::string games;
+		std::string players;
+		std::string teams;
+		bool failed = false;
+	};
+
+
+	template<typename T>
+	void PrintSep(std::ostream& out, T value)
+	{
+		out << value << ";";
+	}
+
+	std::string GameIDToString(const DemoFileHeader& header)
+	{
+		char buf[sizeof(header.gameID) * 2 + 1];
+
+		for (unsigned i = 0; i < sizeof(header.gameID); ++i)
+			sprintf(&buf[i * 2], "%02x", header.gameID[i]);
+
+		return std::string(buf, sizeof(header.gameID) * 2);
+	}
+
+
+	/// returns the number of simulated frames recorded in the stream
+	int ScanPacketStream(CDemoReader& reader, std::vector<StreamPlayerCounters>& counters)
+	{
+		int numFrames = 0;
+
+		while (!reader.ReachedEnd()) {
+			const netcode::RawPacket* packet = reader.GetData(FLT_MAX);
+
+			if (packet == nullptr)
+				continue;
+
+			const unsigned char* buffer = packet->data;
+			const unsigned length = packet->length;
+
+			// the offsets match the layouts documented in BaseNetProtocol.h
+			switch (buffer[0]) {
+				case NETMSG_KEYFRAME:
+				case NETMSG_NEWFRAME: {
+					numFrames++;
+				} break;
+				case NETMSG_COMMAND: {
+					if (length > 3) counters[buffer[3]].commands++;
+				} break;
+				case NETMSG_AICOMMAND:
+				case NETMSG_AICOMMANDS:
+				case NETMSG_AICOMMAND_TRACKED: {
+					if (length > 3) counters[buffer[3]].aiCommands++;
+				} break;
+				case NETMSG_SELECT: {
+					if (length > 3) counters[buffer[3]].selections++;
+				} break;
+				case NETMSG_CHAT: {
+					if (length > 2) counters[buffer[2]].chatMessages++;
+				} break;
+				case NETMSG_LUAMSG: {
+					if (length > 3) counters[buffer[3]].luaMessages++;
+				} break;
+				case NETMSG_MAPDRAW: {
+					if (length > 2) counters[buffer[2]].mapDraws++;
+				} break;
+				case NETMSG_PAUSE: {
+					if (length > 1) counters[buffer[1]].pauses++;
+				} break;
+				default: {
+				} break;
+			}
+
+			delete packet;
+		}
+
+		return numFrames;
+	}
+
+
+	void AnalyzeDemo(const std::string& demoFile, DemoRows& rows)
+	{
+		CDemoReader reader(demoFile, 0.0f);
+		reader.LoadStats();
+
+		const DemoFileHeader& header = reader.GetFileHeader();
+		const std::string gameID = GameIDToString(header);
+
+		// player numbers are transmitted as uint8
+		std::vector<StreamPlayerCounters> counters(256);
+
+		const int numFrames = ScanPacketStream(reader, counters);
+		const float gameMinutes = numFrames / float(GAME_SPEED * 60);
+
+		{
+			std::ostringstream out;
+			PrintSep(out, demoFile);
+			PrintSep(out, gameID);
+			PrintSep(out, header.unixTime);
+			PrintSep(out, header.versionString);
+			PrintSep(out, header.gameTime);
+			PrintSep(out, header.wallclockTime);
+			PrintSep(out, numFrames);
+			PrintSep(out, header.numPlayers);
+			PrintSep(out, header.numTeams);
+
+			for (unsigned char allyTeam: reader.GetWinningAllyTeams())
+				out << " " << unsigned(allyTeam);
+
+			out << "\n";
+			rows.games = out.str();
+		}
+		{
+			const std::vector<PlayerStatistics>& playerStats = reader.GetPlayerStats();
+
+			std::ostringstream out;
+
+			// the stats chunk may list more players than fit into a uint8
+			counters.resize(std::max(counters.size(), playerStats.size()));
+
+			for (unsigned playerNum = 0; playerNum < playerStats.size(); ++playerNum) {
+				const PlayerStatistics& ps = playerStats[playerNum];
+				const StreamPlayerCounters& pc = counters[playerNum];
+
+				PrintSep(out, demoFile);
+				PrintSep(out, gameID);
+				PrintSep(out, playerNum);
+				PrintSep(out, ps.numCommands);
+				PrintSep(out, ps.unitCommands);
+				PrintSep(out, ps.mousePixels);
+				PrintSep(out, ps.mouseClicks);
+				PrintSep(out, ps.keyPresses);
+				PrintSep(out, pc.commands);
+				PrintSep(out, pc.aiCommands);
+				PrintSep(out, pc.selections);
+				PrintSep(out, pc.chatMessages);
+				PrintSep(out, pc.luaMessages);
+				PrintSep(out, pc.mapDraws);
+				PrintSep(out, pc.pauses);
+				out << ((gameMinutes > 0.0f)? (pc.commands / gameMinutes): 0.0f) << "\n";
+			}
+
+			rows.players = out.str();
+		}
+		{
+			const std::vector< std::vector<TeamStatistics> >& teamStats = reader.GetTeamStats();
+
+			std::ostringstream out;
+
+			for (unsigned teamNum = 0; teamNum < teamStats.size(); ++teamNum) {
+				int time = 0;
+
+				for (const TeamStatistics& ts: teamStats[teamNum]) {
+					PrintSep(out, demoFile);
+					PrintSep(out, gameID);
+					PrintSep(out, teamNum);
+					PrintSep(out, time);
+					PrintSep(out, ts.metalUsed);
+					PrintSep(out, ts.energyUsed);
+					PrintSep(out, ts.metalProduced);
+					PrintSep(out, ts.energyProduced);
+					PrintSep(out, ts.metalExcess);
+					PrintSep(out, ts.energyExcess);
+					PrintSep(out, ts.metalReceived);
+					PrintSep(out, ts.energyReceived);
+					PrintSep(out, ts.metalSent);
+					PrintSep(out, ts.energySent);
+					PrintSep(out, ts.damageDealt);
+					PrintSep(out, ts.damageReceived);
+					PrintSep(out, ts.unitsProduced);
+					PrintSep(out, ts.unitsDied);
+					PrintSep(out, ts.unitsReceived);
+					PrintSep(out, ts.unitsSent);
+					PrintSep(out, ts.unitsCaptured);
+					PrintSep(out, ts.unitsOutCaptured);
+					out << ts.unitsKilled << "\n";
+
+					time += header.teamStatPeriod;
+				}
+			}
+
+			rows.teams = out.str();
+		}
+	}
+}
+
+
+int RunDemoAnalytics(const std::vector<std::string>& demoFiles, const std::string& outPrefix, unsigned numJobs)
+{
+	if (numJobs == 0)
+		numJobs = std::max(1u, std::thread::hardware_concurrency());
+
+	numJobs = std::min(numJobs, unsigned(demoFiles.size()));
+
+	std::vector<DemoRows> demoRows(demoFiles.size());
+	std::vector<std::thread> workers;
+	std::atomic<size_t> nextDemo(0);
+	std::atomic<int> numFailed(0);
+
+	const auto WorkerFunc = [&]() {
+		for (size_t n = nextDemo++; n < demoFiles.size(); n = nextDemo++) {
+			try {
+				AnalyzeDemo(demoFiles[n], demoRows[n]);
+			} catch (const std::exception& ex) {
+				demoRows[n].failed = true;
+				numFailed++;
+				std::cerr << "Skipping " << demoFiles[n] << ": " << ex.what() << std::endl;
+			}
+		}
+	};
+
+	workers.reserve(numJobs);
+
+	for (unsigned i = 0; i < numJobs; ++i)
+		workers.emplace_back(WorkerFunc);
+
+	for (std::thread& worker: workers)
+		worker.join();
+
+	std::ofstream games((outPrefix + "games.csv").c_str());
+	std::ofstream players((outPrefix + "players.csv").c_str());
+	std::ofstream teams((outPrefix + "teams.csv").c_str());
+
+	games << "Demo;GameID;UnixTime;Version;GameTime[sec];WallclockTime[sec];Frames;"
+	      << "NumPlayers;NumTeams;WinningAllyTeams" << std::endl;
+	players << "Demo;GameID;Player;NumCommands;UnitCommands;MousePixels;MouseClicks;KeyPresses;"
+	        << "StreamCommands;StreamAICommands;Selections;ChatMessages;LuaMessages;MapDraws;Pauses;"
+	        << "CommandsPerMinute" << std::endl;
+	teams << "Demo;GameID;Team;Time[sec];MetalUsed;EnergyUsed;MetalProduced;EnergyProduced;"
+	      << "MetalExcess;EnergyExcess;MetalReceived;EnergyReceived;MetalSent;EnergySent;"
+	      << "DamageDealt;DamageReceived;UnitsProduced;UnitsDied;UnitsReceived;UnitsSent;"
+	      << "UnitsCaptured;UnitsOutCaptured;UnitsKilled" << std::endl;
+
+	for (const DemoRows& rows: demoRows) {
+		if (rows.failed)
+			continue;
+
+		games << rows.games;
+		players << rows.players;
+		teams << rows.teams;
+	}
+
+	std::cout << "Analyzed " << (demoFiles.size() - numFailed) << " of " << demoFiles.size();
+	std::cout << " demos using " << numJobs << " threads" << std::endl;
+	return numFailed;
+}
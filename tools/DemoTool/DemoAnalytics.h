@@ -0,0 +1,24 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef DEMO_ANALYTICS_H
+#define DEMO_ANALYTICS_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Extracts gameplay metrics from demos without simulating them
+ *
+ * Every demo is read on one of numJobs worker threads: the embedded player-
+ * and team-statistics chunks are loaded and the recorded packet stream is
+ * scanned for per-player command, selection and chat counts. Results are
+ * written as three semicolon-separated tables (one row per game, player and
+ * team statistics sample), named outPrefix + "games.csv", "players.csv" and
+ * "teams.csv". Rows always appear in the order the demos were given.
+ *
+ * @param numJobs number of worker threads, 0 means one per hardware thread
+ * @return number of demos that could not be read
+ */
+int RunDemoAnalytics(const std::vector<std::string>& demoFiles, const std::string& outPrefix, unsigned numJobs);
+
+#endif // DEMO_ANALYTICS_H
@@ -5,8 +5,11 @@
 #include <iostream>
 #include <gflags/gflags.h>
 #include <iomanip> //hex
+#include <algorithm>
+#include <vector>
 
 #include "StringSerializer.h"
+#include "DemoAnalytics.h"
 
 #include "Net/Protocol/BaseNetProtocol.h"
 #include "System/LoadSave/DemoReader.h"
@@ -17,6 +20,9 @@
 Usage:
 Start with the full! path to the demofile as the only argument
 
+In analytics mode (--analytics=<prefix>) any number of demofiles can be
+given; they are processed in parallel and written as csv tables.
+
 Please note that not all NETMSG's are implemented, expand if needed.
 
 When compiling for windows with MinGW, make sure to use the
@@ -32,6 +38,8 @@ no console output (you still could use this.exe > z.tzt though).
 	DEFINE_bool  (teamstats,    false, "Print teamstats");
 	DEFINE_int32 (team,         -1,    "Select team");
 	DEFINE_string(teamsstatcsv, "",    "Write teamstats in a csv file");
+	DEFINE_string(analytics,    "",    "Write game, player and team tables of all given demos to <prefix>{games,players,teams}.csv");
+	DEFINE_int32 (jobs,         0,     "Number of threads used by analytics, 0 uses all cores");
 
 
 void TrafficDump(CDemoReader& reader, bool trafficStats);
@@ -43,6 +51,19 @@ int main (int argc, char* argv[])
 
 	gflags::SetUsageMessage(std::string("Usage: ") + argv[0] + " [options] path_to_demo.sdfz");
 	gflags::ParseCommandLineFlags(&argc, &argv, true);
+	if (!FLAGS_analytics.empty())
+	{
+		std::vector<std::string> demoFiles(argv + 1, argv + argc);
+		if (!FLAGS_demofile.empty())
+			demoFiles.insert(demoFiles.begin(), FLAGS_demofile);
+
+		if (demoFiles.empty())
+		{
+			std::cout << "analytics requires at least one demofile" << std::endl;
+			exit(1);
+		}
+		return (RunDemoAnalytics(demoFiles, FLAGS_analytics, std::max(0, FLAGS_jobs)) != 0);
+	}
 	if (!FLAGS_demofile.empty()) {
 		filename = FLAGS_demofile;
 	} else if (argc >= 2) {
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+
+# compares the per-timer statistics written by spring --benchmark-json
+# against a baseline run; both arguments are either single JSON files or
+# directories of them (matched by file name)
+#
+# exits with status 1 if any timer regressed by more than the threshold
+
+import argparse
+import json
+import os
+import sys
+
+STATS = ("mean", "p50", "p99", "max")
+
+
+def load_runs(path):
+	if os.path.isfile(path):
+		return {os.path.basename(path): path}
+
+	return {f: os.path.join(path, f) for f in sorted(os.listdir(path)) if f.endswith(".json")}
+
+
+def compare_run(name, baseline, current, args):
+	regressions = 0
+
+	print("%s (%d -> %d frames)" % (name, baseline["numFrames"], current["numFrames"]))
+
+	for timer, stats in sorted(current["timers"].items()):
+		if not timer.startswith(tuple(args.prefix)):
+			continue
+
+		base = baseline["timers"].get(timer)
+
+		if base is None:
+			print("  %-40s new" % timer)
+			continue
+
+		changes = []
+
+		for stat in STATS:
+			old = base[stat]
+			new = stats[stat]
+
+			# ignore timers too short to measure reliably
+			if max(old, new) < args.min_ms:
+				continue
+
+			ratio = (new - old) / old if old > 0.0 else float("inf")
+			regressed = (ratio * 100.0 > args.threshold)
+			regressions += regressed
+
+			if regressed or args.verbose:
+				changes.append("%s %.3f -> %.3f ms (%+.1f%%)%s" % (stat, old, new, ratio * 100.0, " !" if regressed else ""))
+
+		if changes:
+			print("  %-40s %s" % (timer, ", ".join(changes)))
+
+	return regressions
+
+
+def main():
+	parser = argparse.ArgumentParser(description = "compare benchmark timer statistics against a baseline")
+	parser.add_argument("baseline")
+	parser.add_argument("current")
+	parser.add_argument("--threshold", type = float, default = 10.0, help = "regression threshold in percent (default 10)")
+	parser.add_argument("--min-ms", type = float, default = 0.05, help = "ignore statistics below this many milliseconds (default 0.05)")
+	parser.add_argument("--prefix", action = "append", default = None, help = "only compare timers starting with this (default Sim)")
+	parser.add_argument("--verbose", action = "store_true", help = "print all compared statistics")
+
+	args = parser.parse_args()
+	args.prefix = args.prefix or ["Sim"]
+
+	baselineRuns = load_runs(args.baseline)
+	currentRuns = load_runs(args.current)
+
+	regressions = 0
+
+	for name, path in currentRuns.items():
+		if name not in baselineRuns:
+			print("%s: no baseline" % name)
+			continue
+
+		with open(baselineRuns[name]) as f:
+			baseline = json.load(f)
+		with open(path) as f:
+			current = json.load(f)
+
+		regressions += compare_run(name, baseline, current, args)
+
+	print("%d regressed statistics" % regressions)
+	return (1 if regressions > 0 else 0)
+
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -0,0 +1,52 @@
+#!/bin/bash
+
+# replays every demo in DEMODIR with spring-headless at maximum speed and
+# writes one JSON file of per-timer sim-frame statistics per demo, then
+# compares them against BASELINEDIR (if it exists) with compare.py
+#
+# usage: run_suite.sh <spring-headless> [DEMODIR] [OUTDIR] [BASELINEDIR]
+#
+# demos have to be recorded with the engine version being tested, the
+# content (game and map archives) must be available in the data-dirs
+
+set -e
+
+if [ $# -lt 1 ]; then
+	echo "Usage: $0 <spring-headless> [demodir] [outdir] [baselinedir]"
+	exit 1
+fi
+
+SCRIPTDIR=$(cd "$(dirname "$0")" && pwd)
+
+SPRING="$1"
+DEMODIR="${2:-$SCRIPTDIR/demos}"
+OUTDIR="${3:-$PWD/bench_results_$(date +"%Y-%m-%d_%H-%M-%S")}"
+BASELINEDIR="${4:-$SCRIPTDIR/baseline}"
+
+# minutes of game-time replayed per demo
+MINUTES=${BENCHMARK_MINUTES:-10}
+
+shopt -s nullglob
+DEMOS=("$DEMODIR"/*.sdfz "$DEMODIR"/*.sdf)
+
+# none are checked in (they depend on the engine version and local content),
+# so an empty directory is not an error
+if [ ${#DEMOS[@]} -eq 0 ]; then
+	echo "No demos found in $DEMODIR, skipping the benchmark."
+	echo "Record .sdfz demos with the engine being tested and copy them there."
+	exit 0
+fi
+
+mkdir -p "$OUTDIR"
+
+for DEMO in "${DEMOS[@]}"; do
+	NAME=$(basename "$DEMO")
+	NAME="${NAME%.*}"
+
+	echo "Replaying $NAME"
+	"$SPRING" --benchmark "$MINUTES" --benchmarkstart 0 --benchmark-json "$OUTDIR/$NAME.json" "$DEMO" >"$OUTDIR/$NAME.log" 2>&1
+done
+
+if [ -d "$BASELINEDIR" ]; then
+	python3 "$SCRIPTDIR/compare.py" "$BASELINEDIR" "$OUTDIR"
+fi
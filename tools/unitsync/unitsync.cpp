@@ -4,7 +4,10 @@
 #include "unitsync_api.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <exception>
+#include <functional>
 #include <string>
 #include <vector>
 #include <set>
@@ -294,6 +297,95 @@ class ScopedMapLoader {
 };
 
 
+class ScopedThreadMapLoader {
+	public:
+		/**
+		 * @brief Helper class for loading a map archive into a private VFS
+		 *   of the calling thread
+		 * @param mapName the name of the to be loaded map
+		 *
+		 * Unlike ScopedMapLoader this leaves the global VFS alone, so any
+		 * number of instances can be alive on different threads at once.
+		 */
+		ScopedThreadMapLoader(const std::string& mapName)
+		{
+			handler.AddArchiveWithDeps(mapName, false);
+			threadVFSHandler = &handler;
+		}
+
+		~ScopedThreadMapLoader()
+		{
+			threadVFSHandler = nullptr;
+		}
+
+	private:
+		CVFSHandler handler;
+};
+
+
+/**
+ * @brief Runs func(index, mapFile) for each of the given maps in parallel
+ * @return the number of maps for which func did not throw
+ *
+ * Each map is loaded by a ScopedThreadMapLoader on the worker processing it;
+ * the archive scanner is shared between them without locking, so func must
+ * only read from it (anything that can update its cached archive data, such
+ * as computing checksums, has to happen before). Errors are collected per map,
+ * the first one is reported via SetLastError once all workers are done.
+ */
+static int ProcessMapsParallel(const char* caller, int count, const char** mapNames, const std::function<void(int, const std::string&)>& func)
+{
+	std::vector<std::string> errors(count);
+	std::atomic<int> nextIndex = {0};
+	std::atomic<int> numProcessed = {0};
+
+	const auto worker = [&]() {
+		for (int i = nextIndex++; i < count; i = nextIndex++) {
+			try {
+				_CheckNullOrEmpty(mapNames[i], "mapName");
+
+				const std::string mapFile = GetMapFile(mapNames[i]);
+				const ScopedThreadMapLoader mapLoader(mapNames[i]);
+
+				func(i, mapFile);
+				numProcessed += 1;
+			}
+			catch (const std::exception& ex) {
+				errors[i] = ex.what();
+			}
+			catch (...) {
+				errors[i] = "an unknown exception was thrown";
+			}
+		}
+	};
+
+	const int numThreads = std::max(1, std::min(count, int(spring::thread::hardware_concurrency())));
+	std::vector<spring::thread> threads;
+
+	threads.reserve(numThreads - 1);
+
+	for (int i = 1; i < numThreads; i++) {
+		threads.emplace_back(worker);
+	}
+
+	worker();
+
+	for (spring::thread& t: threads) {
+		t.join();
+	}
+
+	for (int i = 0; i < count; i++) {
+		if (errors[i].empty())
+			continue;
+
+		_SetLastError(std::string(caller) + ": " + (mapNames[i] != nullptr? mapNames[i]: "(null)") + ": " + errors[i]);
+		break;
+	}
+
+	return numProcessed;
+}
+
+
 
 EXPORT(const char*) GetSpringVersion()
 {
@@ -923,15 +1015,12 @@ static unsigned short* GetMinimapSM3(std::string mapFileName, int mipLevel)
 	*/
 }
 
-static unsigned short* GetMinimapSMF(std::string mapFileName, int mipLevel)
+static unsigned short* GetMinimapSMF(std::string mapFileName, int mipLevel, unsigned short* colors = imgbuf)
 {
 	CSMFMapFile in(mapFileName);
 	std::vector<uint8_t> buffer;
 	const int mipsize = in.ReadMinimap(buffer, mipLevel);
 
-	// Do stuff
-	unsigned short* colors = (unsigned short*)((void*)imgbuf);
-
 	unsigned char* temp = &buffer[0];
 
 	const int numblocks = buffer.size()/8;
@@ -1040,6 +1129,44 @@ EXPORT(int) GetInfoMapSize(const char* mapName, const char* name, int* width, in
 }
 
 
+static int ReadInfoMap(const std::string& mapFile, const char* name, unsigned char* data, int typeHint)
+{
+	int ret = -1;
+
+	CSMFMapFile file(mapFile);
+
+	const std::string n = name;
+	int actualType = (n == "height" ? bm_grayscale_16 : bm_grayscale_8);
+
+	if (actualType == typeHint) {
+		ret = file.ReadInfoMap(n, data);
+	} else if (actualType == bm_grayscale_16 && typeHint == bm_grayscale_8) {
+		// convert from 16 bits per pixel to 8 bits per pixel
+		MapBitmapInfo bmInfo;
+		file.GetInfoMapSize(name, &bmInfo);
+
+		const int size = bmInfo.width * bmInfo.height;
+		if (size > 0) {
+			unsigned short* temp = new unsigned short[size];
+			if (file.ReadInfoMap(n, temp)) {
+				const unsigned short* inp = temp;
+				const unsigned short* inp_end = temp + size;
+				unsigned char* outp = data;
+				for (; inp < inp_end; ++inp, ++outp) {
+					*outp = *inp >> 8;
+				}
+				ret = 1;
+			}
+			delete[] temp;
+		}
+	} else if (actualType == bm_grayscale_8 && typeHint == bm_grayscale_16) {
+		throw content_error("converting from 8 bits per pixel to 16 bits per pixel is unsupported");
+	}
+
+	return ret;
+}
+
+
 EXPORT(int) GetInfoMap(const char* mapName, const char* name, unsigned char* data, int typeHint)
 {
 	int ret = -1;
@@ -1052,39 +1179,109 @@ EXPORT(int) GetInfoMap(const char* mapName, const char* name, unsigned char* dat
 
 		const std::string mapFile = GetMapFile(mapName);
 		ScopedMapLoader mapLoader(mapName, mapFile);
-		CSMFMapFile file(mapFile);
 
-		const std::string n = name;
-		int actualType = (n == "height" ? bm_grayscale_16 : bm_grayscale_8);
-
-		if (actualType == typeHint) {
-			ret = file.ReadInfoMap(n, data);
-		} else if (actualType == bm_grayscale_16 && typeHint == bm_grayscale_8) {
-			// convert from 16 bits per pixel to 8 bits per pixel
-			MapBitmapInfo bmInfo;
-			file.GetInfoMapSize(name, &bmInfo);
-
-			const int size = bmInfo.width * bmInfo.height;
-			if (size > 0) {
-				unsigned short* temp = new unsigned short[size];
-				if (file.ReadInfoMap(n, temp)) {
-					const unsigned short* inp = temp;
-					const unsigned short* inp_end = temp + size;
-					unsigned char* outp = data;
-					for (; inp < inp_end; ++inp, ++outp) {
-						*outp = *inp >> 8;
-					}
-					ret = 1;
-				}
-				delete[] temp;
+		ret = ReadInfoMap(mapFile, name, data, typeHint);
+	}
+	UNITSYNC_CATCH_BLOCKS;
+
+	return ret;
+}
+
+
+EXPORT(int) GetMapsMetadata(int count, const char** mapNames, int mipLevel, unsigned int* checksums, int* widths, int* heights, unsigned short** minimaps)
+{
+	try {
+		CheckInit();
+		CheckPositive(count);
+		CheckNull(mapNames);
+
+		if (mipLevel < 0 || mipLevel > 8)
+			throw std::out_of_range("Miplevel must be between 0 and 8 (inclusive) in GetMapsMetadata.");
+
+		for (int i = 0; i < count; i++) {
+			if (checksums != nullptr) checksums[i] = 0;
+			if (widths    != nullptr) widths[i]    = 0;
+			if (heights   != nullptr) heights[i]   = 0;
+		}
+
+		// checksums are computed (and cached) by the archive scanner, which
+		// modifies its archive data while doing so; get them serially before
+		// the workers start reading from it and report any failure per map
+		std::vector<unsigned int> mapChecksums(count, 0);
+		std::vector<std::exception_ptr> checksumErrors(count);
+
+		for (int i = 0; checksums != nullptr && i < count; i++) {
+			if (mapNames[i] == nullptr || *mapNames[i] == 0)
+				continue;
+
+			try {
+				mapChecksums[i] = archiveScanner->GetArchiveCompleteChecksum(mapNames[i]);
+			} catch (...) {
+				checksumErrors[i] = std::current_exception();
 			}
-		} else if (actualType == bm_grayscale_8 && typeHint == bm_grayscale_16) {
-			throw content_error("converting from 8 bits per pixel to 16 bits per pixel is unsupported");
 		}
+
+		return ProcessMapsParallel(__FUNCTION__, count, mapNames, [&](int i, const std::string& mapFile) {
+			if (checksums != nullptr) {
+				if (checksumErrors[i] != nullptr)
+					std::rethrow_exception(checksumErrors[i]);
+
+				checksums[i] = mapChecksums[i];
+			}
+
+			if (FileSystem::GetExtension(mapFile) != "smf")
+				throw content_error("SM3 maps are no longer supported as of Spring 95.0");
+
+			if (widths != nullptr || heights != nullptr) {
+				const CSMFMapFile file(mapFile);
+				const SMFHeader& mh = file.GetHeader();
+
+				if (widths  != nullptr) widths[i]  = mh.mapx * SQUARE_SIZE;
+				if (heights != nullptr) heights[i] = mh.mapy * SQUARE_SIZE;
+			}
+
+			if (minimaps != nullptr && minimaps[i] != nullptr)
+				GetMinimapSMF(mapFile, mipLevel, minimaps[i]);
+		});
 	}
 	UNITSYNC_CATCH_BLOCKS;
+	return -1;
+}
 
-	return ret;
+
+EXPORT(int) GetInfoMaps(int count, const char** mapNames, const char* name, unsigned char** data, int* widths, int* heights, int typeHint)
+{
+	try {
+		CheckInit();
+		CheckPositive(count);
+		CheckNull(mapNames);
+		CheckNullOrEmpty(name);
+
+		for (int i = 0; i < count; i++) {
+			if (widths  != nullptr) widths[i]  = 0;
+			if (heights != nullptr) heights[i] = 0;
+		}
+
+		return ProcessMapsParallel(__FUNCTION__, count, mapNames, [&](int i, const std::string& mapFile) {
+			if (widths != nullptr || heights != nullptr) {
+				const CSMFMapFile file(mapFile);
+				MapBitmapInfo bmInfo;
+
+				file.GetInfoMapSize(name, &bmInfo);
+
+				if (widths  != nullptr) widths[i]  = bmInfo.width;
+				if (heights != nullptr) heights[i] = bmInfo.height;
+			}
+
+			if (data == nullptr || data[i] == nullptr)
+				return;
+
+			if (ReadInfoMap(mapFile, name, data[i], typeHint) <= 0)
+				throw content_error(std::string("could not read infomap \"") + name + "\"");
+		});
+	}
+	UNITSYNC_CATCH_BLOCKS;
+	return -1;
 }
 
 
@@ -387,6 +387,45 @@ EXPORT(int         ) GetInfoMapSize(const char* mapName, const char* name, int*
  * conversion from 16 bpp to 8 bpp is implemented.
  */
 EXPORT(int         ) GetInfoMap(const char* mapName, const char* name, unsigned char* data, int typeHint);
+/**
+ * @brief Retrieves checksum, size and minimap of several maps at once
+ * @param count     The number of maps in mapNames.
+ * @param mapNames  The names of the maps, e.g. "SmallDivide".
+ * @param mipLevel  Which mip-level of the minimaps to extract, see GetMinimap.
+ * @param checksums Receives the checksum of each map (0 on error), may be NULL.
+ * @param widths    Receives the width of each map (0 on error), may be NULL.
+ * @param heights   Receives the height of each map (0 on error), may be NULL.
+ * @param minimaps  Array of count pointers to memory with room for
+ *   (1024 >> mipLevel)^2 RGB-565 pixels each, may be NULL as may be any of
+ *   its elements.
+ * @return negative integer (< 0) on error;
+ *   the number of maps processed successfully (>= 0) otherwise
+ *
+ * The maps are processed in parallel, each on a private VFS of its own, which
+ * is considerably faster than calling GetMapChecksumFromName, GetMapInfoCount
+ * and GetMinimap once per map. The first per-map error (if any) is available
+ * through GetNextError.
+ * @see GetMinimap
+ */
+EXPORT(int         ) GetMapsMetadata(int count, const char** mapNames, int mipLevel, unsigned int* checksums, int* widths, int* heights, unsigned short** minimaps);
+/**
+ * @brief Retrieves dimensions and data of an infomap for several maps at once
+ * @param count    The number of maps in mapNames.
+ * @param mapNames The names of the maps, e.g. "SmallDivide".
+ * @param name     Which infomap to extract, see GetInfoMap.
+ * @param data     Array of count pointers to memory with enough room to hold
+ *   the respective infomap, may be NULL (to only query the dimensions) as may
+ *   be any of its elements.
+ * @param widths   Receives the width of each infomap (0 on error), may be NULL.
+ * @param heights  Receives the height of each infomap (0 on error), may be NULL.
+ * @param typeHint One of bm_grayscale_8 (or 1) and bm_grayscale_16 (or 2).
+ * @return negative integer (< 0) on error;
+ *   the number of maps processed successfully (>= 0) otherwise
+ *
+ * The maps are processed in parallel like by GetMapsMetadata.
+ * @see GetInfoMap
+ */
+EXPORT(int         ) GetInfoMaps(int count, const char** mapNames, const char* name, unsigned char** data, int* widths, int* heights, int typeHint);
 
 /**
  * @brief Retrieves the number of Skirmish AIs available